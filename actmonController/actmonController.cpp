@@ -0,0 +1,115 @@
+#include "actmonController.h"
+#include "../timestamp/timestamp.h"
+#include <cstdint>
+#include <cassert>
+
+ActmonController::ActmonController() : actmon(actmonController::baseAddress)
+{
+}
+
+void ActmonController::enableController()
+{
+    if(!clockAndReset.isClockEnabled(carController::ACTMON) || clockAndReset.isInReset(carController::ACTMON))
+    {
+        clockAndReset.bringUp(carController::ACTMON);
+    }
+}
+
+uint32_t ActmonController::setSamplePeriod(uint32_t periodUs)
+{
+    assert(periodUs > 0);
+
+    uint32_t timeBase = actmonController::SAMPLE_TB_BIT_USEC;
+    uint32_t units = periodUs;
+
+    // Between 256 us and 1 ms neither time base fits, round down to 256 us
+    if(periodUs >= 1000)
+    {
+        timeBase = actmonController::SAMPLE_TB_BIT_MSEC;
+        units = periodUs/1000;
+    }
+
+    // Past 256 ms there are no more units, round down to the longest window
+    if(units > actmonController::MAX_SAMPLE_PERIOD)
+    {
+        units = actmonController::MAX_SAMPLE_PERIOD;
+    }
+
+    actmon.setRegister(ACTMON_GLB_PERIOD_CTRL_0::addressOffset,
+        (timeBase << ACTMON_GLB_PERIOD_CTRL_0::SAMPLE_TB_bit) |
+        ((units - 1) << ACTMON_GLB_PERIOD_CTRL_0::SAMPLE_PERIOD_bit));
+
+    return getSamplePeriod();
+}
+
+uint32_t ActmonController::getSamplePeriod()
+{
+    uint32_t periodControl = actmon.getRegister(ACTMON_GLB_PERIOD_CTRL_0::addressOffset);
+    uint32_t timeBase = (periodControl >> ACTMON_GLB_PERIOD_CTRL_0::SAMPLE_TB_bit) & ((1 << ACTMON_GLB_PERIOD_CTRL_0::SAMPLE_TB_bitWidth) - 1);
+    uint32_t units = ((periodControl >> ACTMON_GLB_PERIOD_CTRL_0::SAMPLE_PERIOD_bit) & ((1 << ACTMON_GLB_PERIOD_CTRL_0::SAMPLE_PERIOD_bitWidth) - 1)) + 1;
+
+    return (timeBase == actmonController::SAMPLE_TB_BIT_USEC) ? units : units*1000;
+}
+
+/*
+ * Disabled while it is reprogrammed so the first window after enabling
+ * is a whole one. The average starts at zero and has to ramp up.
+ */
+void ActmonController::enableDevice(uint32_t device, uint32_t countWeight, uint32_t kVal)
+{
+    assert(kVal < (1 << ACTMON_DEV_CTRL_0::K_VAL_bitWidth));
+
+    uint32_t deviceOffset = getDeviceOffset(device);
+
+    actmon.setRegister(deviceOffset + ACTMON_DEV_CTRL_0::addressOffset, 0);
+    actmon.setRegister(deviceOffset + ACTMON_DEV_COUNT_WEIGHT_0::addressOffset, countWeight);
+    actmon.setRegister(deviceOffset + ACTMON_DEV_INIT_AVG_0::addressOffset, 0);
+    actmon.setRegister(deviceOffset + ACTMON_DEV_INTR_STATUS_0::addressOffset, 0xFFFFFFFF);
+    actmon.setRegister(deviceOffset + ACTMON_DEV_CTRL_0::addressOffset,
+        (1 << ACTMON_DEV_CTRL_0::ENB_bit) |
+        (1 << ACTMON_DEV_CTRL_0::ENB_PERIODIC_bit) |
+        (kVal << ACTMON_DEV_CTRL_0::K_VAL_bit));
+}
+
+void ActmonController::disableDevice(uint32_t device)
+{
+    actmon.setRegister(getDeviceOffset(device) + ACTMON_DEV_CTRL_0::addressOffset, 0);
+}
+
+bool ActmonController::isDeviceEnabled(uint32_t device)
+{
+    return actmon.getRegisterField(getDeviceOffset(device) + ACTMON_DEV_CTRL_0::addressOffset, ACTMON_DEV_CTRL_0::ENB_bit, ACTMON_DEV_CTRL_0::ENB_bitWidth) != 0;
+}
+
+uint32_t ActmonController::getCount(uint32_t device)
+{
+    return actmon.getRegister(getDeviceOffset(device) + ACTMON_DEV_COUNT_0::addressOffset);
+}
+
+uint32_t ActmonController::getAverageCount(uint32_t device)
+{
+    return actmon.getRegister(getDeviceOffset(device) + ACTMON_DEV_AVG_COUNT_0::addressOffset);
+}
+
+void ActmonController::sample(ActmonSample& snapshot)
+{
+    snapshot.timestampNs = Timestamp::now();
+    snapshot.samplePeriodUs = getSamplePeriod();
+
+    for(uint32_t device = 0; device < actmonController::NUMBER_OF_DEVICES; device++)
+    {
+        snapshot.count[device] = getCount(device);
+        snapshot.averageCount[device] = getAverageCount(device);
+    }
+}
+
+volatile uint32_t* ActmonController::getCountAddress(uint32_t device)
+{
+    return actmon.getRegisterAddress(getDeviceOffset(device) + ACTMON_DEV_COUNT_0::addressOffset);
+}
+
+uint32_t ActmonController::getDeviceOffset(uint32_t device)
+{
+    assert(device < actmonController::NUMBER_OF_DEVICES);
+    return actmonController::DEVICE_BASE_OFFSET + (device*actmonController::DEVICE_STRIDE);
+}
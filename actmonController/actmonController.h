@@ -0,0 +1,250 @@
+/**
+ * @file actmonController.h
+ * @brief activity monitor register declaration and class declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano activity monitor direct register access drivers
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class ActmonController
+ * @brief Activity monitor counters for the CPU, buses and memory controller
+ *
+ * @section Description
+ *
+ * The activity monitor (ACTMON) at 0x6000c800 counts the active cycles of
+ * seven clients over a common sample window. Each client has the same
+ * block of registers, 0x40 apart from 0x80:
+ * ________________________________________________________
+ * Device  | Offset | Counts
+ * CPU     | 0x080  | CPU cluster busy cycles
+ * COP     | 0x0C0  | BPMP/AVP busy cycles
+ * AHB     | 0x100  | AHB bus transactions, where the GPIO, pinmux and CAR sit
+ * APB     | 0x140  | APB bus transactions, SPI, I2C, UART ...
+ * CPU_FREQ| 0x180  | CPU cycles, scaled by the CPU frequency
+ * MC_ALL  | 0x1C0  | memory controller requests from every client
+ * MC_CPU  | 0x200  | memory controller requests from the CPU cluster
+ *
+ * With ENB_PERIODIC set, COUNT holds the weighted activity of the last
+ * finished window and AVG_COUNT a running average with time constant
+ * 2^(K_VAL + 1) windows. COUNT only changes at a window boundary, so
+ * polling it more often than once a window returns the same value, and a
+ * read is one uncached load with no system call.
+ *
+ * COUNT_WEIGHT scales every active cycle, so only compare counts taken
+ * with the same weight. ACTMON_DEFAULT_COUNT_WEIGHT is the weight the
+ * kernel's devfreq driver uses for the memory controller.
+ *
+ * The kernel's EMC frequency scaling owns MC_ALL and MC_CPU while it runs.
+ * Reading their counters is harmless, but setSamplePeriod() and
+ * enableDevice() change what the governor sees. Counters on the other
+ * devices are free to use.
+ */
+
+#ifndef ACTMON_CONTROLLER_H
+#define ACTMON_CONTROLLER_H
+
+#include <cstdint>
+
+#include "../peripheralController/peripheralController.h"
+#include "../carController/carController.h"
+
+struct actmonController
+{
+    static const uint32_t baseAddress = 0x6000c800;
+
+    static const uint32_t CPU = 0;
+    static const uint32_t COP = 1;
+    static const uint32_t AHB = 2;
+    static const uint32_t APB = 3;
+    static const uint32_t CPU_FREQ = 4;
+    static const uint32_t MC_ALL = 5;
+    static const uint32_t MC_CPU = 6;
+    static const uint32_t NUMBER_OF_DEVICES = 7;
+
+    static const uint32_t DEVICE_BASE_OFFSET = 0x80;
+    static const uint32_t DEVICE_STRIDE = 0x40;
+
+    static const uint32_t SAMPLE_TB_BIT_MSEC = 0;
+    static const uint32_t SAMPLE_TB_BIT_USEC = 1;
+
+    static const uint32_t MAX_SAMPLE_PERIOD = 256; // SAMPLE_PERIOD + 1 time base units
+
+    static const uint32_t DEFAULT_COUNT_WEIGHT = 0x400;
+    static const uint32_t DEFAULT_K_VAL = 4; // average over 32 windows
+};
+
+// ACTMON_GLB_STATUS_0, the interrupt status of every device
+struct ACTMON_GLB_STATUS_0
+{
+    static const uint32_t addressOffset = 0x000;
+};
+
+// ACTMON_GLB_PERIOD_CTRL_0, the sample window of every device
+struct ACTMON_GLB_PERIOD_CTRL_0
+{
+    static const uint32_t addressOffset = 0x004;
+
+    static const uint32_t SAMPLE_TB_bit = 8;
+    static const uint32_t SAMPLE_TB_bitWidth = 1;
+
+    static const uint32_t SAMPLE_PERIOD_bit = 0; // window length - 1
+    static const uint32_t SAMPLE_PERIOD_bitWidth = 8;
+};
+
+// Per device registers, relative to DEVICE_BASE_OFFSET + device*DEVICE_STRIDE
+
+// ACTMON_DEV_CTRL_0
+struct ACTMON_DEV_CTRL_0
+{
+    static const uint32_t addressOffset = 0x00;
+
+    static const uint32_t ENB_bit = 31;
+    static const uint32_t ENB_bitWidth = 1;
+
+    static const uint32_t AVG_ABOVE_WMARK_EN_bit = 30;
+    static const uint32_t AVG_ABOVE_WMARK_EN_bitWidth = 1;
+
+    static const uint32_t AVG_BELOW_WMARK_EN_bit = 29;
+    static const uint32_t AVG_BELOW_WMARK_EN_bitWidth = 1;
+
+    static const uint32_t ABOVE_WMARK_EN_bit = 28;
+    static const uint32_t ABOVE_WMARK_EN_bitWidth = 1;
+
+    static const uint32_t BELOW_WMARK_EN_bit = 27;
+    static const uint32_t BELOW_WMARK_EN_bitWidth = 1;
+
+    static const uint32_t ENB_PERIODIC_bit = 18;
+    static const uint32_t ENB_PERIODIC_bitWidth = 1;
+
+    static const uint32_t K_VAL_bit = 10;
+    static const uint32_t K_VAL_bitWidth = 3;
+};
+
+// ACTMON_DEV_UPPER_WMARK_0
+struct ACTMON_DEV_UPPER_WMARK_0
+{
+    static const uint32_t addressOffset = 0x04;
+};
+
+// ACTMON_DEV_LOWER_WMARK_0
+struct ACTMON_DEV_LOWER_WMARK_0
+{
+    static const uint32_t addressOffset = 0x08;
+};
+
+// ACTMON_DEV_INIT_AVG_0
+struct ACTMON_DEV_INIT_AVG_0
+{
+    static const uint32_t addressOffset = 0x0C;
+};
+
+// ACTMON_DEV_AVG_UPPER_WMARK_0
+struct ACTMON_DEV_AVG_UPPER_WMARK_0
+{
+    static const uint32_t addressOffset = 0x10;
+};
+
+// ACTMON_DEV_AVG_LOWER_WMARK_0
+struct ACTMON_DEV_AVG_LOWER_WMARK_0
+{
+    static const uint32_t addressOffset = 0x14;
+};
+
+// ACTMON_DEV_COUNT_WEIGHT_0
+struct ACTMON_DEV_COUNT_WEIGHT_0
+{
+    static const uint32_t addressOffset = 0x18;
+};
+
+// ACTMON_DEV_COUNT_0, weighted activity of the last finished window
+struct ACTMON_DEV_COUNT_0
+{
+    static const uint32_t addressOffset = 0x1C;
+};
+
+// ACTMON_DEV_AVG_COUNT_0
+struct ACTMON_DEV_AVG_COUNT_0
+{
+    static const uint32_t addressOffset = 0x20;
+};
+
+// ACTMON_DEV_INTR_STATUS_0, write 1 to clear
+struct ACTMON_DEV_INTR_STATUS_0
+{
+    static const uint32_t addressOffset = 0x24;
+};
+
+struct ActmonSample
+{
+    uint64_t timestampNs; // Timestamp::now() when the counters were read
+    uint32_t samplePeriodUs;
+    uint32_t count[actmonController::NUMBER_OF_DEVICES];
+    uint32_t averageCount[actmonController::NUMBER_OF_DEVICES];
+};
+
+class ActmonController
+{
+    public:
+        ActmonController();
+
+        ActmonController(const ActmonController&) = delete;
+        ActmonController& operator=(const ActmonController&) = delete;
+
+        // Starts the ACTMON clock and takes it out of reset if the kernel has not.
+        void enableController();
+
+        /*
+         * Window shared by every device, 1 us to 256 ms, longer periods get
+         * 256 ms. Returns the window actually programmed in microseconds,
+         * the longest the time base can reach without going over periodUs.
+         */
+        uint32_t setSamplePeriod(uint32_t periodUs);
+        uint32_t getSamplePeriod();
+
+        /*
+         * Periodic counting with no interrupts. countWeight scales every
+         * active cycle, kVal sets the average's time constant.
+         */
+        void enableDevice(uint32_t device, uint32_t countWeight = actmonController::DEFAULT_COUNT_WEIGHT,
+            uint32_t kVal = actmonController::DEFAULT_K_VAL);
+        void disableDevice(uint32_t device);
+        bool isDeviceEnabled(uint32_t device);
+
+        uint32_t getCount(uint32_t device);
+        uint32_t getAverageCount(uint32_t device);
+
+        // Every device's counters at one timestamp. Disabled devices hold their last count.
+        void sample(ActmonSample& snapshot);
+
+        // For hot loops that want to skip even the offset arithmetic.
+        volatile uint32_t* getCountAddress(uint32_t device);
+
+    private:
+        static uint32_t getDeviceOffset(uint32_t device);
+
+        PeripheralController actmon;
+        CarController clockAndReset;
+};
+
+#endif //ACTMON_CONTROLLER_H
@@ -0,0 +1,7 @@
+CXX = aarch64-none-linux-gnu-g++
+ARCH_FLAGS = -march=armv8-a
+STARTUP_DEFS = 
+CXX_FLAGS = $(ARCH_FLAGS) $(STARTUP_DEFS) -c -g -std=c++11 -Wall -W -Werror -pedantic
+
+actmonController.o: actmonController.cpp
+	$(CXX) $^ $(CXX_FLAGS) -o $@
@@ -0,0 +1,178 @@
+#include "apbDmaController.h"
+#include "../timestamp/timestamp.h"
+#include <cstdint>
+#include <cassert>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+DmaBuffer::DmaBuffer(uint32_t physicalAddress, uint32_t size) : physicalAddress(physicalAddress), size(size)
+{
+    assert((physicalAddress % apbDmaController::BYTES_PER_WORD) == 0);
+    assert(size > 0);
+
+    uint32_t pageSize = sysconf(_SC_PAGESIZE);
+    pageOffset = physicalAddress & (pageSize - 1);
+    mapSize = ((pageOffset + size + pageSize - 1)/pageSize)*pageSize;
+
+    int fileDescriptor = open("/dev/mem", O_RDWR|O_SYNC);
+    assert(fileDescriptor > 0); // can't open /dev/mem, must use in super user mode
+
+    // O_SYNC keeps the mapping uncached, the controller does not snoop the CPU caches
+    memMap = mmap(NULL, mapSize, PROT_READ|PROT_WRITE, MAP_SHARED, fileDescriptor, physicalAddress - pageOffset);
+    assert(memMap != MAP_FAILED);
+
+    close(fileDescriptor);
+}
+
+DmaBuffer::~DmaBuffer()
+{
+    munmap(memMap, mapSize);
+}
+
+volatile uint32_t* DmaBuffer::getData()
+{
+    return (volatile uint32_t*)((volatile uint8_t*)memMap + pageOffset);
+}
+
+uint32_t DmaBuffer::getPhysicalAddress()
+{
+    return physicalAddress;
+}
+
+uint32_t DmaBuffer::getSize()
+{
+    return size;
+}
+
+ApbDmaChannel::ApbDmaChannel(uint32_t channel) : dma(apbDmaController::baseAddress), channelRegisters(apbDmaController::channelBaseAddress),
+    channel(channel), channelOffset(channel*apbDmaController::CHANNEL_STRIDE)
+{
+    assert(channel < apbDmaController::NUMBER_OF_CHANNELS);
+}
+
+ApbDmaChannel::~ApbDmaChannel()
+{
+    stop();
+}
+
+void ApbDmaChannel::enableController()
+{
+    dma.setRegisterField(APBDMA_COMMAND_0::addressOffset, 1, APBDMA_COMMAND_0::GEN_bit, APBDMA_COMMAND_0::GEN_bitWidth);
+}
+
+void ApbDmaChannel::start(const ApbDmaTransfer& transfer)
+{
+    program(transfer, false);
+}
+
+bool ApbDmaChannel::isComplete()
+{
+    uint32_t status = channelRegisters.getRegister(channelOffset + APB_DMA_CHANNEL_STA_0::addressOffset);
+    return ((status >> APB_DMA_CHANNEL_STA_0::ISE_EOC_bit) & 1) != 0;
+}
+
+bool ApbDmaChannel::waitComplete(uint64_t timeoutNs)
+{
+    uint64_t deadline = Timestamp::now() + timeoutNs;
+    while(!isComplete())
+    {
+        if(Timestamp::now() > deadline)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint32_t ApbDmaChannel::getTransferredWords()
+{
+    return channelRegisters.getRegister(channelOffset + APB_DMA_CHANNEL_WORD_TRANSFER_0::addressOffset);
+}
+
+void ApbDmaChannel::startDoubleBuffered(const ApbDmaTransfer& transfer)
+{
+    nextHalf = 0;
+    missedHalves = 0;
+    program(transfer, true);
+}
+
+/*
+ * Every completed half latches ISE_EOC, and PING_PONG_STA tells which half
+ * the controller is filling now, so the one before it is the one that just
+ * finished. When that is not the half expected the caller was too slow and
+ * a whole half went by unseen.
+ */
+int32_t ApbDmaChannel::pollHalf()
+{
+    uint32_t statusOffset = channelOffset + APB_DMA_CHANNEL_STA_0::addressOffset;
+    uint32_t status = channelRegisters.getRegister(statusOffset);
+    if(((status >> APB_DMA_CHANNEL_STA_0::ISE_EOC_bit) & 1) == 0)
+    {
+        return -1;
+    }
+
+    channelRegisters.setRegister(statusOffset, 1 << APB_DMA_CHANNEL_STA_0::ISE_EOC_bit);
+
+    int32_t currentHalf = (status >> APB_DMA_CHANNEL_STA_0::PING_PONG_STA_bit) & 1;
+    int32_t completedHalf = currentHalf ^ 1;
+    if(completedHalf != nextHalf)
+    {
+        missedHalves++;
+    }
+    nextHalf = currentHalf;
+
+    return completedHalf;
+}
+
+uint64_t ApbDmaChannel::getMissedHalves()
+{
+    return missedHalves;
+}
+
+void ApbDmaChannel::stop()
+{
+    channelRegisters.setRegisterField(channelOffset + APB_DMA_CHANNEL_CSR_0::addressOffset, 0, APB_DMA_CHANNEL_CSR_0::ENB_bit, APB_DMA_CHANNEL_CSR_0::ENB_bitWidth);
+    channelRegisters.setRegister(channelOffset + APB_DMA_CHANNEL_STA_0::addressOffset, 1 << APB_DMA_CHANNEL_STA_0::ISE_EOC_bit);
+}
+
+void ApbDmaChannel::program(const ApbDmaTransfer& transfer, bool doubleBuffered)
+{
+    assert(transfer.direction <= apbDmaController::DIR_BIT_MEMORY_TO_APB);
+    assert((transfer.words > 0) && (transfer.words <= apbDmaController::MAX_WORDS));
+    assert((transfer.memoryAddress % apbDmaController::BYTES_PER_WORD) == 0);
+    assert((transfer.apbAddress % apbDmaController::BYTES_PER_WORD) == 0);
+    assert(transfer.requestSelect < (1 << APB_DMA_CHANNEL_CSR_0::REQ_SEL_bitWidth));
+
+    stop();
+
+    // Polled, keep the channel's interrupt away from the kernel's handler
+    dma.setRegister(APBDMA_IRQ_MASK_CLR_0::addressOffset, 1 << channel);
+
+    channelRegisters.setRegister(channelOffset + APB_DMA_CHANNEL_APB_PTR_0::addressOffset, transfer.apbAddress);
+    channelRegisters.setRegister(channelOffset + APB_DMA_CHANNEL_APB_SEQ_0::addressOffset,
+        (apbDmaController::BUS_WIDTH_BIT_32 << APB_DMA_CHANNEL_APB_SEQ_0::APB_BUS_WIDTH_bit) |
+        (apbDmaController::APB_ADDR_WRAP_BIT_1_WORD << APB_DMA_CHANNEL_APB_SEQ_0::APB_ADDR_WRAP_bit));
+
+    channelRegisters.setRegister(channelOffset + APB_DMA_CHANNEL_AHB_PTR_0::addressOffset, transfer.memoryAddress);
+    channelRegisters.setRegister(channelOffset + APB_DMA_CHANNEL_AHB_SEQ_0::addressOffset,
+        (1 << APB_DMA_CHANNEL_AHB_SEQ_0::INTR_ENB_bit) |
+        (apbDmaController::BUS_WIDTH_BIT_32 << APB_DMA_CHANNEL_AHB_SEQ_0::AHB_BUS_WIDTH_bit) |
+        (apbDmaController::AHB_BURST_BIT_1 << APB_DMA_CHANNEL_AHB_SEQ_0::AHB_BURST_bit) |
+        ((doubleBuffered ? 1 : 0) << APB_DMA_CHANNEL_AHB_SEQ_0::DBL_BUF_bit));
+
+    channelRegisters.setRegister(channelOffset + APB_DMA_CHANNEL_WCOUNT_0::addressOffset, transfer.words - 1);
+
+    uint32_t control = (1 << APB_DMA_CHANNEL_CSR_0::IE_EOC_bit) |
+        (transfer.direction << APB_DMA_CHANNEL_CSR_0::DIR_bit) |
+        ((doubleBuffered ? 0 : 1) << APB_DMA_CHANNEL_CSR_0::ONCE_bit) |
+        (transfer.requestSelect << APB_DMA_CHANNEL_CSR_0::REQ_SEL_bit);
+    if(transfer.requestSelect != apbDmaController::REQ_SEL_NONE)
+    {
+        control |= 1 << APB_DMA_CHANNEL_CSR_0::FLOW_bit;
+    }
+
+    // Everything else first, ENB starts the channel
+    channelRegisters.setRegister(channelOffset + APB_DMA_CHANNEL_CSR_0::addressOffset, control);
+    channelRegisters.setRegister(channelOffset + APB_DMA_CHANNEL_CSR_0::addressOffset, control | (1 << APB_DMA_CHANNEL_CSR_0::ENB_bit));
+}
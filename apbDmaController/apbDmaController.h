@@ -0,0 +1,334 @@
+/**
+ * @file apbDmaController.h
+ * @brief APB DMA controller register declaration and class declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano APB DMA controller direct register access drivers
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class ApbDmaChannel
+ * @brief One channel of the APB DMA controller, polled
+ *
+ * @section Description
+ *
+ * The APB DMA controller moves 32 bit words between a register on the APB
+ * bus (GPIO, SPI, I2C, UART, I2S FIFOs ...) and memory on the AHB side.
+ * The global registers are at 0x60020000, the 32 channels at 0x60021000,
+ * 0x40 apart.
+ *
+ * The APB side of a transfer is the physical address of the register,
+ * which normally stays fixed (a FIFO or GPIO_IN). With a requestSelect
+ * other than apbDmaController::REQ_SEL_NONE the peripheral paces the
+ * transfer one word per FIFO request. REQ_SEL_NONE runs unpaced at bus
+ * speed, for example back to back GPIO_IN samples.
+ *
+ * The memory side must be physically contiguous and its physical address
+ * known, DmaBuffer maps such a region (a carveout reserved in the device
+ * tree, or CMA memory handed out by a helper driver) through /dev/mem.
+ *
+ * start() runs one transfer and isComplete()/waitComplete() poll for the
+ * end. startDoubleBuffered() runs forever over a buffer of two halves: the
+ * controller fills one half while the other is processed, pollHalf()
+ * returns each half as it completes.
+ *
+ * The kernel owns channels used by its SPI, UART and I2C drivers, take
+ * channels from the top of the range. The controller clock must be on
+ * (CarController::bringUp(carController::APBDMA) if it is not). Interrupts
+ * of a channel are masked while it is used from here so the kernel's
+ * handler never sees them.
+ */
+
+#ifndef APB_DMA_CONTROLLER_H
+#define APB_DMA_CONTROLLER_H
+
+#include <cstdint>
+#include <cstddef>
+
+#include "../peripheralController/peripheralController.h"
+
+struct apbDmaController
+{
+    static const uint32_t baseAddress = 0x60020000;
+    static const uint32_t channelBaseAddress = 0x60021000;
+
+    static const uint32_t NUMBER_OF_CHANNELS = 32;
+    static const uint32_t CHANNEL_STRIDE = 0x40;
+
+    static const uint32_t MAX_WORDS = 0x10000;
+    static const uint32_t BYTES_PER_WORD = 4;
+
+    // APB_DMA_CHANNEL_CSR_0 REQ_SEL, which peripheral paces the channel
+    static const uint32_t REQ_SEL_NONE = 0;
+    static const uint32_t REQ_SEL_UARTA = 8;
+    static const uint32_t REQ_SEL_UARTB = 9;
+    static const uint32_t REQ_SEL_UARTC = 10;
+    static const uint32_t REQ_SEL_SPI1 = 15;
+    static const uint32_t REQ_SEL_SPI2 = 16;
+    static const uint32_t REQ_SEL_SPI3 = 17;
+    static const uint32_t REQ_SEL_SPI4 = 18;
+    static const uint32_t REQ_SEL_UARTD = 19;
+    static const uint32_t REQ_SEL_I2C1 = 21;
+    static const uint32_t REQ_SEL_I2C2 = 22;
+    static const uint32_t REQ_SEL_I2C3 = 23;
+    static const uint32_t REQ_SEL_I2C5 = 24;
+    static const uint32_t REQ_SEL_I2C4 = 26;
+    static const uint32_t REQ_SEL_I2C6 = 30;
+
+    static const uint32_t DIR_BIT_APB_TO_MEMORY = 0;
+    static const uint32_t DIR_BIT_MEMORY_TO_APB = 1;
+
+    static const uint32_t BUS_WIDTH_BIT_8 = 0;
+    static const uint32_t BUS_WIDTH_BIT_16 = 1;
+    static const uint32_t BUS_WIDTH_BIT_32 = 2;
+
+    static const uint32_t AHB_BURST_BIT_1 = 4;
+    static const uint32_t AHB_BURST_BIT_4 = 5;
+    static const uint32_t AHB_BURST_BIT_8 = 6;
+
+    static const uint32_t APB_ADDR_WRAP_BIT_NONE = 0;
+    static const uint32_t APB_ADDR_WRAP_BIT_1_WORD = 1; // fixed register address
+};
+
+// APBDMA_COMMAND_0
+struct APBDMA_COMMAND_0
+{
+    static const uint32_t addressOffset = 0x000;
+
+    static const uint32_t GEN_bit = 31;
+    static const uint32_t GEN_bitWidth = 1;
+};
+
+// APBDMA_IRQ_MASK_SET_0, write 1 to route a channel's interrupt to the CPU
+struct APBDMA_IRQ_MASK_SET_0
+{
+    static const uint32_t addressOffset = 0x020;
+};
+
+// APBDMA_IRQ_MASK_CLR_0, write 1 to stop a channel's interrupt reaching the CPU
+struct APBDMA_IRQ_MASK_CLR_0
+{
+    static const uint32_t addressOffset = 0x024;
+};
+
+// APB_DMA_CHANNEL_CSR_0, relative to the channel
+struct APB_DMA_CHANNEL_CSR_0
+{
+    static const uint32_t addressOffset = 0x00;
+
+    static const uint32_t ENB_bit = 31;
+    static const uint32_t ENB_bitWidth = 1;
+
+    static const uint32_t IE_EOC_bit = 30;
+    static const uint32_t IE_EOC_bitWidth = 1;
+
+    static const uint32_t HOLD_bit = 29;
+    static const uint32_t HOLD_bitWidth = 1;
+
+    static const uint32_t DIR_bit = 28;
+    static const uint32_t DIR_bitWidth = 1;
+
+    static const uint32_t ONCE_bit = 27;
+    static const uint32_t ONCE_bitWidth = 1;
+
+    static const uint32_t FLOW_bit = 21;
+    static const uint32_t FLOW_bitWidth = 1;
+
+    static const uint32_t REQ_SEL_bit = 16;
+    static const uint32_t REQ_SEL_bitWidth = 5;
+};
+
+// APB_DMA_CHANNEL_STA_0
+struct APB_DMA_CHANNEL_STA_0
+{
+    static const uint32_t addressOffset = 0x04;
+
+    static const uint32_t BSY_bit = 31;
+    static const uint32_t BSY_bitWidth = 1;
+
+    static const uint32_t ISE_EOC_bit = 30; // write 1 to clear
+    static const uint32_t ISE_EOC_bitWidth = 1;
+
+    static const uint32_t HALT_bit = 29;
+    static const uint32_t HALT_bitWidth = 1;
+
+    static const uint32_t PING_PONG_STA_bit = 28;
+    static const uint32_t PING_PONG_STA_bitWidth = 1;
+
+    static const uint32_t COUNT_bit = 2;
+    static const uint32_t COUNT_bitWidth = 14;
+};
+
+// APB_DMA_CHANNEL_CSRE_0
+struct APB_DMA_CHANNEL_CSRE_0
+{
+    static const uint32_t addressOffset = 0x08;
+
+    static const uint32_t PAUSE_bit = 31;
+    static const uint32_t PAUSE_bitWidth = 1;
+};
+
+// APB_DMA_CHANNEL_AHB_PTR_0, physical memory address
+struct APB_DMA_CHANNEL_AHB_PTR_0
+{
+    static const uint32_t addressOffset = 0x10;
+};
+
+// APB_DMA_CHANNEL_AHB_SEQ_0
+struct APB_DMA_CHANNEL_AHB_SEQ_0
+{
+    static const uint32_t addressOffset = 0x14;
+
+    static const uint32_t INTR_ENB_bit = 31;
+    static const uint32_t INTR_ENB_bitWidth = 1;
+
+    static const uint32_t AHB_BUS_WIDTH_bit = 28;
+    static const uint32_t AHB_BUS_WIDTH_bitWidth = 3;
+
+    static const uint32_t AHB_DATA_SWAP_bit = 27;
+    static const uint32_t AHB_DATA_SWAP_bitWidth = 1;
+
+    static const uint32_t AHB_BURST_bit = 24;
+    static const uint32_t AHB_BURST_bitWidth = 3;
+
+    static const uint32_t DBL_BUF_bit = 19;
+    static const uint32_t DBL_BUF_bitWidth = 1;
+
+    static const uint32_t AHB_ADDR_WRAP_bit = 16;
+    static const uint32_t AHB_ADDR_WRAP_bitWidth = 3;
+};
+
+// APB_DMA_CHANNEL_APB_PTR_0, physical register address
+struct APB_DMA_CHANNEL_APB_PTR_0
+{
+    static const uint32_t addressOffset = 0x18;
+};
+
+// APB_DMA_CHANNEL_APB_SEQ_0
+struct APB_DMA_CHANNEL_APB_SEQ_0
+{
+    static const uint32_t addressOffset = 0x1C;
+
+    static const uint32_t APB_BUS_WIDTH_bit = 28;
+    static const uint32_t APB_BUS_WIDTH_bitWidth = 3;
+
+    static const uint32_t APB_DATA_SWAP_bit = 27;
+    static const uint32_t APB_DATA_SWAP_bitWidth = 1;
+
+    static const uint32_t APB_ADDR_WRAP_bit = 16;
+    static const uint32_t APB_ADDR_WRAP_bitWidth = 3;
+};
+
+// APB_DMA_CHANNEL_WCOUNT_0, words per transfer - 1
+struct APB_DMA_CHANNEL_WCOUNT_0
+{
+    static const uint32_t addressOffset = 0x20;
+};
+
+// APB_DMA_CHANNEL_WORD_TRANSFER_0, words moved so far
+struct APB_DMA_CHANNEL_WORD_TRANSFER_0
+{
+    static const uint32_t addressOffset = 0x24;
+};
+
+/**
+ * A physically contiguous region mapped through /dev/mem. The region has
+ * to be reserved from the kernel, mapping memory the kernel hands out to
+ * others corrupts it.
+ */
+class DmaBuffer
+{
+    public:
+        DmaBuffer(uint32_t physicalAddress, uint32_t size);
+        ~DmaBuffer();
+
+        DmaBuffer(const DmaBuffer&) = delete;
+        DmaBuffer& operator=(const DmaBuffer&) = delete;
+
+        volatile uint32_t* getData();
+        uint32_t getPhysicalAddress();
+        uint32_t getSize();
+
+    private:
+        void* memMap = NULL;
+        uint32_t mapSize = 0;
+        uint32_t pageOffset = 0;
+        const uint32_t physicalAddress;
+        const uint32_t size;
+};
+
+struct ApbDmaTransfer
+{
+    uint32_t direction;        // apbDmaController::DIR_BIT_
+    uint32_t apbAddress;       // physical register address
+    uint32_t requestSelect;    // apbDmaController::REQ_SEL_
+    uint32_t memoryAddress;    // physical, word aligned
+    uint32_t words;
+};
+
+class ApbDmaChannel
+{
+    public:
+        ApbDmaChannel(uint32_t channel);
+        ~ApbDmaChannel();
+
+        ApbDmaChannel(const ApbDmaChannel&) = delete;
+        ApbDmaChannel& operator=(const ApbDmaChannel&) = delete;
+
+        // Sets the controller wide enable, harmless when the kernel already has.
+        void enableController();
+
+        void start(const ApbDmaTransfer& transfer);
+        bool isComplete();
+        bool waitComplete(uint64_t timeoutNs);
+        uint32_t getTransferredWords();
+
+        /*
+         * transfer.words is the size of one half, the buffer at
+         * transfer.memoryAddress holds two. Runs until stop().
+         */
+        void startDoubleBuffered(const ApbDmaTransfer& transfer);
+
+        /*
+         * Returns the half (0 or 1) the controller finished since the last
+         * call, or -1. A half that is not collected before the controller
+         * finishes the other one too is overwritten, see getMissedHalves().
+         */
+        int32_t pollHalf();
+        uint64_t getMissedHalves();
+
+        void stop();
+
+    private:
+        void program(const ApbDmaTransfer& transfer, bool doubleBuffered);
+
+        PeripheralController dma;
+        PeripheralController channelRegisters;
+        const uint32_t channel;
+        const uint32_t channelOffset;
+
+        int32_t nextHalf = 0;
+        uint64_t missedHalves = 0;
+};
+
+#endif //APB_DMA_CONTROLLER_H
@@ -0,0 +1,211 @@
+#include "carController.h"
+#include "../timestamp/timestamp.h"
+#include "../delay/delay.h"
+#include <cstdint>
+#include <cassert>
+
+static const uint32_t resetStatusOffsets[carController::NUMBER_OF_BANKS] = {
+    CLK_RST_CONTROLLER_RST_DEVICES_0::L_addressOffset, CLK_RST_CONTROLLER_RST_DEVICES_0::H_addressOffset,
+    CLK_RST_CONTROLLER_RST_DEVICES_0::U_addressOffset, CLK_RST_CONTROLLER_RST_DEVICES_0::V_addressOffset,
+    CLK_RST_CONTROLLER_RST_DEVICES_0::W_addressOffset, CLK_RST_CONTROLLER_RST_DEVICES_0::X_addressOffset,
+    CLK_RST_CONTROLLER_RST_DEVICES_0::Y_addressOffset};
+
+static const uint32_t clockStatusOffsets[carController::NUMBER_OF_BANKS] = {
+    CLK_RST_CONTROLLER_CLK_OUT_ENB_0::L_addressOffset, CLK_RST_CONTROLLER_CLK_OUT_ENB_0::H_addressOffset,
+    CLK_RST_CONTROLLER_CLK_OUT_ENB_0::U_addressOffset, CLK_RST_CONTROLLER_CLK_OUT_ENB_0::V_addressOffset,
+    CLK_RST_CONTROLLER_CLK_OUT_ENB_0::W_addressOffset, CLK_RST_CONTROLLER_CLK_OUT_ENB_0::X_addressOffset,
+    CLK_RST_CONTROLLER_CLK_OUT_ENB_0::Y_addressOffset};
+
+static const uint32_t resetSetOffsets[carController::NUMBER_OF_BANKS] = {
+    CLK_RST_CONTROLLER_RST_DEV_SET_0::L_addressOffset, CLK_RST_CONTROLLER_RST_DEV_SET_0::H_addressOffset,
+    CLK_RST_CONTROLLER_RST_DEV_SET_0::U_addressOffset, CLK_RST_CONTROLLER_RST_DEV_SET_0::V_addressOffset,
+    CLK_RST_CONTROLLER_RST_DEV_SET_0::W_addressOffset, CLK_RST_CONTROLLER_RST_DEV_SET_0::X_addressOffset,
+    CLK_RST_CONTROLLER_RST_DEV_SET_0::Y_addressOffset};
+
+static const uint32_t resetClearOffsets[carController::NUMBER_OF_BANKS] = {
+    CLK_RST_CONTROLLER_RST_DEV_CLR_0::L_addressOffset, CLK_RST_CONTROLLER_RST_DEV_CLR_0::H_addressOffset,
+    CLK_RST_CONTROLLER_RST_DEV_CLR_0::U_addressOffset, CLK_RST_CONTROLLER_RST_DEV_CLR_0::V_addressOffset,
+    CLK_RST_CONTROLLER_RST_DEV_CLR_0::W_addressOffset, CLK_RST_CONTROLLER_RST_DEV_CLR_0::X_addressOffset,
+    CLK_RST_CONTROLLER_RST_DEV_CLR_0::Y_addressOffset};
+
+static const uint32_t clockSetOffsets[carController::NUMBER_OF_BANKS] = {
+    CLK_RST_CONTROLLER_CLK_ENB_SET_0::L_addressOffset, CLK_RST_CONTROLLER_CLK_ENB_SET_0::H_addressOffset,
+    CLK_RST_CONTROLLER_CLK_ENB_SET_0::U_addressOffset, CLK_RST_CONTROLLER_CLK_ENB_SET_0::V_addressOffset,
+    CLK_RST_CONTROLLER_CLK_ENB_SET_0::W_addressOffset, CLK_RST_CONTROLLER_CLK_ENB_SET_0::X_addressOffset,
+    CLK_RST_CONTROLLER_CLK_ENB_SET_0::Y_addressOffset};
+
+static const uint32_t clockClearOffsets[carController::NUMBER_OF_BANKS] = {
+    CLK_RST_CONTROLLER_CLK_ENB_CLR_0::L_addressOffset, CLK_RST_CONTROLLER_CLK_ENB_CLR_0::H_addressOffset,
+    CLK_RST_CONTROLLER_CLK_ENB_CLR_0::U_addressOffset, CLK_RST_CONTROLLER_CLK_ENB_CLR_0::V_addressOffset,
+    CLK_RST_CONTROLLER_CLK_ENB_CLR_0::W_addressOffset, CLK_RST_CONTROLLER_CLK_ENB_CLR_0::X_addressOffset,
+    CLK_RST_CONTROLLER_CLK_ENB_CLR_0::Y_addressOffset};
+
+CarController::CarController() : car(carController::baseAddress)
+{
+}
+
+void CarController::enableClock(uint32_t device)
+{
+    car.setRegister(getBankOffset(clockSetOffsets, device), 1 << (device%carController::DEVICES_PER_BANK));
+}
+
+void CarController::disableClock(uint32_t device)
+{
+    car.setRegister(getBankOffset(clockClearOffsets, device), 1 << (device%carController::DEVICES_PER_BANK));
+}
+
+bool CarController::isClockEnabled(uint32_t device)
+{
+    return car.getRegisterField(getBankOffset(clockStatusOffsets, device), device%carController::DEVICES_PER_BANK, 1) != 0;
+}
+
+void CarController::assertReset(uint32_t device)
+{
+    car.setRegister(getBankOffset(resetSetOffsets, device), 1 << (device%carController::DEVICES_PER_BANK));
+}
+
+void CarController::deassertReset(uint32_t device)
+{
+    car.setRegister(getBankOffset(resetClearOffsets, device), 1 << (device%carController::DEVICES_PER_BANK));
+}
+
+bool CarController::isInReset(uint32_t device)
+{
+    return car.getRegisterField(getBankOffset(resetStatusOffsets, device), device%carController::DEVICES_PER_BANK, 1) != 0;
+}
+
+void CarController::pulseReset(uint32_t device)
+{
+    assertReset(device);
+    Delay::sleepUntil(Timestamp::now() + carController::RESET_PULSE_NS);
+    deassertReset(device);
+}
+
+void CarController::bringUp(uint32_t device)
+{
+    // The reset only propagates with the clock running
+    enableClock(device);
+    pulseReset(device);
+}
+
+uint32_t CarController::setClockRate(uint32_t device, uint32_t clockHz)
+{
+    return setClockRate(device, clockHz, getModuleClock(device).pllpSource, carController::PLLP_OUT0_HZ);
+}
+
+uint32_t CarController::setClockRate(uint32_t device, uint32_t clockHz, uint32_t source, uint32_t parentHz)
+{
+    const ModuleClock& moduleClock = getModuleClock(device);
+    assert(clockHz > 0);
+    assert(source < (1 << CLK_RST_CONTROLLER_CLK_SOURCE_0::CLK_SRC_bitWidth));
+
+    uint32_t divisorWidth = (moduleClock.divider == carController::DIVIDER_7_1) ?
+        CLK_RST_CONTROLLER_CLK_SOURCE_0::CLK_DIVISOR_8_bitWidth : CLK_RST_CONTROLLER_CLK_SOURCE_0::CLK_DIVISOR_16_bitWidth;
+    uint64_t maxDivisor = (1 << divisorWidth) - 1;
+    uint64_t divisor = 0;
+    uint64_t rate = 0;
+
+    // Round the divisor up so the rate never exceeds what was asked for
+    if(moduleClock.divider == carController::DIVIDER_INTEGER)
+    {
+        divisor = ((uint64_t)parentHz + clockHz - 1)/clockHz;
+        divisor = (divisor < 1) ? 0 : divisor - 1;
+        divisor = (divisor > maxDivisor) ? maxDivisor : divisor;
+        rate = parentHz/(divisor + 1);
+    }
+    else
+    {
+        divisor = ((2*(uint64_t)parentHz) + clockHz - 1)/clockHz;
+        divisor = (divisor < 2) ? 0 : divisor - 2;
+        divisor = (divisor > maxDivisor) ? maxDivisor : divisor;
+        rate = (2*(uint64_t)parentHz)/(divisor + 2);
+    }
+
+    uint32_t value = (source << CLK_RST_CONTROLLER_CLK_SOURCE_0::CLK_SRC_bit) | ((uint32_t)divisor << CLK_RST_CONTROLLER_CLK_SOURCE_0::CLK_DIVISOR_bit);
+    if(moduleClock.divider == carController::DIVIDER_UART)
+    {
+        value |= 1 << CLK_RST_CONTROLLER_CLK_SOURCE_0::UART_DIV_ENB_bit;
+    }
+    car.setRegister(moduleClock.sourceOffset, value);
+
+    return rate;
+}
+
+uint32_t CarController::getClockRate(uint32_t device, uint32_t parentHz)
+{
+    const ModuleClock& moduleClock = getModuleClock(device);
+
+    if(moduleClock.divider == carController::DIVIDER_INTEGER)
+    {
+        uint32_t divisor = car.getRegisterField(moduleClock.sourceOffset, CLK_RST_CONTROLLER_CLK_SOURCE_0::CLK_DIVISOR_bit, CLK_RST_CONTROLLER_CLK_SOURCE_0::CLK_DIVISOR_16_bitWidth);
+        return parentHz/(divisor + 1);
+    }
+
+    if((moduleClock.divider == carController::DIVIDER_UART) &&
+        (car.getRegisterField(moduleClock.sourceOffset, CLK_RST_CONTROLLER_CLK_SOURCE_0::UART_DIV_ENB_bit, CLK_RST_CONTROLLER_CLK_SOURCE_0::UART_DIV_ENB_bitWidth) == 0))
+    {
+        return parentHz;
+    }
+
+    uint32_t divisorWidth = (moduleClock.divider == carController::DIVIDER_7_1) ?
+        CLK_RST_CONTROLLER_CLK_SOURCE_0::CLK_DIVISOR_8_bitWidth : CLK_RST_CONTROLLER_CLK_SOURCE_0::CLK_DIVISOR_16_bitWidth;
+    uint32_t divisor = car.getRegisterField(moduleClock.sourceOffset, CLK_RST_CONTROLLER_CLK_SOURCE_0::CLK_DIVISOR_bit, divisorWidth);
+    return (2*(uint64_t)parentHz)/(divisor + 2);
+}
+
+uint32_t CarController::getClockSource(uint32_t device)
+{
+    const ModuleClock& moduleClock = getModuleClock(device);
+    return car.getRegisterField(moduleClock.sourceOffset, CLK_RST_CONTROLLER_CLK_SOURCE_0::CLK_SRC_bit, CLK_RST_CONTROLLER_CLK_SOURCE_0::CLK_SRC_bitWidth);
+}
+
+uint32_t CarController::getBankOffset(const uint32_t* bankOffsets, uint32_t device)
+{
+    assert((device/carController::DEVICES_PER_BANK) < carController::NUMBER_OF_BANKS);
+    return bankOffsets[device/carController::DEVICES_PER_BANK];
+}
+
+/*
+ * The module clocks with a divider this class knows how to program, and the
+ * mux input PLLP_OUT0 is on for each. The I2S clocks normally come from the
+ * audio PLL through a 7.1 divider as well.
+ */
+const CarController::ModuleClock& CarController::getModuleClock(uint32_t device)
+{
+    static const ModuleClock moduleClocks[] = {
+        {carController::UARTA, CLK_RST_CONTROLLER_CLK_SOURCE_0::UARTA_addressOffset, carController::DIVIDER_UART, carController::CLK_SRC_BIT_PLLP_OUT0},
+        {carController::UARTB, CLK_RST_CONTROLLER_CLK_SOURCE_0::UARTB_addressOffset, carController::DIVIDER_UART, carController::CLK_SRC_BIT_PLLP_OUT0},
+        {carController::UARTC, CLK_RST_CONTROLLER_CLK_SOURCE_0::UARTC_addressOffset, carController::DIVIDER_UART, carController::CLK_SRC_BIT_PLLP_OUT0},
+        {carController::UARTD, CLK_RST_CONTROLLER_CLK_SOURCE_0::UARTD_addressOffset, carController::DIVIDER_UART, carController::CLK_SRC_BIT_PLLP_OUT0},
+        {carController::I2C1, CLK_RST_CONTROLLER_CLK_SOURCE_0::I2C1_addressOffset, carController::DIVIDER_INTEGER, carController::CLK_SRC_BIT_PLLP_OUT0},
+        {carController::I2C2, CLK_RST_CONTROLLER_CLK_SOURCE_0::I2C2_addressOffset, carController::DIVIDER_INTEGER, carController::CLK_SRC_BIT_PLLP_OUT0},
+        {carController::I2C3, CLK_RST_CONTROLLER_CLK_SOURCE_0::I2C3_addressOffset, carController::DIVIDER_INTEGER, carController::CLK_SRC_BIT_PLLP_OUT0},
+        {carController::I2C4, CLK_RST_CONTROLLER_CLK_SOURCE_0::I2C4_addressOffset, carController::DIVIDER_INTEGER, carController::CLK_SRC_BIT_PLLP_OUT0},
+        {carController::I2C5, CLK_RST_CONTROLLER_CLK_SOURCE_0::I2C5_addressOffset, carController::DIVIDER_INTEGER, carController::CLK_SRC_BIT_PLLP_OUT0},
+        {carController::I2C6, CLK_RST_CONTROLLER_CLK_SOURCE_0::I2C6_addressOffset, carController::DIVIDER_INTEGER, carController::CLK_SRC_BIT_PLLP_OUT0},
+        {carController::SBC1, CLK_RST_CONTROLLER_CLK_SOURCE_0::SBC1_addressOffset, carController::DIVIDER_7_1, carController::CLK_SRC_BIT_PLLP_OUT0},
+        {carController::SBC2, CLK_RST_CONTROLLER_CLK_SOURCE_0::SBC2_addressOffset, carController::DIVIDER_7_1, carController::CLK_SRC_BIT_PLLP_OUT0},
+        {carController::SBC3, CLK_RST_CONTROLLER_CLK_SOURCE_0::SBC3_addressOffset, carController::DIVIDER_7_1, carController::CLK_SRC_BIT_PLLP_OUT0},
+        {carController::SBC4, CLK_RST_CONTROLLER_CLK_SOURCE_0::SBC4_addressOffset, carController::DIVIDER_7_1, carController::CLK_SRC_BIT_PLLP_OUT0},
+        {carController::PWM, CLK_RST_CONTROLLER_CLK_SOURCE_0::PWM_addressOffset, carController::DIVIDER_7_1, carController::CLK_SRC_BIT_PLLP_OUT0},
+        {carController::QSPI, CLK_RST_CONTROLLER_CLK_SOURCE_0::QSPI_addressOffset, carController::DIVIDER_7_1, carController::CLK_SRC_BIT_PLLP_OUT0},
+        {carController::I2S0, CLK_RST_CONTROLLER_CLK_SOURCE_0::I2S0_addressOffset, carController::DIVIDER_7_1, carController::CLK_SRC_BIT_PLLP_OUT0_I2S},
+        {carController::I2S1, CLK_RST_CONTROLLER_CLK_SOURCE_0::I2S1_addressOffset, carController::DIVIDER_7_1, carController::CLK_SRC_BIT_PLLP_OUT0_I2S},
+        {carController::I2S2, CLK_RST_CONTROLLER_CLK_SOURCE_0::I2S2_addressOffset, carController::DIVIDER_7_1, carController::CLK_SRC_BIT_PLLP_OUT0_I2S},
+        {carController::I2S3, CLK_RST_CONTROLLER_CLK_SOURCE_0::I2S3_addressOffset, carController::DIVIDER_7_1, carController::CLK_SRC_BIT_PLLP_OUT0_I2S},
+        {carController::I2S4, CLK_RST_CONTROLLER_CLK_SOURCE_0::I2S4_addressOffset, carController::DIVIDER_7_1, carController::CLK_SRC_BIT_PLLP_OUT0_I2S},
+        {carController::ACTMON, CLK_RST_CONTROLLER_CLK_SOURCE_0::ACTMON_addressOffset, carController::DIVIDER_7_1, carController::CLK_SRC_BIT_PLLP_OUT0},
+        {carController::SOC_THERM, CLK_RST_CONTROLLER_CLK_SOURCE_0::SOC_THERM_addressOffset, carController::DIVIDER_7_1, carController::CLK_SRC_BIT_PLLP_OUT0_SOC_THERM},
+    };
+
+    for(uint32_t i = 0; i < (sizeof(moduleClocks)/sizeof(moduleClocks[0])); i++)
+    {
+        if(moduleClocks[i].device == device)
+        {
+            return moduleClocks[i];
+        }
+    }
+
+    assert(!"device has no module clock divider");
+    return moduleClocks[0];
+}
@@ -0,0 +1,279 @@
+/**
+ * @file carController.h
+ * @brief clock and reset controller register declaration and class declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano clock and reset controller direct register access drivers
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class CarController
+ * @brief Jetson clock and reset controller, peripheral clock gates, resets and rates
+ *
+ * @section Description
+ *
+ * The CAR at 0x60006000 gates every peripheral clock, holds every
+ * peripheral reset, and divides each peripheral's module clock down from
+ * one of the PLLs.
+ *
+ * Peripherals are named by their CAR device number (carController::SBC1,
+ * carController::I2C1 ...), the same numbers the kernel's tegra210-car
+ * device tree binding uses. Device n lives at bit n%32 of register bank
+ * n/32, banks L, H, U, V, W, X and Y. Every bank has a status register
+ * plus write only SET and CLR registers for the clock enables and for the
+ * resets, so enabling one clock is a single store that cannot race the
+ * kernel changing another bit of the same bank.
+ *
+ * Every peripheral with a module clock has a CLK_SOURCE register choosing
+ * the parent in bits 31:29 and a divider in the low bits. The divider comes
+ * in three flavours:
+ * ___________________________________________________________________
+ * Divider  | Peripherals     | Rate
+ * 7.1      | SBCn, PWM, QSPI | parent*2/(CLK_DIVISOR + 2), 8 bit field
+ * UART     | UARTA - UARTD   | parent*2/(CLK_DIVISOR + 2), 16 bit field, UART_DIV_ENB set
+ * integer  | I2Cn            | parent/(CLK_DIVISOR + 1), 16 bit field
+ *
+ * PLLP_OUT0 (408 MHz) is the parent setClockRate() uses unless told
+ * otherwise. It is mux input 0 for the UART, I2C, SBC, PWM, QSPI and ACTMON
+ * clocks but input 4 for I2S0 - I2S4 and SOC_THERM, each device's input is
+ * kept with its divider. The kernel's clock framework does not know about
+ * changes made here, it may later gate or re-rate a clock it thinks it owns,
+ * for example when a driver suspends.
+ */
+
+#ifndef CAR_CONTROLLER_H
+#define CAR_CONTROLLER_H
+
+#include <cstdint>
+
+#include "../peripheralController/peripheralController.h"
+
+struct carController
+{
+    static const uint32_t baseAddress = 0x60006000;
+
+    // CAR device numbers, bank n/32, bit n%32
+    static const uint32_t UARTA = 6;
+    static const uint32_t UARTB = 7;
+    static const uint32_t I2S1 = 11;
+    static const uint32_t I2C1 = 12;
+    static const uint32_t PWM = 17;
+    static const uint32_t I2S2 = 18;
+    static const uint32_t I2S0 = 30;
+    static const uint32_t APBDMA = 34;
+    static const uint32_t SBC1 = 41;
+    static const uint32_t SBC2 = 44;
+    static const uint32_t SBC3 = 46;
+    static const uint32_t I2C5 = 47;
+    static const uint32_t I2C2 = 54;
+    static const uint32_t UARTC = 55;
+    static const uint32_t UARTD = 65;
+    static const uint32_t I2C3 = 67;
+    static const uint32_t SBC4 = 68;
+    static const uint32_t SOC_THERM = 78;
+    static const uint32_t I2S3 = 101;
+    static const uint32_t I2S4 = 102;
+    static const uint32_t I2C4 = 103;
+    static const uint32_t ACTMON = 119;
+    static const uint32_t I2C6 = 166;
+    static const uint32_t QSPI = 211;
+
+    static const uint32_t NUMBER_OF_BANKS = 7;
+    static const uint32_t DEVICES_PER_BANK = 32;
+
+    // PLLP_OUT0's input on the CLK_SRC mux, which differs between peripherals
+    static const uint32_t CLK_SRC_BIT_PLLP_OUT0 = 0;
+    static const uint32_t CLK_SRC_BIT_PLLP_OUT0_I2S = 4;
+    static const uint32_t CLK_SRC_BIT_PLLP_OUT0_SOC_THERM = 4;
+    static const uint32_t PLLP_OUT0_HZ = 408000000;
+
+    static const uint32_t DIVIDER_NONE = 0;
+    static const uint32_t DIVIDER_7_1 = 1;
+    static const uint32_t DIVIDER_UART = 2;
+    static const uint32_t DIVIDER_INTEGER = 3;
+
+    static const uint32_t RESET_PULSE_NS = 2000;
+};
+
+// CLK_RST_CONTROLLER_RST_DEVICES_x_0, 1 holds the device in reset
+struct CLK_RST_CONTROLLER_RST_DEVICES_0
+{
+    static const uint32_t L_addressOffset = 0x004;
+    static const uint32_t H_addressOffset = 0x008;
+    static const uint32_t U_addressOffset = 0x00C;
+    static const uint32_t V_addressOffset = 0x358;
+    static const uint32_t W_addressOffset = 0x35C;
+    static const uint32_t X_addressOffset = 0x28C;
+    static const uint32_t Y_addressOffset = 0x2A4;
+};
+
+// CLK_RST_CONTROLLER_CLK_OUT_ENB_x_0, 1 runs the device clock
+struct CLK_RST_CONTROLLER_CLK_OUT_ENB_0
+{
+    static const uint32_t L_addressOffset = 0x010;
+    static const uint32_t H_addressOffset = 0x014;
+    static const uint32_t U_addressOffset = 0x018;
+    static const uint32_t V_addressOffset = 0x360;
+    static const uint32_t W_addressOffset = 0x364;
+    static const uint32_t X_addressOffset = 0x280;
+    static const uint32_t Y_addressOffset = 0x298;
+};
+
+// CLK_RST_CONTROLLER_RST_DEV_x_SET_0, write 1 to put a device in reset
+struct CLK_RST_CONTROLLER_RST_DEV_SET_0
+{
+    static const uint32_t L_addressOffset = 0x300;
+    static const uint32_t H_addressOffset = 0x308;
+    static const uint32_t U_addressOffset = 0x310;
+    static const uint32_t V_addressOffset = 0x430;
+    static const uint32_t W_addressOffset = 0x438;
+    static const uint32_t X_addressOffset = 0x290;
+    static const uint32_t Y_addressOffset = 0x2A8;
+};
+
+// CLK_RST_CONTROLLER_RST_DEV_x_CLR_0, write 1 to take a device out of reset
+struct CLK_RST_CONTROLLER_RST_DEV_CLR_0
+{
+    static const uint32_t L_addressOffset = 0x304;
+    static const uint32_t H_addressOffset = 0x30C;
+    static const uint32_t U_addressOffset = 0x314;
+    static const uint32_t V_addressOffset = 0x434;
+    static const uint32_t W_addressOffset = 0x43C;
+    static const uint32_t X_addressOffset = 0x294;
+    static const uint32_t Y_addressOffset = 0x2AC;
+};
+
+// CLK_RST_CONTROLLER_CLK_ENB_x_SET_0, write 1 to start a device clock
+struct CLK_RST_CONTROLLER_CLK_ENB_SET_0
+{
+    static const uint32_t L_addressOffset = 0x320;
+    static const uint32_t H_addressOffset = 0x328;
+    static const uint32_t U_addressOffset = 0x330;
+    static const uint32_t V_addressOffset = 0x440;
+    static const uint32_t W_addressOffset = 0x448;
+    static const uint32_t X_addressOffset = 0x284;
+    static const uint32_t Y_addressOffset = 0x29C;
+};
+
+// CLK_RST_CONTROLLER_CLK_ENB_x_CLR_0, write 1 to stop a device clock
+struct CLK_RST_CONTROLLER_CLK_ENB_CLR_0
+{
+    static const uint32_t L_addressOffset = 0x324;
+    static const uint32_t H_addressOffset = 0x32C;
+    static const uint32_t U_addressOffset = 0x334;
+    static const uint32_t V_addressOffset = 0x444;
+    static const uint32_t W_addressOffset = 0x44C;
+    static const uint32_t X_addressOffset = 0x288;
+    static const uint32_t Y_addressOffset = 0x2A0;
+};
+
+// CLK_RST_CONTROLLER_CLK_SOURCE_x_0, one register per module clock
+struct CLK_RST_CONTROLLER_CLK_SOURCE_0
+{
+    static const uint32_t I2S1_addressOffset = 0x100;
+    static const uint32_t I2S2_addressOffset = 0x104;
+    static const uint32_t PWM_addressOffset = 0x110;
+    static const uint32_t SBC2_addressOffset = 0x118;
+    static const uint32_t SBC3_addressOffset = 0x11C;
+    static const uint32_t I2C1_addressOffset = 0x124;
+    static const uint32_t I2C5_addressOffset = 0x128;
+    static const uint32_t SBC1_addressOffset = 0x134;
+    static const uint32_t UARTA_addressOffset = 0x178;
+    static const uint32_t UARTB_addressOffset = 0x17C;
+    static const uint32_t I2C2_addressOffset = 0x198;
+    static const uint32_t UARTC_addressOffset = 0x1A0;
+    static const uint32_t SBC4_addressOffset = 0x1B4;
+    static const uint32_t I2C3_addressOffset = 0x1B8;
+    static const uint32_t UARTD_addressOffset = 0x1C0;
+    static const uint32_t I2S0_addressOffset = 0x1D8;
+    static const uint32_t I2S3_addressOffset = 0x3BC;
+    static const uint32_t I2S4_addressOffset = 0x3C0;
+    static const uint32_t I2C4_addressOffset = 0x3C4;
+    static const uint32_t ACTMON_addressOffset = 0x3E8;
+    static const uint32_t SOC_THERM_addressOffset = 0x644;
+    static const uint32_t I2C6_addressOffset = 0x65C;
+    static const uint32_t QSPI_addressOffset = 0x6C4;
+
+    static const uint32_t CLK_SRC_bit = 29;
+    static const uint32_t CLK_SRC_bitWidth = 3;
+
+    static const uint32_t UART_DIV_ENB_bit = 24;
+    static const uint32_t UART_DIV_ENB_bitWidth = 1;
+
+    static const uint32_t CLK_DIVISOR_bit = 0;
+    static const uint32_t CLK_DIVISOR_8_bitWidth = 8;
+    static const uint32_t CLK_DIVISOR_16_bitWidth = 16;
+};
+
+class CarController
+{
+    public:
+        CarController();
+
+        CarController(const CarController&) = delete;
+        CarController& operator=(const CarController&) = delete;
+
+        // device is a carController:: device number
+        void enableClock(uint32_t device);
+        void disableClock(uint32_t device);
+        bool isClockEnabled(uint32_t device);
+
+        void assertReset(uint32_t device);
+        void deassertReset(uint32_t device);
+        bool isInReset(uint32_t device);
+
+        // Holds reset for carController::RESET_PULSE_NS with the clock running.
+        void pulseReset(uint32_t device);
+
+        // Clock on and a clean reset, the order the kernel brings a device up in.
+        void bringUp(uint32_t device);
+
+        /*
+         * Picks the divider giving the fastest rate not above clockHz from
+         * PLLP_OUT0, on whichever mux input PLLP_OUT0 is for device. Returns
+         * the module clock rate actually produced.
+         */
+        uint32_t setClockRate(uint32_t device, uint32_t clockHz);
+        // The same from parent source, parentHz being that parent's rate.
+        uint32_t setClockRate(uint32_t device, uint32_t clockHz, uint32_t source, uint32_t parentHz);
+
+        // Module clock rate from the divider, given the rate of the selected parent.
+        uint32_t getClockRate(uint32_t device, uint32_t parentHz = carController::PLLP_OUT0_HZ);
+        uint32_t getClockSource(uint32_t device);
+
+    private:
+        struct ModuleClock
+        {
+            uint32_t device;
+            uint32_t sourceOffset;
+            uint32_t divider;
+            uint32_t pllpSource; // CLK_SRC value selecting PLLP_OUT0
+        };
+
+        static uint32_t getBankOffset(const uint32_t* bankOffsets, uint32_t device);
+        static const ModuleClock& getModuleClock(uint32_t device);
+
+        PeripheralController car;
+};
+
+#endif //CAR_CONTROLLER_H
@@ -0,0 +1,105 @@
+#include "delay.h"
+#include <cstdint>
+#include <algorithm>
+#include <cassert>
+#include <time.h>
+
+static const uint32_t COUNTER_READ_SAMPLES = 10000;
+static const uint32_t MMIO_SAMPLES = 1000;
+static const uint32_t SPIN_CALIBRATION_RUNS = 5;
+static const uint64_t SPIN_CALIBRATION_NS = 1000000;
+
+Delay::Delay()
+{
+    calibrate();
+}
+
+void Delay::calibrate()
+{
+    calibration.counterFrequencyHz = Timestamp::getCounterFrequency();
+    calibration.counterResolutionNs = (1000000000ull + calibration.counterFrequencyHz - 1)/calibration.counterFrequencyHz;
+    calibration.mmioAccessNs = 0;
+    calibration.counterReadNs = 0;
+    calibration.shortDelayThresholdNs = 0;
+
+    uint64_t start = Timestamp::now();
+    for(uint32_t i = 0; i < COUNTER_READ_SAMPLES; i++)
+    {
+        Timestamp::now();
+    }
+    calibration.counterReadNs = (Timestamp::now() - start)/COUNTER_READ_SAMPLES;
+
+    // Grow the run until it spans the calibration time, then keep the fastest
+    // of several runs, the slower ones were interrupted
+    uint64_t iterations = 1000;
+    uint64_t elapsed = 0;
+    for(;;)
+    {
+        start = Timestamp::now();
+        spin(iterations);
+        elapsed = Timestamp::now() - start;
+        if(elapsed >= SPIN_CALIBRATION_NS)
+        {
+            break;
+        }
+        iterations *= 2;
+    }
+
+    for(uint32_t run = 1; run < SPIN_CALIBRATION_RUNS; run++)
+    {
+        start = Timestamp::now();
+        spin(iterations);
+        elapsed = std::min(elapsed, Timestamp::now() - start);
+    }
+
+    assert(elapsed > 0);
+    spinIterationsPerNsQ16 = (iterations << 16)/elapsed;
+    calibration.spinIterationsPerMs = (iterations*1000000ull)/elapsed;
+
+    // Below two counter ticks polling cannot resolve the delay
+    calibration.shortDelayThresholdNs = (2*calibration.counterResolutionNs) + calibration.counterReadNs;
+}
+
+uint32_t Delay::calibrateMmio(volatile uint32_t* registerAddress, uint32_t harmlessValue)
+{
+    assert(registerAddress != NULL);
+
+    uint64_t start = Timestamp::now();
+    for(uint32_t i = 0; i < MMIO_SAMPLES; i++)
+    {
+        *registerAddress = harmlessValue;
+    }
+    calibration.mmioAccessNs = (Timestamp::now() - start)/MMIO_SAMPLES;
+
+    return calibration.mmioAccessNs;
+}
+
+DelayCalibration Delay::getCalibration()
+{
+    return calibration;
+}
+
+void Delay::spin(uint64_t iterations)
+{
+    for(volatile uint64_t i = 0; i < iterations; i++)
+    {
+    }
+}
+
+void Delay::sleepUntil(uint64_t deadlineNs, uint32_t spinWindowNs)
+{
+    uint64_t currentTime = Timestamp::now();
+    if((currentTime + spinWindowNs) < deadlineNs)
+    {
+        // The counter has its own epoch, so sleep for a duration rather than to a CLOCK_MONOTONIC time
+        uint64_t sleepNs = deadlineNs - spinWindowNs - currentTime;
+        timespec sleepTime;
+        sleepTime.tv_sec = sleepNs/1000000000ull;
+        sleepTime.tv_nsec = sleepNs%1000000000ull;
+        clock_nanosleep(CLOCK_MONOTONIC, 0, &sleepTime, NULL);
+    }
+
+    while(Timestamp::now() < deadlineNs)
+    {
+    }
+}
@@ -0,0 +1,143 @@
+/**
+ * @file delay.h
+ * @brief calibrated busy-wait delay class declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano calibrated busy-wait delays
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class Delay
+ * @brief Sub-microsecond busy-wait delays for bit banged protocols
+ *
+ * @section Description
+ *
+ * usleep and nanosleep go through the scheduler and wake tens of
+ * microseconds late. These delays spin instead.
+ *
+ * Time comes from Timestamp::now(), which reads the ARM generic timer
+ * without a system call. On the Nano it runs at 19.2 MHz, so it resolves
+ * about 52 ns. Delays shorter than two counter ticks are done with a spin
+ * loop calibrated against the counter, longer ones poll the counter.
+ *
+ * waitUntil and waitNext stop early by the measured cost of one register
+ * store (see calibrateMmio), so the store that follows the wait lands on
+ * the deadline. Chaining deadlines with waitNext keeps a bit stream from
+ * drifting by the time spent between waits:
+ *
+ *     uint64_t deadline = Timestamp::now();
+ *     for(...)
+ *     {
+ *         deadline = delay.waitNext(deadline, halfBitNs);
+ *         *mskOut = value;
+ *     }
+ *
+ * Deadlines are on the Timestamp::now() time base.
+ */
+
+#ifndef DELAY_H
+#define DELAY_H
+
+#include <cstdint>
+
+#include "../timestamp/timestamp.h"
+
+struct DelayCalibration
+{
+    uint64_t counterFrequencyHz;
+    uint32_t counterResolutionNs;
+    uint32_t counterReadNs;         // cost of one Timestamp::now()
+    uint64_t spinIterationsPerMs;
+    uint32_t shortDelayThresholdNs; // delays below this use the spin loop
+    uint32_t mmioAccessNs;          // 0 until calibrateMmio
+};
+
+class Delay
+{
+    public:
+        // Calibrates on construction, which takes a few milliseconds.
+        Delay();
+
+        void calibrate();
+
+        /*
+         * Measures the average cost of storing harmlessValue to
+         * registerAddress, for example 0 to a GPIO_MSK_OUT register, and
+         * compensates waitUntil and waitNext by it.
+         */
+        uint32_t calibrateMmio(volatile uint32_t* registerAddress, uint32_t harmlessValue);
+
+        DelayCalibration getCalibration();
+
+        inline void delayNs(uint32_t ns);
+        inline void waitUntil(uint64_t deadlineNs);
+
+        // Waits for previousDeadlineNs + intervalNs and returns that deadline.
+        inline uint64_t waitNext(uint64_t previousDeadlineNs, uint32_t intervalNs);
+
+        static void spin(uint64_t iterations);
+
+        /*
+         * For deadlines further out than a busy-wait is worth: sleeps until
+         * spinWindowNs before the deadline, which costs no cpu but wakes
+         * late by the scheduler latency, then spins the rest of the way.
+         */
+        static void sleepUntil(uint64_t deadlineNs, uint32_t spinWindowNs = DEFAULT_SPIN_WINDOW_NS);
+
+        static const uint32_t DEFAULT_SPIN_WINDOW_NS = 50000;
+
+    private:
+        uint64_t spinIterationsPerNsQ16;
+        DelayCalibration calibration;
+};
+
+inline void Delay::delayNs(uint32_t ns)
+{
+    if(ns < calibration.shortDelayThresholdNs)
+    {
+        spin(((uint64_t)ns*spinIterationsPerNsQ16) >> 16);
+        return;
+    }
+
+    uint64_t deadline = Timestamp::now() + ns - calibration.counterReadNs;
+    while(Timestamp::now() < deadline)
+    {
+    }
+}
+
+inline void Delay::waitUntil(uint64_t deadlineNs)
+{
+    uint64_t issueTime = deadlineNs - calibration.mmioAccessNs;
+    while(Timestamp::now() < issueTime)
+    {
+    }
+}
+
+inline uint64_t Delay::waitNext(uint64_t previousDeadlineNs, uint32_t intervalNs)
+{
+    uint64_t deadline = previousDeadlineNs + intervalNs;
+    waitUntil(deadline);
+    return deadline;
+}
+
+#endif //DELAY_H
@@ -0,0 +1,99 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "../../peripheralController/peripheralController.h"
+#include "../../gpioController/gpio.h"
+#include "../../gpioController/gpioPin.h"
+#include "../../timestamp/timestamp.h"
+#include "../../delay/delay.h"
+
+static const uint32_t SAMPLES = 10000;
+static const int64_t BIN_WIDTH_NS = 50;
+static const int64_t FIRST_BIN_NS = -200;
+static const uint32_t NUMBER_OF_BINS = 24;
+static const uint32_t BAR_WIDTH = 50;
+
+static void printHistogram(const std::vector<int64_t>& errors)
+{
+    std::vector<uint32_t> bins(NUMBER_OF_BINS + 2, 0); // plus underflow and overflow
+    for(uint32_t i = 0; i < errors.size(); i++)
+    {
+        int64_t bin = (errors[i] - FIRST_BIN_NS)/BIN_WIDTH_NS;
+        if(errors[i] < FIRST_BIN_NS)
+        {
+            bins[0]++;
+        }
+        else if(bin >= NUMBER_OF_BINS)
+        {
+            bins[NUMBER_OF_BINS + 1]++;
+        }
+        else
+        {
+            bins[bin + 1]++;
+        }
+    }
+
+    uint32_t largest = *std::max_element(bins.begin(), bins.end());
+    for(uint32_t i = 0; i < bins.size(); i++)
+    {
+        if(bins[i] == 0)
+        {
+            continue;
+        }
+
+        if(i == 0)
+        {
+            std::cout << "      < " << std::setw(6) << FIRST_BIN_NS << " ns ";
+        }
+        else if(i == NUMBER_OF_BINS + 1)
+        {
+            std::cout << "     >= " << std::setw(6) << FIRST_BIN_NS + (NUMBER_OF_BINS*BIN_WIDTH_NS) << " ns ";
+        }
+        else
+        {
+            std::cout << "  " << std::setw(6) << FIRST_BIN_NS + ((i - 1)*BIN_WIDTH_NS) << " .. " << std::setw(6) << FIRST_BIN_NS + (i*BIN_WIDTH_NS) << " ";
+        }
+        std::cout << std::setw(6) << bins[i] << " " << std::string((bins[i]*BAR_WIDTH + largest - 1)/largest, '#') << std::endl;
+    }
+}
+
+int main()
+{
+    PeripheralController myGpioController(gpioController::gpioController1BaseAddress);
+
+    Delay delay;
+    // An empty mask writes nothing, the store costs the same as a real one
+    delay.calibrateMmio(myGpioController.getRegisterAddress(gpioPortOffset(gpioPort::PB, GPIO_MSK_OUT_0::addressOffset)), 0);
+
+    DelayCalibration calibration = delay.getCalibration();
+    std::cout << "calibration" << std::endl;
+    std::cout << "  counter frequency     : " << calibration.counterFrequencyHz << " Hz" << std::endl;
+    std::cout << "  counter resolution    : " << calibration.counterResolutionNs << " ns" << std::endl;
+    std::cout << "  counter read          : " << calibration.counterReadNs << " ns" << std::endl;
+    std::cout << "  spin loop             : " << calibration.spinIterationsPerMs << " iterations/ms" << std::endl;
+    std::cout << "  spin loop below       : " << calibration.shortDelayThresholdNs << " ns" << std::endl;
+    std::cout << "  GPIO_MSK_OUT store    : " << calibration.mmioAccessNs << " ns" << std::endl;
+
+    const uint32_t requestedNs[] = {50, 100, 250, 500, 1000, 5000};
+    for(uint32_t request = 0; request < sizeof(requestedNs)/sizeof(requestedNs[0]); request++)
+    {
+        std::vector<int64_t> errors(SAMPLES);
+        for(uint32_t i = 0; i < SAMPLES; i++)
+        {
+            uint64_t start = Timestamp::now();
+            delay.delayNs(requestedNs[request]);
+            errors[i] = (int64_t)(Timestamp::now() - start) - requestedNs[request];
+        }
+
+        std::vector<int64_t> sorted(errors);
+        std::sort(sorted.begin(), sorted.end());
+        std::cout << std::endl << "delayNs(" << requestedNs[request] << ") error: min " << sorted.front() << " ns, median "
+            << sorted[SAMPLES/2] << " ns, p99 " << sorted[(SAMPLES*99)/100] << " ns, max " << sorted.back() << " ns" << std::endl;
+        printHistogram(errors);
+    }
+
+    return 0;
+}
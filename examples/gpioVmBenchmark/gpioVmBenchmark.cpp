@@ -0,0 +1,71 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cassert>
+#include <time.h>
+
+#include "../../peripheralController/peripheralController.h"
+#include "../../gpioController/gpio.h"
+#include "../../gpioController/gpioPin.h"
+#include "../../pinmuxController/pinmuxController.h"
+#include "../../gpioVm/gpioVm.h"
+
+static const uint32_t TOGGLES = 1000000;
+
+static double now()
+{
+    timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + (time.tv_nsec/1e9);
+}
+
+int main()
+{
+    PeripheralController myGpioController(gpioController::gpioController1BaseAddress);
+    PeripheralController myPinMuxController(pinmuxController::baseAddress);
+
+    // Header pin #13, SPI1_SCK, GPIO Port PB.06, same bring up as blinky
+    myPinMuxController.setRegisterField(PINMUX_AUX_SPI2_SCK_0::addressOffset, 0, PINMUX_AUX_SPI2_SCK_0::TRISTATE_bit, PINMUX_AUX_SPI2_SCK_0::TRISTATE_bitWidth);
+    myGpioController.setRegisterField(GPIO_CNF_1_RMW::addressOffset, gpioController::LOCK_BIT_DISABLE, GPIO_CNF_1_RMW::LOCK_6_baseBit, GPIO_CNF_1_RMW::LOCK_6_bitWidth);
+    myGpioController.setRegisterField(GPIO_CNF_1_RMW::addressOffset, gpioController::BIT_N_GPIO, GPIO_CNF_1_RMW::BIT_6_baseBit, GPIO_CNF_1_RMW::BIT_6_bitWidth);
+    myGpioController.setRegisterField(GPIO_OE_1_RMW::addressOffset, gpioController::BIT_N_DRIVEN, GPIO_OE_1_RMW::BIT_6_baseBit, GPIO_OE_1_RMW::BIT_6_bitWidth);
+
+    // Hand written: the same two masked stores the VM resolves SET/CLEAR to
+    volatile uint32_t* mskOut = myGpioController.getRegisterAddress(gpioPortOffset(gpioPort::PB, GPIO_MSK_OUT_0::addressOffset));
+    uint32_t high = gpioMaskedValue(1 << 6, 1 << 6);
+    uint32_t low = gpioMaskedValue(1 << 6, 0);
+
+    double start = now();
+    for(uint32_t i = 0; i < TOGGLES; i++)
+    {
+        *mskOut = high;
+        *mskOut = low;
+    }
+    double directSeconds = now() - start;
+
+    // Same sequence through the interpreter
+    std::vector<uint32_t> bytecode;
+    std::string errorMessage;
+    bool assembled = GpioVm::assemble("loop 1000000\n set PB.06\n clear PB.06\nendloop\n", bytecode, errorMessage);
+    assert(assembled);
+    (void)assembled;
+
+    GpioVm vm;
+    bool loaded = vm.load(bytecode, errorMessage);
+    assert(loaded);
+    (void)loaded;
+
+    start = now();
+    vm.run();
+    double vmSeconds = now() - start;
+
+    // Pin operations only, the loop bookkeeping is overhead charged to the VM
+    double directOps = (2.0*TOGGLES)/directSeconds;
+    double vmOps = (2.0*TOGGLES)/vmSeconds;
+
+    std::cout << "direct C++ : " << directOps << " pin ops/s" << std::endl;
+    std::cout << "gpioVm     : " << vmOps << " pin ops/s (" << vm.getInstructionsExecuted() << " instructions)" << std::endl;
+    std::cout << "slowdown   : " << (directOps/vmOps) << "x" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstring>
+
+#include "../../pinConfig/pinConfig.h"
+#include "../../timestamp/timestamp.h"
+
+static int usage()
+{
+    std::cerr << "usage: pinConfig compile <config.ini> <image.bin>" << std::endl;
+    std::cerr << "       pinConfig apply <image.bin>" << std::endl;
+    return 1;
+}
+
+static int compile(const char* iniPath, const char* imagePath)
+{
+    std::ifstream input(iniPath);
+    if(!input)
+    {
+        std::cerr << "cannot open " << iniPath << std::endl;
+        return 1;
+    }
+    std::stringstream text;
+    text << input.rdbuf();
+
+    std::vector<uint8_t> image;
+    std::string errorMessage;
+    if(!PinConfigCompiler::compile(text.str(), image, errorMessage))
+    {
+        std::cerr << iniPath << ": " << errorMessage << std::endl;
+        return 1;
+    }
+
+    std::ofstream output(imagePath, std::ios::binary);
+    output.write((const char*)image.data(), image.size());
+    if(!output)
+    {
+        std::cerr << "cannot write " << imagePath << std::endl;
+        return 1;
+    }
+
+    std::cout << "wrote " << image.size() << " bytes to " << imagePath << std::endl;
+    return 0;
+}
+
+static int apply(const char* imagePath)
+{
+    std::ifstream input(imagePath, std::ios::binary);
+    if(!input)
+    {
+        std::cerr << "cannot open " << imagePath << std::endl;
+        return 1;
+    }
+    std::vector<uint8_t> image((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+    PinConfigApplier applier;
+    if(!applier.load(image))
+    {
+        std::cerr << imagePath << " is not a valid pin configuration image" << std::endl;
+        return 1;
+    }
+
+    uint64_t start = Timestamp::now();
+    uint32_t stores = applier.apply();
+    uint64_t elapsedNs = Timestamp::now() - start;
+
+    std::cout << applier.getNumberOfRecords() << " records, " << stores << " stores in " << elapsedNs << " ns" << std::endl;
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    if((argc == 4) && (strcmp(argv[1], "compile") == 0))
+    {
+        return compile(argv[2], argv[3]);
+    }
+    if((argc == 3) && (strcmp(argv[1], "apply") == 0))
+    {
+        return apply(argv[2]);
+    }
+    return usage();
+}
@@ -0,0 +1,52 @@
+#include <iostream>
+#include <vector>
+
+#include "../../headerPinController/headerPinController.h"
+#include "../../pinProfileController/pinProfileController.h"
+#include "../../timestamp/timestamp.h"
+
+static const uint32_t SWITCHES = 100000;
+
+int main()
+{
+    // SPI1 on header pins 19 (MOSI), 21 (MISO), 23 (SCK), 24 (CS0) and 26 (CS1)
+    std::vector<HeaderPinRequest> spi =
+    {
+        {19, headerPinController::MODE_SFIO, headerPinController::OPTION_NONE},
+        {21, headerPinController::MODE_SFIO, headerPinController::OPTION_NONE},
+        {23, headerPinController::MODE_SFIO, headerPinController::OPTION_NONE},
+        {24, headerPinController::MODE_SFIO, headerPinController::OPTION_NONE},
+        {26, headerPinController::MODE_SFIO, headerPinController::OPTION_NONE},
+    };
+
+    // The same pins bit banged, chip selects idle high
+    std::vector<HeaderPinRequest> bitBang =
+    {
+        {19, headerPinController::MODE_GPIO_OUTPUT, headerPinController::OPTION_NONE},
+        {21, headerPinController::MODE_GPIO_INPUT, headerPinController::OPTION_NONE},
+        {23, headerPinController::MODE_GPIO_OUTPUT, headerPinController::OPTION_NONE},
+        {24, headerPinController::MODE_GPIO_OUTPUT, headerPinController::OPTION_OUTPUT_HIGH},
+        {26, headerPinController::MODE_GPIO_OUTPUT, headerPinController::OPTION_OUTPUT_HIGH},
+    };
+
+    PinProfileController profiles;
+    uint32_t spiProfile = profiles.addProfile("spi", spi);
+    uint32_t bitBangProfile = profiles.addProfile("bitBang", bitBang);
+    profiles.prepare();
+
+    std::cout << "first switch to spi: " << profiles.switchProfile(spiProfile) << " stores" << std::endl;
+
+    uint32_t stores = 0;
+    uint64_t start = Timestamp::now();
+    for(uint32_t i = 0; i < SWITCHES; i++)
+    {
+        stores += profiles.switchProfile(bitBangProfile);
+        stores += profiles.switchProfile(spiProfile);
+    }
+    uint64_t elapsedNs = Timestamp::now() - start;
+
+    std::cout << "spi <-> bitBang: " << (double)stores/(2*SWITCHES) << " stores, "
+        << (double)elapsedNs/(2*SWITCHES) << " ns per switch" << std::endl;
+
+    return 0;
+}
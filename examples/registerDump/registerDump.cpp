@@ -0,0 +1,173 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstring>
+
+#include "../../peripheralController/peripheralController.h"
+#include "../../pinmuxController/pinmuxController.h"
+#include "../../padGroupController/padGroupController.h"
+#include "../../gpioController/gpio.h"
+#include "../../registerMetadata/registerMetadata.h"
+#include "../../timestamp/timestamp.h"
+
+static const uint32_t NUMBER_OF_BLOCKS = 3;
+static const char* blockNames[NUMBER_OF_BLOCKS] = {"pinmux", "pad", "gpio"};
+
+static int usage()
+{
+    std::cerr << "usage: registerDump [--diff] [pinmux | pad | gpio | all | <register name> ...]" << std::endl;
+    std::cerr << "  --diff  only registers and fields that differ from their reset value" << std::endl;
+    return 1;
+}
+
+static std::ostream& hex32(std::ostream& stream, uint32_t value)
+{
+    return stream << "0x" << std::hex << std::setw(8) << std::setfill('0') << value << std::dec << std::setfill(' ');
+}
+
+static void printRegister(const RegisterInfo& info, uint32_t value, bool diff)
+{
+    std::cout << std::left << std::setw(32) << info.name << std::right << " ";
+    hex32(std::cout, RegisterMetadata::getPhysicalAddress(info)) << " = ";
+    hex32(std::cout, value);
+    if(info.hasResetValue)
+    {
+        std::cout << "  reset ";
+        hex32(std::cout, info.resetValue);
+    }
+    std::cout << std::endl;
+
+    uint32_t numberOfFields;
+    const RegisterFieldInfo* fields = RegisterMetadata::getFields(info, numberOfFields);
+
+    std::cout << "    ";
+    for(uint32_t i = 0; i < numberOfFields; i++)
+    {
+        uint32_t fieldValue = RegisterMetadata::getFieldValue(fields[i], value);
+        uint32_t resetValue = RegisterMetadata::getFieldValue(fields[i], info.resetValue);
+
+        if(diff && (fieldValue == resetValue))
+        {
+            continue;
+        }
+
+        std::cout << fields[i].name << "=" << fieldValue;
+        if(diff)
+        {
+            std::cout << " (reset " << resetValue << ")";
+        }
+        std::cout << " ";
+    }
+    std::cout << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    bool diff = false;
+    bool blockSelected[NUMBER_OF_BLOCKS] = {false, false, false};
+    std::vector<uint32_t> named;
+
+    for(int i = 1; i < argc; i++)
+    {
+        bool isBlock = false;
+        for(uint32_t block = 0; block < NUMBER_OF_BLOCKS; block++)
+        {
+            if(strcmp(argv[i], blockNames[block]) == 0)
+            {
+                blockSelected[block] = true;
+                isBlock = true;
+            }
+        }
+
+        if(isBlock)
+        {
+            continue;
+        }
+        else if(strcmp(argv[i], "--diff") == 0)
+        {
+            diff = true;
+        }
+        else if(strcmp(argv[i], "all") == 0)
+        {
+            blockSelected[registerMetadata::BLOCK_PINMUX] = true;
+            blockSelected[registerMetadata::BLOCK_PAD_GROUP] = true;
+            blockSelected[registerMetadata::BLOCK_GPIO] = true;
+        }
+        else if(RegisterMetadata::find(argv[i]) != NULL)
+        {
+            named.push_back(RegisterMetadata::indexOf(argv[i]));
+        }
+        else
+        {
+            std::cerr << "unknown register " << argv[i] << std::endl;
+            return usage();
+        }
+    }
+
+    if(named.empty() && !blockSelected[0] && !blockSelected[1] && !blockSelected[2])
+    {
+        blockSelected[registerMetadata::BLOCK_PINMUX] = true;
+        blockSelected[registerMetadata::BLOCK_PAD_GROUP] = true;
+        blockSelected[registerMetadata::BLOCK_GPIO] = true;
+    }
+
+    std::vector<uint32_t> selected;
+    for(uint32_t i = 0; i < RegisterMetadata::getNumberOfRegisters(); i++)
+    {
+        if(blockSelected[RegisterMetadata::getRegister(i).block])
+        {
+            selected.push_back(i);
+        }
+    }
+    selected.insert(selected.end(), named.begin(), named.end());
+
+    // Every block fits in one page, so one mapping each
+    const uint32_t blockBases[NUMBER_OF_BLOCKS] = {pinmuxController::baseAddress, padGroupController::baseAddress, gpioController::gpioController1BaseAddress};
+    std::unique_ptr<PeripheralController> mappings[NUMBER_OF_BLOCKS];
+    for(uint32_t i = 0; i < selected.size(); i++)
+    {
+        uint32_t block = RegisterMetadata::getRegister(selected[i]).block;
+        if(!mappings[block])
+        {
+            mappings[block].reset(new PeripheralController(blockBases[block]));
+        }
+    }
+
+    // Read everything first in table order, decode afterwards
+    std::vector<uint32_t> values(selected.size());
+    uint64_t start = Timestamp::now();
+    for(uint32_t i = 0; i < selected.size(); i++)
+    {
+        const RegisterInfo& info = RegisterMetadata::getRegister(selected[i]);
+        values[i] = mappings[info.block]->getRegister(info.addressOffset);
+    }
+    uint64_t elapsedNs = Timestamp::now() - start;
+
+    uint32_t differing = 0;
+    for(uint32_t i = 0; i < selected.size(); i++)
+    {
+        const RegisterInfo& info = RegisterMetadata::getRegister(selected[i]);
+
+        if(diff)
+        {
+            if(!info.hasResetValue || (values[i] == info.resetValue))
+            {
+                continue;
+            }
+            differing++;
+        }
+
+        printRegister(info, values[i], diff);
+    }
+
+    std::cout << selected.size() << " registers read in " << elapsedNs << " ns";
+    if(diff)
+    {
+        std::cout << ", " << differing << " differ from reset";
+    }
+    std::cout << std::endl;
+
+    return 0;
+}
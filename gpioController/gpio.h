@@ -144,6 +144,12 @@
  * GPIO_DB_CNT _[CC/DD/EE/-]_0  | -—- | -—- | -—- | -—-             | 7F0 | 7F4 | 7F8 | -—-
  * 
  */ 
+
+#ifndef GPIO_H
+#define GPIO_H
+
+#include <cstdint>
+
 struct gpioController{
     static const uint32_t gpioController1BaseAddress = 0x6000d000;
     static const uint32_t gpioController2BaseAddress = 0x6000d100;
@@ -3152,3 +3158,4 @@ struct GPIO_DB_CNT_P3
         
 };
 
+#endif //GPIO_H
@@ -0,0 +1,121 @@
+/**
+ * @file gpioPin.h
+ * @brief GPIO pin addressing helpers
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano GPIO pin addressing helpers
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @section Description
+ *
+ * All eight GPIO controllers live in the same 4 KiB page starting at
+ * gpioController::gpioController1BaseAddress, each controller 0x100 bytes
+ * apart and each port 4 bytes apart inside its controller (see the register
+ * address map in gpio.h). A single PeripheralController mapped at
+ * gpioController1BaseAddress can therefore reach every port using the
+ * offsets computed here.
+ *
+ * Ports are numbered in the order of Table 32 of the TX1 TRM, so port A is
+ * 0, port B is 1 ... port EE is 30. PB.06 is gpioPort::PB, bit 6.
+ */
+
+#ifndef GPIO_PIN_H
+#define GPIO_PIN_H
+
+#include <cstdint>
+
+struct gpioPort
+{
+    static const uint32_t PA = 0;
+    static const uint32_t PB = 1;
+    static const uint32_t PC = 2;
+    static const uint32_t PD = 3;
+    static const uint32_t PE = 4;
+    static const uint32_t PF = 5;
+    static const uint32_t PG = 6;
+    static const uint32_t PH = 7;
+    static const uint32_t PI = 8;
+    static const uint32_t PJ = 9;
+    static const uint32_t PK = 10;
+    static const uint32_t PL = 11;
+    static const uint32_t PM = 12;
+    static const uint32_t PN = 13;
+    static const uint32_t PO = 14;
+    static const uint32_t PP = 15;
+    static const uint32_t PQ = 16;
+    static const uint32_t PR = 17;
+    static const uint32_t PS = 18;
+    static const uint32_t PT = 19;
+    static const uint32_t PU = 20;
+    static const uint32_t PV = 21;
+    static const uint32_t PW = 22;
+    static const uint32_t PX = 23;
+    static const uint32_t PY = 24;
+    static const uint32_t PZ = 25;
+    static const uint32_t PAA = 26;
+    static const uint32_t PBB = 27;
+    static const uint32_t PCC = 28;
+    static const uint32_t PDD = 29;
+    static const uint32_t PEE = 30;
+
+    static const uint32_t NUMBER_OF_PORTS = 31;
+    static const uint32_t PORTS_PER_CONTROLLER = 4;
+    static const uint32_t PINS_PER_PORT = 8;
+
+    static const uint32_t CONTROLLER_STRIDE = 0x100;
+    static const uint32_t PORT_STRIDE = 0x4;
+
+    // The upper byte of every GPIO_MSK_* register selects which bits are written
+    static const uint32_t MSK_SHIFT = 8;
+};
+
+struct GpioPin
+{
+    uint32_t port; // gpioPort::PA through gpioPort::PEE
+    uint32_t bit;  // 0 through 7
+};
+
+/**
+ * Offset of a port's register from gpioController1BaseAddress.
+ *
+ * @param port gpioPort::PA through gpioPort::PEE
+ * @param registerOffset the controller 1 port A offset of the register,
+ *        for example GPIO_MSK_OUT_0::addressOffset
+ */
+inline uint32_t gpioPortOffset(uint32_t port, uint32_t registerOffset)
+{
+    return ((port/gpioPort::PORTS_PER_CONTROLLER)*gpioPort::CONTROLLER_STRIDE) +
+        ((port%gpioPort::PORTS_PER_CONTROLLER)*gpioPort::PORT_STRIDE) + registerOffset;
+}
+
+/**
+ * Value for a GPIO_MSK_* register that writes bitValues to the bits selected
+ * by bitMask and leaves every other pin of the port untouched.
+ */
+inline uint32_t gpioMaskedValue(uint32_t bitMask, uint32_t bitValues)
+{
+    return ((bitMask & 0xFF) << gpioPort::MSK_SHIFT) | (bitValues & bitMask & 0xFF);
+}
+
+#endif //GPIO_PIN_H
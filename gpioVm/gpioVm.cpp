@@ -0,0 +1,425 @@
+#include "gpioVm.h"
+#include "../gpioController/gpio.h"
+#include "../timestamp/timestamp.h"
+#include <cstdint>
+#include <cstdlib>
+#include <sstream>
+#include <cassert>
+
+static const uint32_t PIN_OPERAND_LIMIT = gpioPort::NUMBER_OF_PORTS*gpioPort::PINS_PER_PORT;
+
+static uint32_t makeWord(uint32_t opcode, uint32_t operand)
+{
+    return opcode | (operand << gpioVmOpcode::OPERAND_SHIFT);
+}
+
+// "PB", "PEE" ...
+static bool parsePort(const std::string& name, uint32_t& port)
+{
+    if((name.size() < 2) || (name.size() > 3) || (name[0] != 'P'))
+    {
+        return false;
+    }
+
+    char letter = name[1];
+    if((letter < 'A') || (letter > 'Z'))
+    {
+        return false;
+    }
+
+    if(name.size() == 2)
+    {
+        port = letter - 'A';
+        return true;
+    }
+
+    // Double letter ports AA through EE follow port Z
+    if((name[2] != letter) || (letter > 'E'))
+    {
+        return false;
+    }
+    port = gpioPort::PAA + (letter - 'A');
+    return true;
+}
+
+// "PB.06", "PB6" ...
+static bool parsePin(const std::string& name, uint32_t& pin)
+{
+    size_t digits = name.find_first_of("0123456789.");
+    if(digits == std::string::npos)
+    {
+        return false;
+    }
+
+    uint32_t port = 0;
+    if(!parsePort(name.substr(0, digits), port))
+    {
+        return false;
+    }
+
+    std::string bitText = name.substr(digits);
+    if(bitText[0] == '.')
+    {
+        bitText = bitText.substr(1);
+    }
+    if(bitText.empty() || (bitText.find_first_not_of("0123456789") != std::string::npos))
+    {
+        return false;
+    }
+
+    uint32_t bit = std::strtoul(bitText.c_str(), NULL, 10);
+    if(bit >= gpioPort::PINS_PER_PORT)
+    {
+        return false;
+    }
+
+    pin = (port*gpioPort::PINS_PER_PORT) + bit;
+    return true;
+}
+
+static bool parseNumber(const std::string& text, uint32_t& number)
+{
+    if(text.empty())
+    {
+        return false;
+    }
+
+    char* end = NULL;
+    unsigned long long value = std::strtoull(text.c_str(), &end, 0);
+    if((*end != '\0') || (value > 0xFFFFFFFFull) || (text[0] == '-'))
+    {
+        return false;
+    }
+
+    number = value;
+    return true;
+}
+
+GpioVm::GpioVm() : gpio(gpioController::gpioController1BaseAddress)
+{
+}
+
+bool GpioVm::assemble(const std::string& script, std::vector<uint32_t>& bytecode, std::string& errorMessage)
+{
+    std::istringstream lines(script);
+    std::string line;
+    uint32_t lineNumber = 0;
+
+    bytecode.clear();
+    while(std::getline(lines, line))
+    {
+        lineNumber++;
+
+        size_t comment = line.find('#');
+        if(comment != std::string::npos)
+        {
+            line = line.substr(0, comment);
+        }
+
+        std::istringstream words(line);
+        std::vector<std::string> tokens;
+        std::string token;
+        while(words >> token)
+        {
+            tokens.push_back(token);
+        }
+
+        if(tokens.empty())
+        {
+            continue;
+        }
+
+        const std::string& mnemonic = tokens[0];
+        bool valid = false;
+        uint32_t pin = 0;
+        uint32_t port = 0;
+        uint32_t first = 0;
+        uint32_t second = 0;
+        uint32_t third = 0;
+
+        if(((mnemonic == "set") || (mnemonic == "clear")) && (tokens.size() == 2))
+        {
+            valid = parsePin(tokens[1], pin);
+            bytecode.push_back(makeWord((mnemonic == "set") ? gpioVmOpcode::SET : gpioVmOpcode::CLEAR, pin));
+        }
+        else if((mnemonic == "write") && (tokens.size() == 4))
+        {
+            valid = parsePort(tokens[1], port) && parseNumber(tokens[2], first) && parseNumber(tokens[3], second) &&
+                (first <= 0xFF) && (second <= 0xFF);
+            bytecode.push_back(makeWord(gpioVmOpcode::WRITE_PORT, port | (first << 8) | (second << 16)));
+        }
+        else if((mnemonic == "wait") && (tokens.size() == 2))
+        {
+            valid = parseNumber(tokens[1], first);
+            bytecode.push_back(makeWord(gpioVmOpcode::WAIT_NS, 0));
+            bytecode.push_back(first);
+        }
+        else if((mnemonic == "waitpin") && ((tokens.size() == 3) || (tokens.size() == 4)))
+        {
+            valid = parsePin(tokens[1], pin) && parseNumber(tokens[2], second) && (second <= 1);
+            if(tokens.size() == 4)
+            {
+                valid = valid && parseNumber(tokens[3], third);
+            }
+            bytecode.push_back(makeWord(gpioVmOpcode::WAIT_PIN, pin | (second << 8)));
+            bytecode.push_back(third);
+        }
+        else if((mnemonic == "loop") && (tokens.size() == 2))
+        {
+            valid = parseNumber(tokens[1], first);
+            bytecode.push_back(makeWord(gpioVmOpcode::LOOP, 0));
+            bytecode.push_back(first);
+        }
+        else if((mnemonic == "endloop") && (tokens.size() == 1))
+        {
+            valid = true;
+            bytecode.push_back(makeWord(gpioVmOpcode::END_LOOP, 0));
+        }
+        else if((mnemonic == "end") && (tokens.size() == 1))
+        {
+            valid = true;
+            bytecode.push_back(makeWord(gpioVmOpcode::END, 0));
+        }
+
+        if(!valid)
+        {
+            std::ostringstream message;
+            message << "line " << lineNumber << ": cannot assemble \"" << line << "\"";
+            errorMessage = message.str();
+            bytecode.clear();
+            return false;
+        }
+    }
+
+    bytecode.push_back(makeWord(gpioVmOpcode::END, 0));
+    return true;
+}
+
+bool GpioVm::load(const std::vector<uint32_t>& bytecode, std::string& errorMessage)
+{
+    std::vector<Instruction> resolved;
+    std::vector<uint32_t> loopStarts;
+    bool ended = false;
+
+    for(uint32_t i = 0; (i < bytecode.size()) && !ended; i++)
+    {
+        uint32_t opcode = bytecode[i] & 0xFF;
+        uint32_t operand = bytecode[i] >> gpioVmOpcode::OPERAND_SHIFT;
+        uint32_t extraWords = ((opcode == gpioVmOpcode::WAIT_NS) || (opcode == gpioVmOpcode::WAIT_PIN) ||
+            (opcode == gpioVmOpcode::LOOP)) ? 1 : 0;
+
+        std::ostringstream message;
+        message << "word " << i << ": ";
+
+        if((i + extraWords) >= bytecode.size())
+        {
+            message << "truncated instruction";
+            errorMessage = message.str();
+            return false;
+        }
+
+        Instruction instruction;
+        instruction.opcode = opcode;
+        instruction.registerAddress = NULL;
+        instruction.value = 0;
+        instruction.argument = 0;
+        instruction.timeoutNs = 0;
+
+        uint32_t pin = operand & 0xFF;
+        uint32_t port = pin/gpioPort::PINS_PER_PORT;
+        uint32_t bitMask = 1 << (pin%gpioPort::PINS_PER_PORT);
+        bool validPin = pin < PIN_OPERAND_LIMIT;
+
+        switch(opcode)
+        {
+            case gpioVmOpcode::END:
+                ended = true;
+                break;
+
+            case gpioVmOpcode::SET:
+            case gpioVmOpcode::CLEAR:
+                if(!validPin)
+                {
+                    message << "bad pin " << pin;
+                    errorMessage = message.str();
+                    return false;
+                }
+                instruction.registerAddress = gpio.getRegisterAddress(gpioPortOffset(port, GPIO_MSK_OUT_0::addressOffset));
+                instruction.value = gpioMaskedValue(bitMask, (opcode == gpioVmOpcode::SET) ? bitMask : 0);
+                break;
+
+            case gpioVmOpcode::WRITE_PORT:
+                port = operand & 0xFF;
+                if(port >= gpioPort::NUMBER_OF_PORTS)
+                {
+                    message << "bad port " << port;
+                    errorMessage = message.str();
+                    return false;
+                }
+                instruction.registerAddress = gpio.getRegisterAddress(gpioPortOffset(port, GPIO_MSK_OUT_0::addressOffset));
+                instruction.value = gpioMaskedValue((operand >> 8) & 0xFF, (operand >> 16) & 0xFF);
+                break;
+
+            case gpioVmOpcode::WAIT_NS:
+                instruction.argument = bytecode[++i];
+                break;
+
+            case gpioVmOpcode::WAIT_PIN:
+                if(!validPin)
+                {
+                    message << "bad pin " << pin;
+                    errorMessage = message.str();
+                    return false;
+                }
+                instruction.registerAddress = gpio.getRegisterAddress(gpioPortOffset(port, GPIO_IN_0_RMW::addressOffset));
+                instruction.value = bitMask;
+                instruction.argument = ((operand >> 8) & 0x1) ? bitMask : 0;
+                instruction.timeoutNs = bytecode[++i];
+                break;
+
+            case gpioVmOpcode::LOOP:
+                if(loopStarts.size() == MAX_LOOP_DEPTH)
+                {
+                    message << "loops nested deeper than " << MAX_LOOP_DEPTH;
+                    errorMessage = message.str();
+                    return false;
+                }
+                instruction.argument = bytecode[++i];
+                loopStarts.push_back(resolved.size() + 1);
+                break;
+
+            case gpioVmOpcode::END_LOOP:
+                if(loopStarts.empty())
+                {
+                    message << "endloop without loop";
+                    errorMessage = message.str();
+                    return false;
+                }
+                instruction.argument = loopStarts.back();
+                loopStarts.pop_back();
+                break;
+
+            default:
+                message << "unknown opcode " << opcode;
+                errorMessage = message.str();
+                return false;
+        }
+
+        resolved.push_back(instruction);
+    }
+
+    if(!loopStarts.empty())
+    {
+        errorMessage = "loop without endloop";
+        return false;
+    }
+
+    if(!ended)
+    {
+        Instruction end;
+        end.opcode = gpioVmOpcode::END;
+        end.registerAddress = NULL;
+        end.value = 0;
+        end.argument = 0;
+        end.timeoutNs = 0;
+        resolved.push_back(end);
+    }
+
+    program.swap(resolved);
+    return true;
+}
+
+GpioVm::Status GpioVm::run()
+{
+    assert(!program.empty());
+
+    const Instruction* instructions = program.data();
+    uint32_t loopCounters[MAX_LOOP_DEPTH];
+    uint32_t loopDepth = 0;
+    uint32_t programCounter = 0;
+    uint64_t executed = 0;
+    Status status = OK;
+
+    for(;;)
+    {
+        const Instruction& instruction = instructions[programCounter++];
+        executed++;
+
+        switch(instruction.opcode)
+        {
+            case gpioVmOpcode::SET:
+            case gpioVmOpcode::CLEAR:
+            case gpioVmOpcode::WRITE_PORT:
+                *instruction.registerAddress = instruction.value;
+                break;
+
+            case gpioVmOpcode::WAIT_NS:
+            {
+                uint64_t deadline = Timestamp::now() + instruction.argument;
+                while(Timestamp::now() < deadline)
+                {
+                }
+                break;
+            }
+
+            case gpioVmOpcode::WAIT_PIN:
+            {
+                uint64_t deadline = (instruction.timeoutNs == 0) ? 0 : Timestamp::now() + instruction.timeoutNs;
+                while((*instruction.registerAddress & instruction.value) != instruction.argument)
+                {
+                    if((deadline != 0) && (Timestamp::now() >= deadline))
+                    {
+                        status = TIMEOUT;
+                        break;
+                    }
+                }
+                break;
+            }
+
+            case gpioVmOpcode::LOOP:
+                if(instruction.argument == 0)
+                {
+                    // Skip the body, the matching END_LOOP is the first one at this depth
+                    uint32_t depth = 1;
+                    while(depth > 0)
+                    {
+                        uint32_t opcode = instructions[programCounter++].opcode;
+                        depth += (opcode == gpioVmOpcode::LOOP) ? 1 : 0;
+                        depth -= (opcode == gpioVmOpcode::END_LOOP) ? 1 : 0;
+                    }
+                }
+                else
+                {
+                    loopCounters[loopDepth++] = instruction.argument;
+                }
+                break;
+
+            case gpioVmOpcode::END_LOOP:
+                if(--loopCounters[loopDepth - 1] == 0)
+                {
+                    loopDepth--;
+                }
+                else
+                {
+                    programCounter = instruction.argument;
+                }
+                break;
+
+            case gpioVmOpcode::END:
+            default:
+                instructionsExecuted = executed;
+                return status;
+        }
+
+        if(status != OK)
+        {
+            instructionsExecuted = executed;
+            return status;
+        }
+    }
+}
+
+uint64_t GpioVm::getInstructionsExecuted()
+{
+    return instructionsExecuted;
+}
@@ -0,0 +1,139 @@
+/**
+ * @file gpioVm.h
+ * @brief GPIO bytecode interpreter class declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano GPIO bytecode interpreter
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class GpioVm
+ * @brief Small bytecode interpreter for scripted pin sequences
+ *
+ * @section Description
+ *
+ * Bytecode is a list of 32 bit words. The low byte of the first word of an
+ * instruction is the opcode, the upper 24 bits are its operand. Pins are
+ * encoded as (port*8 + bit), ports as gpioPort::PA through gpioPort::PEE.
+ * _____________________________________________________________________________
+ * Opcode      | Operand (bits 8 - 31)                  | Extra words
+ * END         | -                                      | -
+ * SET         | pin                                    | -
+ * CLEAR       | pin                                    | -
+ * WRITE_PORT  | port | mask << 8 | value << 16         | -
+ * WAIT_NS     | -                                      | nanoseconds
+ * WAIT_PIN    | pin | level << 8                       | timeout in ns, 0 is forever
+ * LOOP        | -                                      | repeat count
+ * END_LOOP    | -                                      | -
+ *
+ * LOOP/END_LOOP pairs nest up to MAX_LOOP_DEPTH deep. load() checks the
+ * program and resolves every pin to a register address and a precomputed
+ * GPIO_MSK_OUT value or GPIO_IN mask, so run() is a switch over a flat array
+ * with one store or load per pin instruction.
+ *
+ * assemble() turns a text script into bytecode, one instruction per line,
+ * '#' starts a comment:
+ *
+ *     loop 1000
+ *         set PB.06
+ *         wait 500
+ *         clear PB.06
+ *         waitpin PB.05 1 10000
+ *         write PJ 0xF0 0x50
+ *     endloop
+ */
+
+#ifndef GPIO_VM_H
+#define GPIO_VM_H
+
+#include <cstdint>
+#include <vector>
+#include <string>
+
+#include "../peripheralController/peripheralController.h"
+#include "../gpioController/gpioPin.h"
+
+struct gpioVmOpcode
+{
+    static const uint32_t END = 0;
+    static const uint32_t SET = 1;
+    static const uint32_t CLEAR = 2;
+    static const uint32_t WRITE_PORT = 3;
+    static const uint32_t WAIT_NS = 4;
+    static const uint32_t WAIT_PIN = 5;
+    static const uint32_t LOOP = 6;
+    static const uint32_t END_LOOP = 7;
+
+    static const uint32_t OPERAND_SHIFT = 8;
+};
+
+class GpioVm
+{
+    public:
+        static const uint32_t MAX_LOOP_DEPTH = 8;
+
+        enum Status
+        {
+            OK,
+            TIMEOUT
+        };
+
+        GpioVm();
+
+        GpioVm(const GpioVm&) = delete;
+        GpioVm& operator=(const GpioVm&) = delete;
+
+        /*
+         * Text script to bytecode. On failure returns false and describes
+         * the first bad line in errorMessage.
+         */
+        static bool assemble(const std::string& script, std::vector<uint32_t>& bytecode, std::string& errorMessage);
+
+        /*
+         * Checks the program and resolves it for run(). On failure returns
+         * false, describes the problem in errorMessage and leaves the
+         * previously loaded program in place.
+         */
+        bool load(const std::vector<uint32_t>& bytecode, std::string& errorMessage);
+
+        Status run();
+
+        // Instructions dispatched by the last run(), including END.
+        uint64_t getInstructionsExecuted();
+
+    private:
+        struct Instruction
+        {
+            uint32_t opcode;
+            volatile uint32_t* registerAddress;
+            uint32_t value;    // GPIO_MSK_OUT value, or the GPIO_IN mask for WAIT_PIN
+            uint32_t argument; // ns, expected GPIO_IN bits, loop count or loop start
+            uint32_t timeoutNs;
+        };
+
+        PeripheralController gpio;
+        std::vector<Instruction> program;
+        uint64_t instructionsExecuted = 0;
+};
+
+#endif //GPIO_VM_H
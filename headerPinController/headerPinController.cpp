@@ -0,0 +1,425 @@
+#include "headerPinController.h"
+#include "../gpioController/gpio.h"
+#include "../pinmuxController/pinmuxController.h"
+#include <cstdint>
+#include <algorithm>
+#include <cstring>
+#include <cassert>
+
+/*
+ * Every header pad keeps PM, PUPD, TRISTATE, PARK, E_INPUT and LOCK at the
+ * same bits, the only differences are in the upper bits (E_OD, E_IO_HV,
+ * DRV_TYPE ...). The asserts keep the table honest, the rest of this file
+ * uses the common layout.
+ */
+struct commonPinmux
+{
+    static const uint32_t PM_bit = 0;
+    static const uint32_t PM_bitWidth = 2;
+    static const uint32_t PUPD_bit = 2;
+    static const uint32_t PUPD_bitWidth = 2;
+    static const uint32_t TRISTATE_bit = 4;
+    static const uint32_t PARK_bit = 5;
+    static const uint32_t E_INPUT_bit = 6;
+    static const uint32_t LOCK_bit = 7;
+};
+
+/*
+ * The functions pinmuxController.h names for each header pad, from the
+ * Tegra X1 pinmux tables. Reserved PM values are left out.
+ */
+static const HeaderPinFunction i2c1Functions[] = {{"I2C1", pinmuxController::PM_BIT_I2C1}, {NULL, 0}};
+static const HeaderPinFunction i2c2Functions[] = {{"I2C2", pinmuxController::PM_BIT_I2C2}, {NULL, 0}};
+static const HeaderPinFunction audFunctions[] = {{"AUD", pinmuxController::PM_BIT_AUD}, {NULL, 0}};
+static const HeaderPinFunction uart2DataFunctions[] = {{"UARTB", pinmuxController::PM_BIT_UARTB}, {"I2S4A", pinmuxController::PM_BIT_I2S4A},
+    {"SPDIF", pinmuxController::PM_BIT_SPDIF}, {"UART", pinmuxController::PM_BIT_UART_STATE_3}, {NULL, 0}};
+static const HeaderPinFunction uart2FlowFunctions[] = {{"UARTB", pinmuxController::PM_BIT_UARTB}, {"I2S4A", pinmuxController::PM_BIT_I2S4A},
+    {"UART", pinmuxController::PM_BIT_UART_STATE_3}, {NULL, 0}};
+static const HeaderPinFunction i2s4bFunctions[] = {{"I2S4B", pinmuxController::PM_BIT_I2S4B}, {NULL, 0}};
+static const HeaderPinFunction spi1Functions[] = {{"SPI1", pinmuxController::PM_BIT_SPI1}, {NULL, 0}};
+static const HeaderPinFunction spi2Functions[] = {{"SPI2", pinmuxController::PM_BIT_SPI2}, {"DTV", pinmuxController::PM_BIT_DTV}, {NULL, 0}};
+static const HeaderPinFunction spi2Cs1Functions[] = {{"SPI2", pinmuxController::PM_BIT_SPI2}, {NULL, 0}};
+static const HeaderPinFunction displayaFunctions[] = {{"DISPLAYA", pinmuxController::PM_BIT_DISPLAYA}, {NULL, 0}};
+static const HeaderPinFunction vgp5Functions[] = {{"VGP5", pinmuxController::PM_BIT_VGP5}, {NULL, 0}};
+static const HeaderPinFunction vimclk2Functions[] = {{"VIMCLK2", pinmuxController::PM_BIT_VIMCLK2}, {NULL, 0}};
+static const HeaderPinFunction lcdBlPwmFunctions[] = {{"DISPLAYA", pinmuxController::PM_BIT_DISPLAYA}, {"PWM0", pinmuxController::PM_BIT_PWM0}, {NULL, 0}};
+static const HeaderPinFunction pe6Functions[] = {{"I2S5A", pinmuxController::PM_BIT_I2S5A}, {"PWM2", pinmuxController::PM_BIT_PWM2}, {NULL, 0}};
+static const HeaderPinFunction noFunctions[] = {{NULL, 0}};
+
+template<typename PINMUX_AUX>
+static HeaderPin headerPin(uint32_t number, const char* padName, uint32_t port, uint32_t bit, uint32_t sfioFunction, const HeaderPinFunction* functions)
+{
+    static_assert((PINMUX_AUX::PM_bit == commonPinmux::PM_bit) && (PINMUX_AUX::PUPD_bit == commonPinmux::PUPD_bit) &&
+        (PINMUX_AUX::TRISTATE_bit == commonPinmux::TRISTATE_bit) && (PINMUX_AUX::PARK_bit == commonPinmux::PARK_bit) &&
+        (PINMUX_AUX::E_INPUT_bit == commonPinmux::E_INPUT_bit) && (PINMUX_AUX::LOCK_bit == commonPinmux::LOCK_bit),
+        "header pad with an unexpected pinmux layout");
+
+    HeaderPin pin = {number, padName, {port, bit}, PINMUX_AUX::addressOffset, sfioFunction, functions};
+    return pin;
+}
+
+static HeaderPin noGpio(uint32_t number)
+{
+    HeaderPin pin = {number, "", {0, 0}, 0, 0, noFunctions};
+    return pin;
+}
+
+const HeaderPin& HeaderPinController::getHeaderPin(uint32_t number)
+{
+    // Indexed by header pin number, 0 is unused
+    static const HeaderPin headerPins[headerPinController::NUMBER_OF_HEADER_PINS + 1] =
+    {
+        noGpio(0),
+        noGpio(1), // 3.3V
+        noGpio(2), // 5V
+        headerPin<PINMUX_AUX_GEN2_I2C_SDA_0>(3, "GEN2_I2C_SDA", gpioPort::PJ, 3, pinmuxController::PM_BIT_I2C2, i2c2Functions),
+        noGpio(4), // 5V
+        headerPin<PINMUX_AUX_GEN2_I2C_SCL_0>(5, "GEN2_I2C_SCL", gpioPort::PJ, 2, pinmuxController::PM_BIT_I2C2, i2c2Functions),
+        noGpio(6), // GND
+        headerPin<PINMUX_AUX_AUD_MCLK_0>(7, "AUD_MCLK", gpioPort::PBB, 0, pinmuxController::PM_BIT_AUD, audFunctions),
+        headerPin<PINMUX_AUX_UART2_TX_0>(8, "UART2_TX", gpioPort::PG, 0, pinmuxController::PM_BIT_UARTB, uart2DataFunctions),
+        noGpio(9), // GND
+        headerPin<PINMUX_AUX_UART2_RX_0>(10, "UART2_RX", gpioPort::PG, 1, pinmuxController::PM_BIT_UARTB, uart2DataFunctions),
+        headerPin<PINMUX_AUX_UART2_RTS_0>(11, "UART2_RTS", gpioPort::PG, 2, pinmuxController::PM_BIT_UARTB, uart2FlowFunctions),
+        headerPin<PINMUX_AUX_DAP4_SCLK_0>(12, "DAP4_SCLK", gpioPort::PJ, 7, pinmuxController::PM_BIT_I2S4B, i2s4bFunctions),
+        headerPin<PINMUX_AUX_SPI2_SCK_0>(13, "SPI2_SCK", gpioPort::PB, 6, pinmuxController::PM_BIT_SPI2, spi2Functions),
+        noGpio(14), // GND
+        headerPin<PINMUX_AUX_LCD_TE_0>(15, "LCD_TE", gpioPort::PY, 2, pinmuxController::PM_BIT_DISPLAYA, displayaFunctions),
+        headerPin<PINMUX_AUX_SPI2_CS1_0>(16, "SPI2_CS1", gpioPort::PDD, 0, pinmuxController::PM_BIT_SPI2, spi2Cs1Functions),
+        noGpio(17), // 3.3V
+        headerPin<PINMUX_AUX_SPI2_CSO_0>(18, "SPI2_CS0", gpioPort::PB, 7, pinmuxController::PM_BIT_SPI2, spi2Functions),
+        headerPin<PINMUX_AUX_SPI1_MOSI_0>(19, "SPI1_MOSI", gpioPort::PC, 0, pinmuxController::PM_BIT_SPI1, spi1Functions),
+        noGpio(20), // GND
+        headerPin<PINMUX_AUX_SPI1_MISO_0>(21, "SPI1_MISO", gpioPort::PC, 1, pinmuxController::PM_BIT_SPI1, spi1Functions),
+        headerPin<PINMUX_AUX_SPI2_MISO_0>(22, "SPI2_MISO", gpioPort::PB, 5, pinmuxController::PM_BIT_SPI2, spi2Functions),
+        headerPin<PINMUX_AUX_SPI1_SCK_0>(23, "SPI1_SCK", gpioPort::PC, 2, pinmuxController::PM_BIT_SPI1, spi1Functions),
+        headerPin<PINMUX_AUX_SPI1_CS0_0>(24, "SPI1_CS0", gpioPort::PC, 3, pinmuxController::PM_BIT_SPI1, spi1Functions),
+        noGpio(25), // GND
+        headerPin<PINMUX_AUX_SPI1_CS1_0>(26, "SPI1_CS1", gpioPort::PC, 4, pinmuxController::PM_BIT_SPI1, spi1Functions),
+        headerPin<PINMUX_AUX_GEN1_I2C_SDA_0>(27, "GEN1_I2C_SDA", gpioPort::PJ, 1, pinmuxController::PM_BIT_I2C1, i2c1Functions),
+        headerPin<PINMUX_AUX_GEN1_I2C_SCL_0>(28, "GEN1_I2C_SCL", gpioPort::PJ, 0, pinmuxController::PM_BIT_I2C1, i2c1Functions),
+        headerPin<PINMUX_AUX_CAM_AF_EN_0>(29, "CAM_AF_EN", gpioPort::PS, 5, pinmuxController::PM_BIT_VGP5, vgp5Functions),
+        noGpio(30), // GND
+        headerPin<PINMUX_AUX_GPIO_PZ0_0>(31, "GPIO_PZ0", gpioPort::PZ, 0, pinmuxController::PM_BIT_VIMCLK2, vimclk2Functions),
+        headerPin<PINMUX_AUX_LCD_BL_PWM_0>(32, "LCD_BL_PWM", gpioPort::PV, 0, pinmuxController::PM_BIT_PWM0, lcdBlPwmFunctions),
+        headerPin<PINMUX_AUX_GPIO_PE6_0>(33, "GPIO_PE6", gpioPort::PE, 6, pinmuxController::PM_BIT_PWM2, pe6Functions),
+        noGpio(34), // GND
+        headerPin<PINMUX_AUX_DAP4_FS_0>(35, "DAP4_FS", gpioPort::PJ, 4, pinmuxController::PM_BIT_I2S4B, i2s4bFunctions),
+        headerPin<PINMUX_AUX_UART2_CTS_0>(36, "UART2_CTS", gpioPort::PG, 3, pinmuxController::PM_BIT_UARTB, uart2FlowFunctions),
+        headerPin<PINMUX_AUX_SPI2_MOSI_0>(37, "SPI2_MOSI", gpioPort::PB, 4, pinmuxController::PM_BIT_SPI2, spi2Functions),
+        headerPin<PINMUX_AUX_DAP4_DIN_0>(38, "DAP4_DIN", gpioPort::PJ, 5, pinmuxController::PM_BIT_I2S4B, i2s4bFunctions),
+        noGpio(39), // GND
+        headerPin<PINMUX_AUX_DAP4_DOUT_0>(40, "DAP4_DOUT", gpioPort::PJ, 6, pinmuxController::PM_BIT_I2S4B, i2s4bFunctions),
+    };
+
+    assert((number >= 1) && (number <= headerPinController::NUMBER_OF_HEADER_PINS));
+    return headerPins[number];
+}
+
+bool HeaderPinController::isGpioPin(uint32_t headerPin)
+{
+    return getHeaderPin(headerPin).pinmuxOffset != 0;
+}
+
+uint32_t HeaderPinController::findHeaderPin(const char* padName)
+{
+    for(uint32_t number = 1; number <= headerPinController::NUMBER_OF_HEADER_PINS; number++)
+    {
+        const HeaderPin& pin = getHeaderPin(number);
+        if((pin.pinmuxOffset != 0) && (strcmp(pin.padName, padName) == 0))
+        {
+            return number;
+        }
+    }
+    return 0;
+}
+
+bool HeaderPinController::findFunction(uint32_t headerPin, const char* name, uint32_t& function)
+{
+    for(const HeaderPinFunction* candidate = getHeaderPin(headerPin).functions; candidate->name != NULL; candidate++)
+    {
+        if(strcmp(candidate->name, name) == 0)
+        {
+            function = candidate->function;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool HeaderPinController::hasFunction(uint32_t headerPin, uint32_t function)
+{
+    for(const HeaderPinFunction* candidate = getHeaderPin(headerPin).functions; candidate->name != NULL; candidate++)
+    {
+        if(candidate->function == function)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t HeaderPinController::selectFunction(uint32_t function)
+{
+    assert(function < (1 << headerPinController::OPTION_FUNCTION_bitWidth));
+    return headerPinController::OPTION_FUNCTION | (function << headerPinController::OPTION_FUNCTION_bit);
+}
+
+HeaderPinController::HeaderPinController() : pinmux(pinmuxController::baseAddress), gpio(gpioController::gpioController1BaseAddress)
+{
+}
+
+void HeaderPinController::configurePin(uint32_t headerPin, uint32_t mode, uint32_t options)
+{
+    stagePin(headerPin, mode, options);
+    commit();
+}
+
+void HeaderPinController::stagePin(uint32_t headerPin, uint32_t mode, uint32_t options)
+{
+    const HeaderPin& pin = getHeaderPin(headerPin);
+    assert(pin.pinmuxOffset != 0);
+    assert(mode <= headerPinController::MODE_SFIO);
+    assert((options & (headerPinController::OPTION_PULL_UP | headerPinController::OPTION_PULL_DOWN)) !=
+        (headerPinController::OPTION_PULL_UP | headerPinController::OPTION_PULL_DOWN));
+    assert((options & (headerPinController::OPTION_FASTEST_EDGES | headerPinController::OPTION_SLOWEST_EDGES)) !=
+        (headerPinController::OPTION_FASTEST_EDGES | headerPinController::OPTION_SLOWEST_EDGES));
+    assert(((options & headerPinController::OPTION_FUNCTION) == 0) || ((mode == headerPinController::MODE_SFIO) &&
+        hasFunction(headerPin, (options >> headerPinController::OPTION_FUNCTION_bit) & ((1 << headerPinController::OPTION_FUNCTION_bitWidth) - 1))));
+
+    for(uint32_t i = 0; i < staged.size(); i++)
+    {
+        if(staged[i].headerPin == headerPin)
+        {
+            staged[i].mode = mode;
+            staged[i].options = options;
+            return;
+        }
+    }
+
+    HeaderPinRequest request = {headerPin, mode, options};
+    staged.push_back(request);
+}
+
+uint32_t HeaderPinController::commit()
+{
+    uint32_t accesses = commitPinmux();
+    accesses += commitGpio();
+
+    staged.clear();
+    return accesses;
+}
+
+void HeaderPinController::discard()
+{
+    staged.clear();
+}
+
+void HeaderPinController::getPinmuxUpdate(const HeaderPinRequest& request, uint32_t& bitMask, uint32_t& value)
+{
+    const HeaderPin& pin = getHeaderPin(request.headerPin);
+    assert(pin.pinmuxOffset != 0);
+
+    uint32_t pull = pinmuxController::PUPD_BIT_NONE;
+    if((request.options & headerPinController::OPTION_PULL_UP) != 0)
+    {
+        pull = pinmuxController::PUPD_BIT_PULL_UP;
+    }
+    else if((request.options & headerPinController::OPTION_PULL_DOWN) != 0)
+    {
+        pull = pinmuxController::PUPD_BIT_PULL_DOWN;
+    }
+
+    uint32_t inputEnable = ((request.options & headerPinController::OPTION_INPUT_DISABLE) != 0) ? pinmuxController::E_INPUT_BIT_DISABLE : pinmuxController::E_INPUT_BIT_ENABLE;
+
+    bitMask = (((1 << commonPinmux::PUPD_bitWidth) - 1) << commonPinmux::PUPD_bit) |
+        (1 << commonPinmux::TRISTATE_bit) |
+        (1 << commonPinmux::PARK_bit) |
+        (1 << commonPinmux::E_INPUT_bit);
+    value = (pull << commonPinmux::PUPD_bit) |
+        (pinmuxController::TRISTATE_BIT_PASSTHROUGH << commonPinmux::TRISTATE_bit) |
+        (pinmuxController::PARK_BIT_NORMAL << commonPinmux::PARK_bit) |
+        (inputEnable << commonPinmux::E_INPUT_bit);
+
+    // A GPIO pin does not care about PM, leave whatever function is there
+    if(request.mode == headerPinController::MODE_SFIO)
+    {
+        uint32_t function = pin.sfioFunction;
+        if((request.options & headerPinController::OPTION_FUNCTION) != 0)
+        {
+            function = (request.options >> headerPinController::OPTION_FUNCTION_bit) & ((1 << headerPinController::OPTION_FUNCTION_bitWidth) - 1);
+        }
+
+        bitMask |= ((1 << commonPinmux::PM_bitWidth) - 1) << commonPinmux::PM_bit;
+        value |= function << commonPinmux::PM_bit;
+    }
+}
+
+void HeaderPinController::getPortUpdates(const std::vector<HeaderPinRequest>& requests, std::vector<HeaderPinPortUpdate>& ports)
+{
+    ports.clear();
+
+    for(uint32_t i = 0; i < requests.size(); i++)
+    {
+        const GpioPin& gpioPin = getHeaderPin(requests[i].headerPin).gpio;
+        uint32_t bitMask = 1 << gpioPin.bit;
+
+        HeaderPinPortUpdate* port = NULL;
+        for(uint32_t j = 0; j < ports.size(); j++)
+        {
+            if(ports[j].port == gpioPin.port)
+            {
+                port = &ports[j];
+                break;
+            }
+        }
+        if(port == NULL)
+        {
+            HeaderPinPortUpdate newPort = {gpioPin.port, 0, 0, 0, 0, 0, 0};
+            ports.push_back(newPort);
+            port = &ports.back();
+        }
+
+        switch(requests[i].mode)
+        {
+            case headerPinController::MODE_GPIO_OUTPUT:
+                port->outMask |= bitMask;
+                if((requests[i].options & headerPinController::OPTION_OUTPUT_HIGH) != 0)
+                {
+                    port->outValue |= bitMask;
+                }
+                port->gpioMask |= bitMask;
+                port->oeSetMask |= bitMask;
+                break;
+            case headerPinController::MODE_GPIO_INPUT:
+                port->gpioMask |= bitMask;
+                port->oeClearMask |= bitMask;
+                break;
+            default:
+                port->sfioMask |= bitMask;
+                port->oeClearMask |= bitMask;
+                break;
+        }
+    }
+
+    std::sort(ports.begin(), ports.end(), [](const HeaderPinPortUpdate& a, const HeaderPinPortUpdate& b)
+    {
+        return a.port < b.port;
+    });
+}
+
+// Step 1, one read per pin and a write only when the value changes
+uint32_t HeaderPinController::commitPinmux()
+{
+    uint32_t accesses = 0;
+    bool padGroupsStaged = false;
+
+    for(uint32_t i = 0; i < staged.size(); i++)
+    {
+        const HeaderPin& pin = getHeaderPin(staged[i].headerPin);
+        uint32_t bitMask;
+        uint32_t value;
+
+        getPinmuxUpdate(staged[i], bitMask, value);
+
+        uint32_t current = pinmux.getRegister(pin.pinmuxOffset);
+        accesses++;
+        assert(((current >> commonPinmux::LOCK_bit) & 1) == pinmuxController::LOCK_BIT_DISABLE);
+
+        uint32_t updated = (current & ~bitMask) | value;
+        if(updated != current)
+        {
+            pinmux.setRegister(pin.pinmuxOffset, updated);
+            accesses++;
+        }
+
+        if((staged[i].options & headerPinController::OPTION_FASTEST_EDGES) != 0)
+        {
+            padGroups.stageHeaderPin(pin.headerPin, padGroupController::PRESET_FASTEST_EDGES);
+            padGroupsStaged = true;
+        }
+        else if((staged[i].options & headerPinController::OPTION_SLOWEST_EDGES) != 0)
+        {
+            padGroups.stageHeaderPin(pin.headerPin, padGroupController::PRESET_SLOWEST_EDGES);
+            padGroupsStaged = true;
+        }
+    }
+
+    if(padGroupsStaged)
+    {
+        accesses += padGroups.commit();
+    }
+
+    return accesses;
+}
+
+// Steps 2 - 5, the ports are read once and written through the masked registers
+uint32_t HeaderPinController::commitGpio()
+{
+    std::vector<HeaderPinPortUpdate> ports;
+    getPortUpdates(staged, ports);
+
+    uint32_t accesses = 0;
+    // Read the current state and drop every bit that is already right
+    for(uint32_t i = 0; i < ports.size(); i++)
+    {
+        HeaderPinPortUpdate& port = ports[i];
+
+        uint32_t cnf = gpio.getRegister(gpioPortOffset(port.port, GPIO_CNF_0_RMW::addressOffset));
+        uint32_t oe = gpio.getRegister(gpioPortOffset(port.port, GPIO_OE_0_RMW::addressOffset));
+        accesses += 2;
+
+        assert(((cnf >> gpioPort::MSK_SHIFT) & (port.gpioMask | port.sfioMask)) == 0);
+
+        if(port.outMask != 0)
+        {
+            uint32_t out = gpio.getRegister(gpioPortOffset(port.port, GPIO_OUT_0_RMW::addressOffset));
+            accesses++;
+            port.outMask &= out ^ port.outValue;
+        }
+
+        port.gpioMask &= ~cnf;
+        port.sfioMask &= cnf;
+        port.oeClearMask &= oe;
+        port.oeSetMask &= ~oe;
+    }
+
+    for(uint32_t i = 0; i < ports.size(); i++)
+    {
+        if(ports[i].outMask != 0)
+        {
+            gpio.setRegister(gpioPortOffset(ports[i].port, GPIO_MSK_OUT_0::addressOffset), gpioMaskedValue(ports[i].outMask, ports[i].outValue));
+            accesses++;
+        }
+    }
+
+    for(uint32_t i = 0; i < ports.size(); i++)
+    {
+        if(ports[i].oeClearMask != 0)
+        {
+            gpio.setRegister(gpioPortOffset(ports[i].port, GPIO_MSK_OE_0::addressOffset), gpioMaskedValue(ports[i].oeClearMask, 0));
+            accesses++;
+        }
+    }
+
+    for(uint32_t i = 0; i < ports.size(); i++)
+    {
+        uint32_t cnfMask = ports[i].gpioMask | ports[i].sfioMask;
+        if(cnfMask != 0)
+        {
+            gpio.setRegister(gpioPortOffset(ports[i].port, GPIO_MSK_CNF_0::addressOffset), gpioMaskedValue(cnfMask, ports[i].gpioMask));
+            accesses++;
+        }
+    }
+
+    for(uint32_t i = 0; i < ports.size(); i++)
+    {
+        if(ports[i].oeSetMask != 0)
+        {
+            gpio.setRegister(gpioPortOffset(ports[i].port, GPIO_MSK_OE_0::addressOffset), gpioMaskedValue(ports[i].oeSetMask, ports[i].oeSetMask));
+            accesses++;
+        }
+    }
+
+    return accesses;
+}
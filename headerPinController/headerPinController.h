@@ -0,0 +1,198 @@
+/**
+ * @file headerPinController.h
+ * @brief 40 pin header pin table and one call pin configuration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano header pin configuration
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class HeaderPinController
+ * @brief One call bring up of 40 pin header pins across pinmux, pad group and GPIO
+ *
+ * @section Description
+ *
+ * A header pin is set up by its pinmux register (function, pull, tristate,
+ * input buffer, park), optionally its pad group (drive and slew), and its
+ * GPIO port's CNF, OE and OUT bits. configurePin() does all of it for one
+ * pin. stagePin() and commit() do it for any number of pins at once:
+ *
+ * 1. Every register value is worked out up front.
+ * 2. Each pinmux register, and each involved port's CNF, OE and OUT, is
+ *    read once.
+ * 3. Only registers whose value changes are written. GPIO writes go through
+ *    the GPIO_MSK_* registers, one store per port per step, so they need no
+ *    read back and cannot disturb pins that were not staged.
+ *
+ * Stores are issued in an order that cannot glitch a pin:
+ * ____________________________________________________________________
+ * Step | Store                     | Why
+ * 1    | pinmux, pad groups        | pull and function settled before the pin is handed over
+ * 2    | GPIO_MSK_OUT              | the output level is in place before anything drives it
+ * 3    | GPIO_MSK_OE, clears       | pins becoming inputs or SFIO stop driving first
+ * 4    | GPIO_MSK_CNF              | GPIO or SFIO ownership
+ * 5    | GPIO_MSK_OE, sets         | outputs start driving, already at their level
+ *
+ * Configuring all 28 GPIO capable header pins from scratch costs 28 pinmux
+ * reads and 28 writes plus at most three reads and four stores for each of
+ * the 11 ports involved (PB, PBB, PC, PDD, PE, PG, PJ, PS, PV, PY, PZ), at
+ * most 133 accesses.
+ *
+ * A pin whose pinmux LOCK or GPIO LOCK bit is set cannot be changed until
+ * reset, staging it asserts.
+ */
+
+#ifndef HEADER_PIN_CONTROLLER_H
+#define HEADER_PIN_CONTROLLER_H
+
+#include <cstdint>
+#include <vector>
+
+#include "../peripheralController/peripheralController.h"
+#include "../padGroupController/padGroupController.h"
+#include "../gpioController/gpioPin.h"
+
+struct headerPinController
+{
+    static const uint32_t NUMBER_OF_HEADER_PINS = 40;
+
+    static const uint32_t MODE_GPIO_INPUT = 0;
+    static const uint32_t MODE_GPIO_OUTPUT = 1;
+    static const uint32_t MODE_SFIO = 2; // the pin's usual special function, HeaderPin::sfioFunction, or OPTION_FUNCTION
+
+    // Options, or'd together
+    static const uint32_t OPTION_NONE = 0;
+    static const uint32_t OPTION_OUTPUT_HIGH = 1 << 0; // initial level of a GPIO output, low otherwise
+    static const uint32_t OPTION_PULL_UP = 1 << 1;
+    static const uint32_t OPTION_PULL_DOWN = 1 << 2;
+    static const uint32_t OPTION_FASTEST_EDGES = 1 << 3; // padGroupController::PRESET_FASTEST_EDGES
+    static const uint32_t OPTION_SLOWEST_EDGES = 1 << 4; // padGroupController::PRESET_SLOWEST_EDGES
+    static const uint32_t OPTION_INPUT_DISABLE = 1 << 5; // input buffer off, outputs only
+    static const uint32_t OPTION_FUNCTION = 1 << 6; // MODE_SFIO with the PM value at OPTION_FUNCTION_bit, see selectFunction()
+
+    static const uint32_t OPTION_FUNCTION_bit = 7;
+    static const uint32_t OPTION_FUNCTION_bitWidth = 2;
+
+    // The glitch free store order of the table above, for code issuing the same stores
+    static const uint32_t STEP_PINMUX = 0; // pinmux, pad groups
+    static const uint32_t STEP_OUT = 1;
+    static const uint32_t STEP_OE_CLEAR = 2;
+    static const uint32_t STEP_CNF = 3;
+    static const uint32_t STEP_OE_SET = 4;
+    static const uint32_t NUMBER_OF_STEPS = 5;
+};
+
+// One pinmux function of a header pad, name as in pinmuxController::PM_BIT_<name>
+struct HeaderPinFunction
+{
+    const char* name;
+    uint32_t function; // pinmux PM value
+};
+
+// Everything needed to configure one header pin
+struct HeaderPin
+{
+    uint32_t headerPin;
+    const char* padName; // Tegra pad name, "SPI2_SCK" for header pin 13
+    GpioPin gpio;
+    uint32_t pinmuxOffset; // from pinmuxController::baseAddress, 0 for power and ground pins
+    uint32_t sfioFunction; // pinmux PM value of the pin's usual special function
+    const HeaderPinFunction* functions; // every named function of the pad, ended by a NULL name
+};
+
+struct HeaderPinRequest
+{
+    uint32_t headerPin;
+    uint32_t mode;
+    uint32_t options;
+};
+
+// Per GPIO port bit masks gathered from a set of requests
+struct HeaderPinPortUpdate
+{
+    uint32_t port;
+    uint32_t outMask;
+    uint32_t outValue;
+    uint32_t gpioMask; // CNF to GPIO
+    uint32_t sfioMask; // CNF to SFIO
+    uint32_t oeClearMask;
+    uint32_t oeSetMask;
+};
+
+class HeaderPinController
+{
+    public:
+        HeaderPinController();
+
+        HeaderPinController(const HeaderPinController&) = delete;
+        HeaderPinController& operator=(const HeaderPinController&) = delete;
+
+        // stagePin() then commit() for a single pin.
+        void configurePin(uint32_t headerPin, uint32_t mode, uint32_t options = headerPinController::OPTION_NONE);
+
+        // A pin staged twice keeps the last mode and options.
+        void stagePin(uint32_t headerPin, uint32_t mode, uint32_t options = headerPinController::OPTION_NONE);
+
+        /*
+         * Applies everything staged since the last commit() or discard().
+         * Returns the number of register reads and writes it took.
+         */
+        uint32_t commit();
+        void discard();
+
+        // Header pins 1 - 40, isGpioPin() is false for power and ground.
+        static bool isGpioPin(uint32_t headerPin);
+        static const HeaderPin& getHeaderPin(uint32_t headerPin);
+
+        // Header pin with padName, 0 when there is none.
+        static uint32_t findHeaderPin(const char* padName);
+
+        /*
+         * The PM value of the pad function called name ("PWM2", "I2S5A"),
+         * false when the header pin's pad has no such function.
+         */
+        static bool findFunction(uint32_t headerPin, const char* name, uint32_t& function);
+        static bool hasFunction(uint32_t headerPin, uint32_t function);
+
+        // Options selecting PM value function for MODE_SFIO instead of the usual one.
+        static uint32_t selectFunction(uint32_t function);
+
+        /*
+         * What commit() would do, without a mapping: the pinmux bits and
+         * value for one request, and the GPIO masks for a set of requests
+         * sorted by port. Used to build configuration images offline.
+         */
+        static void getPinmuxUpdate(const HeaderPinRequest& request, uint32_t& bitMask, uint32_t& value);
+        static void getPortUpdates(const std::vector<HeaderPinRequest>& requests, std::vector<HeaderPinPortUpdate>& ports);
+
+    private:
+        uint32_t commitPinmux();
+        uint32_t commitGpio();
+
+        PeripheralController pinmux;
+        PeripheralController gpio;
+        PadGroupController padGroups;
+        std::vector<HeaderPinRequest> staged;
+};
+
+#endif //HEADER_PIN_CONTROLLER_H
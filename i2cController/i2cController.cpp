@@ -0,0 +1,440 @@
+#include "i2cController.h"
+#include "../gpioController/gpio.h"
+#include "../gpioController/gpioPin.h"
+#include "../pinmuxController/pinmuxController.h"
+#include "../timestamp/timestamp.h"
+#include <cstdint>
+#include <cstddef>
+#include <cassert>
+
+static uint32_t getBaseAddress(uint32_t controller)
+{
+    static const uint32_t baseAddresses[] = {i2cController::I2C1_baseAddress, i2cController::I2C2_baseAddress,
+        i2cController::I2C3_baseAddress, i2cController::I2C4_baseAddress, i2cController::I2C5_baseAddress,
+        i2cController::I2C6_baseAddress};
+
+    assert((controller >= i2cController::I2C1) && (controller <= i2cController::I2C6));
+    return baseAddresses[controller - i2cController::I2C1];
+}
+
+I2cController::I2cController(uint32_t controller, uint32_t moduleClockHz) : i2c(getBaseAddress(controller)),
+    controllerId(controller - i2cController::I2C1), moduleClockHz(moduleClockHz)
+{
+    assert(moduleClockHz > 0);
+}
+
+uint32_t I2cController::configure(uint32_t busHz)
+{
+    i2c.setRegister(I2C_I2C_CNFG_0::addressOffset,
+        (i2cController::DEBOUNCE_CNT_BIT_2_CLOCKS << I2C_I2C_CNFG_0::DEBOUNCE_CNT_bit) |
+        (1 << I2C_I2C_CNFG_0::NEW_MASTER_FSM_bit) |
+        (1 << I2C_I2C_CNFG_0::PACKET_MODE_EN_bit));
+
+    // Polled, nothing goes to the interrupt controller
+    i2c.setRegister(I2C_INTERRUPT_MASK_REGISTER_0::addressOffset, 0);
+
+    return setBusSpeed(busHz);
+}
+
+uint32_t I2cController::setBusSpeed(uint32_t busHz)
+{
+    assert(busHz > 0);
+
+    // SCL = module clock/((TLOW + THIGH + 2)*(STD_FAST_MODE + 1)), keep the timing the kernel left
+    uint32_t tLow = i2c.getRegisterField(I2C_I2C_INTERFACE_TIMING_0_0::addressOffset, I2C_I2C_INTERFACE_TIMING_0_0::TLOW_bit, I2C_I2C_INTERFACE_TIMING_0_0::TLOW_bitWidth);
+    uint32_t tHigh = i2c.getRegisterField(I2C_I2C_INTERFACE_TIMING_0_0::addressOffset, I2C_I2C_INTERFACE_TIMING_0_0::THIGH_bit, I2C_I2C_INTERFACE_TIMING_0_0::THIGH_bitWidth);
+    uint64_t cycles = tLow + tHigh + 2;
+
+    // Round the divisor up so SCL never exceeds what was asked for
+    uint64_t divisor = (moduleClockHz + (cycles*busHz) - 1)/(cycles*busHz);
+    divisor = (divisor == 0) ? 0 : divisor - 1;
+    if(divisor > 0xFFFF)
+    {
+        divisor = 0xFFFF;
+    }
+
+    i2c.setRegisterField(I2C_I2C_CLK_DIVISOR_REGISTER_0::addressOffset, divisor, I2C_I2C_CLK_DIVISOR_REGISTER_0::STD_FAST_MODE_bit, I2C_I2C_CLK_DIVISOR_REGISTER_0::STD_FAST_MODE_bitWidth);
+    if(!loadConfiguration())
+    {
+        return 0;
+    }
+
+    return moduleClockHz/(cycles*(divisor + 1));
+}
+
+uint32_t I2cController::writeRead(uint8_t address, const uint8_t* writeData, uint32_t writeLength, uint8_t* readData, uint32_t readLength)
+{
+    I2cTransaction transaction;
+    transaction.address = address;
+    transaction.writeData = writeData;
+    transaction.writeLength = writeLength;
+    transaction.readData = readData;
+    transaction.readLength = readLength;
+
+    singleQueue.words.clear();
+    singleQueue.entries.clear();
+    compile(singleQueue, transaction);
+    execute(singleQueue);
+
+    return singleQueue.entries[0].status;
+}
+
+uint32_t I2cController::write(uint8_t address, const uint8_t* writeData, uint32_t writeLength)
+{
+    return writeRead(address, writeData, writeLength, NULL, 0);
+}
+
+uint32_t I2cController::read(uint8_t address, uint8_t* readData, uint32_t readLength)
+{
+    return writeRead(address, NULL, 0, readData, readLength);
+}
+
+uint32_t I2cController::addTransaction(const I2cTransaction& transaction)
+{
+    compile(preparedQueue, transaction);
+    return preparedQueue.entries.size() - 1;
+}
+
+void I2cController::clearTransactions()
+{
+    preparedQueue.words.clear();
+    preparedQueue.entries.clear();
+}
+
+uint32_t I2cController::getNumberOfTransactions()
+{
+    return preparedQueue.entries.size();
+}
+
+uint32_t I2cController::runTransactions()
+{
+    return execute(preparedQueue);
+}
+
+uint32_t I2cController::getTransactionStatus(uint32_t index)
+{
+    assert(index < preparedQueue.entries.size());
+    return preparedQueue.entries[index].status;
+}
+
+/*
+ * Appends the packets of one transaction to the queue: a write packet, a
+ * read packet, or a write packet ending in a repeated start followed by a
+ * read packet. Both packets carry the transaction index as their packet id
+ * so a failure reported by PACKET_TRANSFER_STATUS can be traced back.
+ */
+void I2cController::compile(Queue& queue, const I2cTransaction& transaction)
+{
+    assert(transaction.address <= i2cController::MAX_ADDRESS);
+    assert((transaction.writeLength > 0) || (transaction.readLength > 0));
+    assert((transaction.writeLength == 0) || (transaction.writeData != NULL));
+    assert((transaction.readLength == 0) || (transaction.readData != NULL));
+    assert(transaction.writeLength <= i2cController::MAX_PAYLOAD);
+    assert(transaction.readLength <= i2cController::MAX_PAYLOAD);
+
+    Entry entry;
+    entry.firstWord = queue.words.size();
+    entry.readData = transaction.readData;
+    entry.readLength = transaction.readLength;
+    entry.status = i2cController::STATUS_PENDING;
+
+    uint32_t packetId = queue.entries.size() & ((1 << i2cPacketHeader::PACKET_ID_bitWidth) - 1);
+    uint32_t genericHeader = (0 << i2cPacketHeader::HEADER_SIZE_bit) | (packetId << i2cPacketHeader::PACKET_ID_bit) |
+        (controllerId << i2cPacketHeader::CONT_ID_bit) | i2cPacketHeader::PROTOCOL_I2C;
+    uint32_t addressHeader = (uint32_t)transaction.address << i2cPacketHeader::SLAVE_ADDRESS_bit;
+
+    if(transaction.writeLength > 0)
+    {
+        queue.words.push_back(genericHeader);
+        queue.words.push_back(transaction.writeLength - 1);
+        queue.words.push_back(addressHeader | ((transaction.readLength > 0) ? i2cPacketHeader::REPEAT_START : 0));
+
+        for(uint32_t i = 0; i < transaction.writeLength; i += i2cController::BYTES_PER_WORD)
+        {
+            uint32_t word = 0;
+            for(uint32_t j = 0; (j < i2cController::BYTES_PER_WORD) && ((i + j) < transaction.writeLength); j++)
+            {
+                word |= (uint32_t)transaction.writeData[i + j] << (8*j);
+            }
+            queue.words.push_back(word);
+        }
+    }
+
+    if(transaction.readLength > 0)
+    {
+        queue.words.push_back(genericHeader);
+        queue.words.push_back(transaction.readLength - 1);
+        queue.words.push_back(addressHeader | i2cPacketHeader::READ);
+    }
+
+    entry.numberOfWords = queue.words.size() - entry.firstWord;
+    queue.entries.push_back(entry);
+}
+
+/*
+ * Streams the queue through the FIFOs. Every pass tops up the TX FIFO,
+ * drains whatever read data is waiting, then checks for an error. On a
+ * missing acknowledge or lost arbitration the failing transaction is found
+ * from the packet id, the FIFOs are flushed and streaming restarts with the
+ * transaction after it.
+ */
+uint32_t I2cController::execute(Queue& queue)
+{
+    uint32_t numberOfEntries = queue.entries.size();
+    if(numberOfEntries == 0)
+    {
+        return 0;
+    }
+
+    volatile uint32_t* txFifo = i2c.getRegisterAddress(I2C_I2C_TX_PACKET_FIFO_0::addressOffset);
+    volatile uint32_t* fifoStatus = i2c.getRegisterAddress(I2C_FIFO_STATUS_0::addressOffset);
+    volatile uint32_t* interruptStatus = i2c.getRegisterAddress(I2C_INTERRUPT_STATUS_REGISTER_0::addressOffset);
+    volatile uint32_t* packetStatus = i2c.getRegisterAddress(I2C_PACKET_TRANSFER_STATUS_0::addressOffset);
+
+    const uint32_t errorMask = (1 << I2C_INTERRUPT_STATUS_REGISTER_0::NOACK_bit) | (1 << I2C_INTERRUPT_STATUS_REGISTER_0::ARB_LOST_bit);
+    const uint32_t* words = queue.words.data();
+    Entry* entries = queue.entries.data();
+
+    for(uint32_t i = 0; i < numberOfEntries; i++)
+    {
+        entries[i].status = i2cController::STATUS_PENDING;
+    }
+
+    if(!recover())
+    {
+        failPending(queue, i2cController::STATUS_TIMEOUT);
+        return 0;
+    }
+
+    uint32_t txEntry = 0;   // entry the next TX word belongs to
+    uint32_t txWord = 0;    // next word of queue.words to push
+    uint32_t rxEntry = 0;   // entry waiting for read data
+    uint32_t rxByte = 0;    // bytes of rxEntry already received
+    uint32_t lastPacketId = (numberOfEntries - 1) & ((1 << i2cPacketHeader::PACKET_ID_bitWidth) - 1);
+    uint64_t lastProgress = Timestamp::now();
+
+    while(true)
+    {
+        bool progress = false;
+
+        uint32_t txSpace = (*fifoStatus >> I2C_FIFO_STATUS_0::TX_FIFO_EMPTY_CNT_bit) & ((1 << I2C_FIFO_STATUS_0::TX_FIFO_EMPTY_CNT_bitWidth) - 1);
+        for(; (txSpace > 0) && (txWord < queue.words.size()); txSpace--)
+        {
+            *txFifo = words[txWord++];
+            while((txEntry < numberOfEntries) && (txWord >= (entries[txEntry].firstWord + entries[txEntry].numberOfWords)))
+            {
+                txEntry++;
+            }
+            progress = true;
+        }
+
+        if(progress)
+        {
+            // The new words take microseconds on the bus, so a set bit from here on means they are done
+            *interruptStatus = 1 << I2C_INTERRUPT_STATUS_REGISTER_0::ALL_PACKETS_XFER_COMPLETE_bit;
+        }
+
+        if(drainRxFifo(queue, rxEntry, rxByte))
+        {
+            progress = true;
+        }
+
+        uint32_t interrupts = *interruptStatus;
+        if((interrupts & errorMask) != 0)
+        {
+            uint32_t transfer = *packetStatus;
+            uint32_t failedId = (transfer >> I2C_PACKET_TRANSFER_STATUS_0::TRANSFER_PKT_ID_bit) & ((1 << I2C_PACKET_TRANSFER_STATUS_0::TRANSFER_PKT_ID_bitWidth) - 1);
+
+            // Only a few transactions fit in the FIFO, the newest one with the id is the one on the bus
+            uint32_t failed = (txEntry < numberOfEntries) ? txEntry : numberOfEntries - 1;
+            while((failed > 0) && ((failed & ((1 << i2cPacketHeader::PACKET_ID_bitWidth) - 1)) != failedId))
+            {
+                failed--;
+            }
+
+            // Read data of the transactions before it is already in the RX FIFO
+            drainRxFifo(queue, rxEntry, rxByte);
+
+            for(uint32_t i = 0; i < failed; i++)
+            {
+                if(entries[i].status == i2cController::STATUS_PENDING)
+                {
+                    entries[i].status = i2cController::STATUS_OK;
+                }
+            }
+            entries[failed].status = ((interrupts & (1 << I2C_INTERRUPT_STATUS_REGISTER_0::ARB_LOST_bit)) != 0) ?
+                i2cController::STATUS_ARBITRATION_LOST : i2cController::STATUS_NO_ACK;
+
+            if(!recover())
+            {
+                failPending(queue, i2cController::STATUS_TIMEOUT);
+                break;
+            }
+
+            if((failed + 1) >= numberOfEntries)
+            {
+                break;
+            }
+            txEntry = failed + 1;
+            txWord = entries[txEntry].firstWord;
+            rxEntry = failed + 1;
+            rxByte = 0;
+            lastProgress = Timestamp::now();
+            continue;
+        }
+
+        while((rxEntry < numberOfEntries) && (rxByte >= entries[rxEntry].readLength))
+        {
+            rxEntry++;
+            rxByte = 0;
+        }
+
+        if((txWord >= queue.words.size()) && (rxEntry >= numberOfEntries))
+        {
+            uint32_t transfer = *packetStatus;
+            uint32_t completeId = (transfer >> I2C_PACKET_TRANSFER_STATUS_0::TRANSFER_PKT_ID_bit) & ((1 << I2C_PACKET_TRANSFER_STATUS_0::TRANSFER_PKT_ID_bitWidth) - 1);
+            if((((transfer >> I2C_PACKET_TRANSFER_STATUS_0::TRANSFER_COMPLETE_bit) & 1) != 0) && (completeId == lastPacketId) &&
+                (((interrupts >> I2C_INTERRUPT_STATUS_REGISTER_0::ALL_PACKETS_XFER_COMPLETE_bit) & 1) != 0))
+            {
+                break;
+            }
+        }
+
+        if(progress)
+        {
+            lastProgress = Timestamp::now();
+        }
+        else if((Timestamp::now() - lastProgress) > i2cController::TIMEOUT_NS)
+        {
+            failPending(queue, i2cController::STATUS_TIMEOUT);
+            recover();
+            break;
+        }
+    }
+
+    uint32_t succeeded = 0;
+    for(uint32_t i = 0; i < numberOfEntries; i++)
+    {
+        if(entries[i].status == i2cController::STATUS_PENDING)
+        {
+            entries[i].status = i2cController::STATUS_OK;
+        }
+        if(entries[i].status == i2cController::STATUS_OK)
+        {
+            succeeded++;
+        }
+    }
+
+    return succeeded;
+}
+
+/*
+ * Pops every word waiting in the RX FIFO into the read buffers, starting at
+ * rxByte of entry rxEntry. Read data of one transaction always starts on a
+ * fresh word. Returns whether anything was read.
+ */
+bool I2cController::drainRxFifo(Queue& queue, uint32_t& rxEntry, uint32_t& rxByte)
+{
+    volatile uint32_t* rxFifo = i2c.getRegisterAddress(I2C_I2C_RX_FIFO_0::addressOffset);
+    uint32_t numberOfEntries = queue.entries.size();
+    Entry* entries = queue.entries.data();
+    bool drained = false;
+
+    uint32_t rxCount = i2c.getRegisterField(I2C_FIFO_STATUS_0::addressOffset, I2C_FIFO_STATUS_0::RX_FIFO_FULL_CNT_bit, I2C_FIFO_STATUS_0::RX_FIFO_FULL_CNT_bitWidth);
+    for(; rxCount > 0; rxCount--)
+    {
+        while((rxEntry < numberOfEntries) && (rxByte >= entries[rxEntry].readLength))
+        {
+            rxEntry++;
+            rxByte = 0;
+        }
+        if(rxEntry >= numberOfEntries)
+        {
+            break;
+        }
+
+        uint32_t word = *rxFifo;
+        for(uint32_t j = 0; (j < i2cController::BYTES_PER_WORD) && (rxByte < entries[rxEntry].readLength); j++, rxByte++)
+        {
+            entries[rxEntry].readData[rxByte] = (uint8_t)(word >> (8*j));
+        }
+        drained = true;
+    }
+
+    return drained;
+}
+
+// Every transaction of the queue still pending gets status
+void I2cController::failPending(Queue& queue, uint32_t status)
+{
+    for(uint32_t i = 0; i < queue.entries.size(); i++)
+    {
+        if(queue.entries[i].status == i2cController::STATUS_PENDING)
+        {
+            queue.entries[i].status = status;
+        }
+    }
+}
+
+// Empties both FIFOs and clears every latched status bit, false if the flush never finished
+bool I2cController::recover()
+{
+    volatile uint32_t* fifoControl = i2c.getRegisterAddress(I2C_FIFO_CONTROL_0::addressOffset);
+    uint32_t flushMask = (1 << I2C_FIFO_CONTROL_0::TX_FIFO_FLUSH_bit) | (1 << I2C_FIFO_CONTROL_0::RX_FIFO_FLUSH_bit);
+
+    *fifoControl = *fifoControl | flushMask;
+    uint64_t start = Timestamp::now();
+    while((*fifoControl & flushMask) != 0)
+    {
+        if((Timestamp::now() - start) > i2cController::TIMEOUT_NS)
+        {
+            return false;
+        }
+    }
+
+    i2c.setRegister(I2C_INTERRUPT_STATUS_REGISTER_0::addressOffset, 0xFFFFFFFF);
+    return true;
+}
+
+// False if the controller did not take the new configuration in time
+bool I2cController::loadConfiguration()
+{
+    volatile uint32_t* configLoad = i2c.getRegisterAddress(I2C_I2C_CONFIG_LOAD_0::addressOffset);
+
+    *configLoad = 1 << I2C_I2C_CONFIG_LOAD_0::MSTR_CONFIG_LOAD_bit;
+    uint64_t start = Timestamp::now();
+    while((*configLoad & (1 << I2C_I2C_CONFIG_LOAD_0::MSTR_CONFIG_LOAD_bit)) != 0)
+    {
+        if((Timestamp::now() - start) > i2cController::TIMEOUT_NS)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void I2cController::attachHeaderBus(uint32_t headerBus)
+{
+    PeripheralController myPinMuxController(pinmuxController::baseAddress);
+    PeripheralController myGpioController(gpioController::gpioController1BaseAddress);
+
+    if(headerBus == i2cController::HEADER_I2C0)
+    {
+        // Header pins #27, #28, Tegra I2C1 (GEN1_I2C), GPIO Port PJ.00 - PJ.01
+        attachPad<PINMUX_AUX_GEN1_I2C_SDA_0>(myPinMuxController, pinmuxController::PM_BIT_I2C1);
+        attachPad<PINMUX_AUX_GEN1_I2C_SCL_0>(myPinMuxController, pinmuxController::PM_BIT_I2C1);
+        myGpioController.setRegister(gpioPortOffset(gpioPort::PJ, GPIO_MSK_CNF_0::addressOffset), gpioMaskedValue(0x03, gpioController::BIT_N_SPIO));
+    }
+    else if(headerBus == i2cController::HEADER_I2C1)
+    {
+        // Header pins #3, #5, Tegra I2C2 (GEN2_I2C), GPIO Port PJ.02 - PJ.03
+        attachPad<PINMUX_AUX_GEN2_I2C_SDA_0>(myPinMuxController, pinmuxController::PM_BIT_I2C2);
+        attachPad<PINMUX_AUX_GEN2_I2C_SCL_0>(myPinMuxController, pinmuxController::PM_BIT_I2C2);
+        myGpioController.setRegister(gpioPortOffset(gpioPort::PJ, GPIO_MSK_CNF_0::addressOffset), gpioMaskedValue(0x0C, gpioController::BIT_N_SPIO));
+    }
+    else
+    {
+        assert(!"the header only has I2C0 and I2C1");
+    }
+}
@@ -0,0 +1,389 @@
+/**
+ * @file i2cController.h
+ * @brief I2C controller register declaration and class declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano I2C controller direct register access drivers
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class I2cController
+ * @brief Polled I2C master on the Tegra I2C controllers, packet mode
+ *
+ * @section Description
+ *
+ * The header's two buses:
+ * ______________________________________________________________________
+ * Header Bus | Controller | Base Address | Pins (header #) | GPIO Port
+ * I2C0       | I2C1       | 0x7000c000   | SDA 27, SCL 28  | PJ.00, PJ.01
+ * I2C1       | I2C2       | 0x7000c400   | SDA 3, SCL 5    | PJ.03, PJ.02
+ *
+ * In packet mode every message is three header words followed by the
+ * payload, all pushed through the 8 word TX FIFO. Read data comes back
+ * through the 8 word RX FIFO. A transaction here is an optional write and
+ * an optional read to one device, joined by a repeated start, for example
+ * a register address followed by the register contents.
+ *
+ * Transactions are compiled into one word stream up front with
+ * addTransaction(). runTransactions() then keeps the TX FIFO topped up and
+ * the RX FIFO drained in the same loop, so the controller always has the
+ * next packet queued and the bus never idles between devices. A device
+ * that does not acknowledge only fails its own transaction, the rest of the
+ * batch carries on from the next one.
+ *
+ * The module clock must be enabled and the controller out of reset, which
+ * the kernel does while i2c-dev has the bus open, or CarController::bringUp.
+ * moduleClockHz is the rate it runs at (/sys/kernel/debug/clk/i2c1/clk_rate,
+ * or what CarController::setClockRate returned), setBusSpeed() divides it
+ * down to SCL.
+ */
+
+#ifndef I2C_CONTROLLER_H
+#define I2C_CONTROLLER_H
+
+#include <cstdint>
+#include <vector>
+
+#include "../peripheralController/peripheralController.h"
+
+struct i2cController
+{
+    static const uint32_t I2C1_baseAddress = 0x7000c000;
+    static const uint32_t I2C2_baseAddress = 0x7000c400;
+    static const uint32_t I2C3_baseAddress = 0x7000c500;
+    static const uint32_t I2C4_baseAddress = 0x7000c700;
+    static const uint32_t I2C5_baseAddress = 0x7000d000;
+    static const uint32_t I2C6_baseAddress = 0x7000d100;
+
+    static const uint32_t I2C1 = 1;
+    static const uint32_t I2C2 = 2;
+    static const uint32_t I2C3 = 3;
+    static const uint32_t I2C4 = 4;
+    static const uint32_t I2C5 = 5;
+    static const uint32_t I2C6 = 6;
+
+    static const uint32_t HEADER_I2C0 = 0;
+    static const uint32_t HEADER_I2C1 = 1;
+
+    static const uint32_t STANDARD_MODE_HZ = 100000;
+    static const uint32_t FAST_MODE_HZ = 400000;
+    static const uint32_t FAST_MODE_PLUS_HZ = 1000000;
+
+    static const uint32_t FIFO_DEPTH = 8; // 32 bit words
+    static const uint32_t BYTES_PER_WORD = 4;
+    static const uint32_t MAX_PAYLOAD = 4096;
+    static const uint32_t MAX_ADDRESS = 0x7F;
+
+    static const uint64_t TIMEOUT_NS = 10000000; // no FIFO progress, flush or config load for this long fails the rest of the batch
+
+    // Per transaction result of runTransactions()
+    static const uint32_t STATUS_OK = 0;
+    static const uint32_t STATUS_NO_ACK = 1;
+    static const uint32_t STATUS_ARBITRATION_LOST = 2;
+    static const uint32_t STATUS_TIMEOUT = 3;
+    static const uint32_t STATUS_PENDING = 4;
+
+    static const uint32_t DEBOUNCE_CNT_BIT_2_CLOCKS = 1;
+};
+
+// Packet mode header words
+struct i2cPacketHeader
+{
+    // Word 0, generic header
+    static const uint32_t HEADER_SIZE_bit = 28;
+    static const uint32_t PACKET_ID_bit = 16;
+    static const uint32_t PACKET_ID_bitWidth = 8;
+    static const uint32_t CONT_ID_bit = 12;
+    static const uint32_t PROTOCOL_I2C = 1 << 4;
+
+    // Word 1 is the payload size in bytes - 1
+
+    // Word 2, I2C specific header
+    static const uint32_t CONT_ON_NAK = 1 << 21;
+    static const uint32_t READ = 1 << 19;
+    static const uint32_t ADDRESS_10BIT = 1 << 18;
+    static const uint32_t IE_ENABLE = 1 << 17;
+    static const uint32_t REPEAT_START = 1 << 16;
+    static const uint32_t CONTINUE_XFER = 1 << 15;
+    static const uint32_t SLAVE_ADDRESS_bit = 1;
+};
+
+// I2C_I2C_CNFG_0
+struct I2C_I2C_CNFG_0
+{
+    static const uint32_t addressOffset = 0x000;
+
+    static const uint32_t MULTI_MASTER_MODE_bit = 17;
+    static const uint32_t MULTI_MASTER_MODE_bitWidth = 1;
+
+    static const uint32_t DEBOUNCE_CNT_bit = 12;
+    static const uint32_t DEBOUNCE_CNT_bitWidth = 3;
+
+    static const uint32_t NEW_MASTER_FSM_bit = 11;
+    static const uint32_t NEW_MASTER_FSM_bitWidth = 1;
+
+    static const uint32_t PACKET_MODE_EN_bit = 10;
+    static const uint32_t PACKET_MODE_EN_bitWidth = 1;
+};
+
+// I2C_I2C_STATUS_0
+struct I2C_I2C_STATUS_0
+{
+    static const uint32_t addressOffset = 0x01C;
+
+    static const uint32_t BUSY_bit = 8;
+    static const uint32_t BUSY_bitWidth = 1;
+};
+
+// I2C_I2C_TX_PACKET_FIFO_0, every store pushes one word
+struct I2C_I2C_TX_PACKET_FIFO_0
+{
+    static const uint32_t addressOffset = 0x050;
+};
+
+// I2C_I2C_RX_FIFO_0, every load pops one word
+struct I2C_I2C_RX_FIFO_0
+{
+    static const uint32_t addressOffset = 0x054;
+};
+
+// I2C_PACKET_TRANSFER_STATUS_0
+struct I2C_PACKET_TRANSFER_STATUS_0
+{
+    static const uint32_t addressOffset = 0x058;
+
+    static const uint32_t TRANSFER_COMPLETE_bit = 24;
+    static const uint32_t TRANSFER_COMPLETE_bitWidth = 1;
+
+    static const uint32_t TRANSFER_PKT_ID_bit = 16;
+    static const uint32_t TRANSFER_PKT_ID_bitWidth = 8;
+
+    static const uint32_t TRANSFER_BYTENUM_bit = 4;
+    static const uint32_t TRANSFER_BYTENUM_bitWidth = 12;
+
+    static const uint32_t NOACK_FOR_DATA_bit = 3;
+    static const uint32_t NOACK_FOR_DATA_bitWidth = 1;
+
+    static const uint32_t NOACK_FOR_ADDR_bit = 2;
+    static const uint32_t NOACK_FOR_ADDR_bitWidth = 1;
+
+    static const uint32_t ARB_LOST_bit = 1;
+    static const uint32_t ARB_LOST_bitWidth = 1;
+
+    static const uint32_t CONTROLLER_BUSY_bit = 0;
+    static const uint32_t CONTROLLER_BUSY_bitWidth = 1;
+};
+
+// I2C_FIFO_CONTROL_0
+struct I2C_FIFO_CONTROL_0
+{
+    static const uint32_t addressOffset = 0x05C;
+
+    static const uint32_t TX_FIFO_TRIG_bit = 5;
+    static const uint32_t TX_FIFO_TRIG_bitWidth = 3;
+
+    static const uint32_t RX_FIFO_TRIG_bit = 2;
+    static const uint32_t RX_FIFO_TRIG_bitWidth = 3;
+
+    static const uint32_t TX_FIFO_FLUSH_bit = 1;
+    static const uint32_t TX_FIFO_FLUSH_bitWidth = 1;
+
+    static const uint32_t RX_FIFO_FLUSH_bit = 0;
+    static const uint32_t RX_FIFO_FLUSH_bitWidth = 1;
+};
+
+// I2C_FIFO_STATUS_0
+struct I2C_FIFO_STATUS_0
+{
+    static const uint32_t addressOffset = 0x060;
+
+    static const uint32_t TX_FIFO_EMPTY_CNT_bit = 4;
+    static const uint32_t TX_FIFO_EMPTY_CNT_bitWidth = 4;
+
+    static const uint32_t RX_FIFO_FULL_CNT_bit = 0;
+    static const uint32_t RX_FIFO_FULL_CNT_bitWidth = 4;
+};
+
+// I2C_INTERRUPT_MASK_REGISTER_0
+struct I2C_INTERRUPT_MASK_REGISTER_0
+{
+    static const uint32_t addressOffset = 0x064;
+};
+
+// I2C_INTERRUPT_STATUS_REGISTER_0, write 1 to clear
+struct I2C_INTERRUPT_STATUS_REGISTER_0
+{
+    static const uint32_t addressOffset = 0x068;
+
+    static const uint32_t BUS_CLEAR_DONE_bit = 11;
+    static const uint32_t BUS_CLEAR_DONE_bitWidth = 1;
+
+    static const uint32_t PACKET_XFER_COMPLETE_bit = 7;
+    static const uint32_t PACKET_XFER_COMPLETE_bitWidth = 1;
+
+    static const uint32_t ALL_PACKETS_XFER_COMPLETE_bit = 6;
+    static const uint32_t ALL_PACKETS_XFER_COMPLETE_bitWidth = 1;
+
+    static const uint32_t TX_FIFO_OVF_bit = 5;
+    static const uint32_t TX_FIFO_OVF_bitWidth = 1;
+
+    static const uint32_t RX_FIFO_UNF_bit = 4;
+    static const uint32_t RX_FIFO_UNF_bitWidth = 1;
+
+    static const uint32_t NOACK_bit = 3;
+    static const uint32_t NOACK_bitWidth = 1;
+
+    static const uint32_t ARB_LOST_bit = 2;
+    static const uint32_t ARB_LOST_bitWidth = 1;
+
+    static const uint32_t TX_FIFO_DATA_REQ_bit = 1;
+    static const uint32_t TX_FIFO_DATA_REQ_bitWidth = 1;
+
+    static const uint32_t RX_FIFO_DATA_REQ_bit = 0;
+    static const uint32_t RX_FIFO_DATA_REQ_bitWidth = 1;
+};
+
+// I2C_I2C_CLK_DIVISOR_REGISTER_0
+struct I2C_I2C_CLK_DIVISOR_REGISTER_0
+{
+    static const uint32_t addressOffset = 0x06C;
+
+    static const uint32_t STD_FAST_MODE_bit = 16;
+    static const uint32_t STD_FAST_MODE_bitWidth = 16;
+
+    static const uint32_t HSMODE_bit = 0;
+    static const uint32_t HSMODE_bitWidth = 16;
+};
+
+// I2C_I2C_CONFIG_LOAD_0, self clearing once the shadow registers are loaded
+struct I2C_I2C_CONFIG_LOAD_0
+{
+    static const uint32_t addressOffset = 0x08C;
+
+    static const uint32_t TIMEOUT_CONFIG_LOAD_bit = 2;
+    static const uint32_t TIMEOUT_CONFIG_LOAD_bitWidth = 1;
+
+    static const uint32_t SLV_CONFIG_LOAD_bit = 1;
+    static const uint32_t SLV_CONFIG_LOAD_bitWidth = 1;
+
+    static const uint32_t MSTR_CONFIG_LOAD_bit = 0;
+    static const uint32_t MSTR_CONFIG_LOAD_bitWidth = 1;
+};
+
+// I2C_I2C_INTERFACE_TIMING_0_0
+struct I2C_I2C_INTERFACE_TIMING_0_0
+{
+    static const uint32_t addressOffset = 0x094;
+
+    static const uint32_t THIGH_bit = 8;
+    static const uint32_t THIGH_bitWidth = 6;
+
+    static const uint32_t TLOW_bit = 0;
+    static const uint32_t TLOW_bitWidth = 6;
+};
+
+struct I2cTransaction
+{
+    uint8_t address;           // 7 bit address
+    const uint8_t* writeData;  // copied by addTransaction
+    uint32_t writeLength;
+    uint8_t* readData;         // filled on every run
+    uint32_t readLength;
+};
+
+class I2cController
+{
+    public:
+        // i2cController::I2C1 through i2cController::I2C6
+        I2cController(uint32_t controller, uint32_t moduleClockHz);
+
+        I2cController(const I2cController&) = delete;
+        I2cController& operator=(const I2cController&) = delete;
+
+        /*
+         * Packet mode with the new master state machine, then the SCL rate.
+         * Returns the SCL rate actually produced, 0 if the controller did
+         * not load the new configuration within i2cController::TIMEOUT_NS.
+         */
+        uint32_t configure(uint32_t busHz);
+        uint32_t setBusSpeed(uint32_t busHz);
+
+        /*
+         * One transaction, write then read with a repeated start. Either
+         * length may be zero. Returns an i2cController::STATUS_ value.
+         */
+        uint32_t writeRead(uint8_t address, const uint8_t* writeData, uint32_t writeLength, uint8_t* readData, uint32_t readLength);
+        uint32_t write(uint8_t address, const uint8_t* writeData, uint32_t writeLength);
+        uint32_t read(uint8_t address, uint8_t* readData, uint32_t readLength);
+
+        /*
+         * The prepared queue. Transactions are compiled once and can be run
+         * any number of times, returns the index for getTransactionStatus.
+         */
+        uint32_t addTransaction(const I2cTransaction& transaction);
+        void clearTransactions();
+        uint32_t getNumberOfTransactions();
+
+        // Runs every queued transaction in order, returns how many succeeded.
+        uint32_t runTransactions();
+        uint32_t getTransactionStatus(uint32_t index);
+
+        /*
+         * Header bus i2cController::HEADER_I2C0 or HEADER_I2C1: pinmux to
+         * the I2C function with the input buffers on, out of tristate, and
+         * the GPIO controller handing the pins to the SFIO.
+         */
+        static void attachHeaderBus(uint32_t headerBus);
+
+    private:
+        struct Entry
+        {
+            uint32_t firstWord; // index into Queue::words
+            uint32_t numberOfWords;
+            uint8_t* readData;
+            uint32_t readLength;
+            uint32_t status;
+        };
+
+        struct Queue
+        {
+            std::vector<uint32_t> words;
+            std::vector<Entry> entries;
+        };
+
+        void compile(Queue& queue, const I2cTransaction& transaction);
+        uint32_t execute(Queue& queue);
+        bool drainRxFifo(Queue& queue, uint32_t& rxEntry, uint32_t& rxByte);
+        void failPending(Queue& queue, uint32_t status);
+        bool recover();
+        bool loadConfiguration();
+
+        PeripheralController i2c;
+        const uint32_t controllerId;
+        const uint32_t moduleClockHz;
+
+        Queue preparedQueue;
+        Queue singleQueue; // reused by writeRead so a single transaction does not allocate
+};
+
+#endif //I2C_CONTROLLER_H
@@ -0,0 +1,240 @@
+#include "i2sController.h"
+#include "../gpioController/gpio.h"
+#include "../gpioController/gpioPin.h"
+#include "../pinmuxController/pinmuxController.h"
+#include "../realTimeExecutor/realTimeExecutor.h"
+#include <cstdint>
+#include <cassert>
+#include <sched.h>
+
+static uint32_t getBitSize(uint32_t bitsPerSample)
+{
+    switch(bitsPerSample)
+    {
+        case 8:
+            return i2sController::BIT_SIZE_BIT_8;
+        case 16:
+            return i2sController::BIT_SIZE_BIT_16;
+        case 24:
+            return i2sController::BIT_SIZE_BIT_24;
+        case 32:
+            return i2sController::BIT_SIZE_BIT_32;
+        default:
+            assert(!"bitsPerSample must be 8, 16, 24 or 32");
+            return i2sController::BIT_SIZE_BIT_32;
+    }
+}
+
+I2sController::I2sController(uint32_t admaifChannel) : i2s(i2sController::I2S4_baseAddress), admaif(i2sController::admaifBaseAddress),
+    rxChannelOffset(admaifChannel*i2sController::ADMAIF_CHANNEL_STRIDE), txChannelOffset(admaifChannel*i2sController::ADMAIF_CHANNEL_STRIDE)
+{
+    assert(admaifChannel < i2sController::NUMBER_OF_ADMAIF_CHANNELS);
+
+    running = false;
+    samplesSent = 0;
+    samplesReceived = 0;
+    txUnderruns = 0;
+    rxDrops = 0;
+}
+
+I2sController::~I2sController()
+{
+    stopStreaming();
+}
+
+uint32_t I2sController::configure(uint32_t sampleRate, uint32_t bitsPerSample, uint32_t channels, bool master)
+{
+    // The stream loop would keep polling a disabled ADMAIF
+    assert(!running);
+    assert(sampleRate > 0);
+    assert((channels > 0) && (channels <= i2sController::MAX_CHANNELS));
+
+    uint32_t bitSize = getBitSize(bitsPerSample);
+    uint32_t actualRate = sampleRate;
+
+    enable(false);
+    i2s.setRegister(I2S_SOFT_RESET_0::addressOffset, 1 << I2S_SOFT_RESET_0::SOFT_RESET_bit);
+    while(i2s.getRegisterField(I2S_SOFT_RESET_0::addressOffset, I2S_SOFT_RESET_0::SOFT_RESET_bit, I2S_SOFT_RESET_0::SOFT_RESET_bitWidth) != 0)
+    {
+    }
+
+    if(master)
+    {
+        // The I2S4 module clock is the CAR's i2s3 clock and runs at the bit clock
+        uint32_t bitClock = sampleRate*channels*bitsPerSample;
+        uint32_t actualBitClock = clockAndReset.setClockRate(carController::I2S3, bitClock);
+        actualRate = actualBitClock/(channels*bitsPerSample);
+    }
+
+    i2s.setRegister(I2S_CTRL_0::addressOffset,
+        (i2sController::FRAME_FORMAT_BIT_LRCK << I2S_CTRL_0::FRAME_FORMAT_bit) |
+        ((master ? i2sController::MASTER_BIT_MASTER : i2sController::MASTER_BIT_SLAVE) << I2S_CTRL_0::MASTER_bit) |
+        (bitSize << I2S_CTRL_0::BIT_SIZE_bit));
+
+    // Bit clocks per LRCK half period - 1
+    i2s.setRegister(I2S_TIMING_0::addressOffset, (((channels*bitsPerSample)/2) - 1) << I2S_TIMING_0::CHANNEL_BIT_COUNT_bit);
+
+    // The crossbar side always carries 32 bit words, the I2S side the sample width
+    uint32_t cifControl = ((channels - 1) << AUDIO_CIF_CTRL::AUDIO_CHANNELS_bit) |
+        ((channels - 1) << AUDIO_CIF_CTRL::CLIENT_CHANNELS_bit) |
+        (i2sController::CIF_BITS_32 << AUDIO_CIF_CTRL::AUDIO_BITS_bit) |
+        (bitSize << AUDIO_CIF_CTRL::CLIENT_BITS_bit);
+    i2s.setRegister(I2S_AXBAR_RX_CIF_CTRL_0::addressOffset, cifControl);
+    i2s.setRegister(I2S_AXBAR_TX_CIF_CTRL_0::addressOffset, cifControl);
+
+    uint32_t admaifControl = ((channels - 1) << AUDIO_CIF_CTRL::AUDIO_CHANNELS_bit) |
+        ((channels - 1) << AUDIO_CIF_CTRL::CLIENT_CHANNELS_bit) |
+        (i2sController::CIF_BITS_32 << AUDIO_CIF_CTRL::AUDIO_BITS_bit) |
+        (i2sController::CIF_BITS_32 << AUDIO_CIF_CTRL::CLIENT_BITS_bit);
+    admaif.setRegister(rxChannelOffset + ADMAIF_CHAN_ACIF_RX_CTRL_0::addressOffset, admaifControl);
+    admaif.setRegister(txChannelOffset + ADMAIF_CHAN_ACIF_TX_CTRL_0::addressOffset, admaifControl);
+
+    return actualRate;
+}
+
+void I2sController::startStreaming(uint32_t ringSize, int cpu)
+{
+    assert(!running);
+
+    txRing.reset(new RingBuffer<uint32_t>(ringSize));
+    rxRing.reset(new RingBuffer<uint32_t>(ringSize));
+
+    enable(true);
+    running = true;
+    streamThread = std::thread(&I2sController::streamLoop, this, cpu);
+    RealTimeExecutor::raiseThreadPriority(streamThread);
+}
+
+void I2sController::stopStreaming()
+{
+    if(!running)
+    {
+        return;
+    }
+
+    running = false;
+    streamThread.join();
+    enable(false);
+}
+
+uint32_t I2sController::writeSamples(const uint32_t* samples, uint32_t count)
+{
+    assert(txRing);
+    return txRing->write(samples, count);
+}
+
+uint32_t I2sController::readSamples(uint32_t* samples, uint32_t count)
+{
+    assert(rxRing);
+    return rxRing->read(samples, count);
+}
+
+I2sStreamCounts I2sController::getCounts()
+{
+    I2sStreamCounts counts;
+    counts.samplesSent = samplesSent;
+    counts.samplesReceived = samplesReceived;
+    counts.txUnderruns = txUnderruns;
+    counts.rxDrops = rxDrops;
+    return counts;
+}
+
+/*
+ * Tops up the TX FIFO and empties the RX FIFO until stopped. Counts are
+ * kept in locals and published once per pass so the loop does not hammer
+ * the shared atomics. An underrun is counted once each time the FIFO is
+ * found empty with the ring empty too, not once per pass.
+ */
+void I2sController::streamLoop(int cpu)
+{
+    if(cpu >= 0)
+    {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(cpu, &cpuSet);
+        sched_setaffinity(0, sizeof(cpuSet), &cpuSet);
+    }
+
+    volatile uint32_t* txStatus = admaif.getRegisterAddress(txChannelOffset + ADMAIF_XBAR_TX_STATUS_0::addressOffset);
+    volatile uint32_t* txFifo = admaif.getRegisterAddress(txChannelOffset + ADMAIF_XBAR_TX_FIFO_WRITE_0::addressOffset);
+    volatile uint32_t* rxStatus = admaif.getRegisterAddress(rxChannelOffset + ADMAIF_XBAR_RX_STATUS_0::addressOffset);
+    volatile uint32_t* rxFifo = admaif.getRegisterAddress(rxChannelOffset + ADMAIF_XBAR_RX_FIFO_READ_0::addressOffset);
+    bool starved = false;
+
+    while(running)
+    {
+        uint64_t sent = 0;
+        uint64_t received = 0;
+        uint64_t dropped = 0;
+
+        uint32_t status = *txStatus;
+        while(((status >> ADMAIF_XBAR_TX_STATUS_0::FIFO_FULL_bit) & 1) == 0)
+        {
+            uint32_t sample;
+            if(!txRing->pop(sample))
+            {
+                bool empty = ((status >> ADMAIF_XBAR_TX_STATUS_0::FIFO_EMPTY_bit) & 1) != 0;
+                if(empty && !starved)
+                {
+                    txUnderruns++;
+                }
+                starved = empty;
+                break;
+            }
+            *txFifo = sample;
+            sent++;
+            starved = false;
+            status = *txStatus;
+        }
+
+        while(((*rxStatus >> ADMAIF_XBAR_RX_STATUS_0::FIFO_EMPTY_bit) & 1) == 0)
+        {
+            uint32_t sample = *rxFifo;
+            if(!rxRing->push(sample))
+            {
+                dropped++;
+            }
+            received++;
+        }
+
+        samplesSent += sent;
+        samplesReceived += received;
+        rxDrops += dropped;
+    }
+}
+
+// Enables run from the ADMAIF out to the pins, disables the other way round
+void I2sController::enable(bool on)
+{
+    uint32_t value = on ? 1 : 0;
+
+    if(on)
+    {
+        admaif.setRegisterField(ADMAIF_GLOBAL_ENABLE_0::addressOffset, 1, ADMAIF_GLOBAL_ENABLE_0::EN_bit, ADMAIF_GLOBAL_ENABLE_0::EN_bitWidth);
+        admaif.setRegisterField(txChannelOffset + ADMAIF_XBAR_TX_ENABLE_0::addressOffset, value, ADMAIF_XBAR_TX_ENABLE_0::EN_bit, ADMAIF_XBAR_TX_ENABLE_0::EN_bitWidth);
+        admaif.setRegisterField(rxChannelOffset + ADMAIF_XBAR_RX_ENABLE_0::addressOffset, value, ADMAIF_XBAR_RX_ENABLE_0::EN_bit, ADMAIF_XBAR_RX_ENABLE_0::EN_bitWidth);
+    }
+
+    i2s.setRegisterField(I2S_AXBAR_RX_ENABLE_0::addressOffset, value, I2S_AXBAR_RX_ENABLE_0::EN_bit, I2S_AXBAR_RX_ENABLE_0::EN_bitWidth);
+    i2s.setRegisterField(I2S_AXBAR_TX_ENABLE_0::addressOffset, value, I2S_AXBAR_TX_ENABLE_0::EN_bit, I2S_AXBAR_TX_ENABLE_0::EN_bitWidth);
+    i2s.setRegisterField(I2S_ENABLE_0::addressOffset, value, I2S_ENABLE_0::EN_bit, I2S_ENABLE_0::EN_bitWidth);
+
+    if(!on)
+    {
+        admaif.setRegisterField(txChannelOffset + ADMAIF_XBAR_TX_ENABLE_0::addressOffset, value, ADMAIF_XBAR_TX_ENABLE_0::EN_bit, ADMAIF_XBAR_TX_ENABLE_0::EN_bitWidth);
+        admaif.setRegisterField(rxChannelOffset + ADMAIF_XBAR_RX_ENABLE_0::addressOffset, value, ADMAIF_XBAR_RX_ENABLE_0::EN_bit, ADMAIF_XBAR_RX_ENABLE_0::EN_bitWidth);
+    }
+}
+
+void I2sController::attachHeaderPins()
+{
+    PeripheralController myPinMuxController(pinmuxController::baseAddress);
+    PeripheralController myGpioController(gpioController::gpioController1BaseAddress);
+
+    // Header pins #12, #35, #38, #40, Tegra DAP4, GPIO Port PJ.04 - PJ.07
+    attachPad<PINMUX_AUX_DAP4_FS_0>(myPinMuxController, pinmuxController::PM_BIT_I2S4B);
+    attachPad<PINMUX_AUX_DAP4_DIN_0>(myPinMuxController, pinmuxController::PM_BIT_I2S4B);
+    attachPad<PINMUX_AUX_DAP4_DOUT_0>(myPinMuxController, pinmuxController::PM_BIT_I2S4B);
+    attachPad<PINMUX_AUX_DAP4_SCLK_0>(myPinMuxController, pinmuxController::PM_BIT_I2S4B);
+    myGpioController.setRegister(gpioPortOffset(gpioPort::PJ, GPIO_MSK_CNF_0::addressOffset), gpioMaskedValue(0xF0, gpioController::BIT_N_SPIO));
+}
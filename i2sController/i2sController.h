@@ -0,0 +1,360 @@
+/**
+ * @file i2sController.h
+ * @brief I2S and ADMAIF register declaration and class declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano I2S controller direct register access drivers
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class I2sController
+ * @brief Continuous I2S streaming on DAP4 through the audio hub
+ *
+ * @section Description
+ *
+ * The header's I2S pins are DAP4, driven by the I2S4 block of the audio
+ * processing engine:
+ * ________________________________________________
+ * Header Pin # | Tegra Pin Name | Function | GPIO Port
+ * 12           | DAP4_SCLK      | SCLK     | PJ.07
+ * 35           | DAP4_FS        | LRCK/FS  | PJ.04
+ * 38           | DAP4_DIN       | DIN      | PJ.05
+ * 40           | DAP4_DOUT      | DOUT     | PJ.06
+ *
+ * On Tegra210 an I2S block has no FIFO the CPU can reach. Samples go
+ * through one of the ten ADMAIF channels at 0x702d0000, whose TX and RX
+ * FIFOs the CPU can write and read, and the audio crossbar connects that
+ * channel to I2S4. The crossbar is set up once through the ALSA mixer, for
+ * example with ADMAIF1:
+ *
+ *     amixer -c tegrasndt210ref cset name="I2S4 Mux" ADMAIF1
+ *     amixer -c tegrasndt210ref cset name="ADMAIF1 Mux" I2S4
+ *
+ * after which this class programs I2S4 and the ADMAIF channel directly and
+ * never goes through ALSA again.
+ *
+ * startStreaming() starts a thread that keeps the TX FIFO full from a
+ * lock-free ring and empties the RX FIFO into another one, so the
+ * application only ever touches the rings. The audio hub must be powered
+ * and clocked, which it is once the sound card has been opened.
+ */
+
+#ifndef I2S_CONTROLLER_H
+#define I2S_CONTROLLER_H
+
+#include <cstdint>
+#include <thread>
+#include <atomic>
+#include <memory>
+
+#include "../peripheralController/peripheralController.h"
+#include "../carController/carController.h"
+#include "../ringBuffer/ringBuffer.h"
+
+struct i2sController
+{
+    static const uint32_t I2S1_baseAddress = 0x702d1000;
+    static const uint32_t I2S_STRIDE = 0x100;
+    static const uint32_t I2S4_baseAddress = 0x702d1300;
+
+    static const uint32_t admaifBaseAddress = 0x702d0000;
+    static const uint32_t NUMBER_OF_ADMAIF_CHANNELS = 10;
+    static const uint32_t ADMAIF_CHANNEL_STRIDE = 0x40;
+    static const uint32_t ADMAIF_TX_OFFSET = 0x300; // TX registers follow the RX ones
+
+    // I2S_CTRL_0 BIT_SIZE
+    static const uint32_t BIT_SIZE_BIT_8 = 1;
+    static const uint32_t BIT_SIZE_BIT_16 = 3;
+    static const uint32_t BIT_SIZE_BIT_24 = 5;
+    static const uint32_t BIT_SIZE_BIT_32 = 7;
+
+    static const uint32_t FRAME_FORMAT_BIT_LRCK = 0;
+    static const uint32_t FRAME_FORMAT_BIT_FSYNC = 1;
+
+    static const uint32_t MASTER_BIT_SLAVE = 0;
+    static const uint32_t MASTER_BIT_MASTER = 1;
+
+    // Audio client interface bit widths, CIF_CTRL AUDIO_BITS and CLIENT_BITS
+    static const uint32_t CIF_BITS_8 = 1;
+    static const uint32_t CIF_BITS_16 = 3;
+    static const uint32_t CIF_BITS_24 = 5;
+    static const uint32_t CIF_BITS_32 = 7;
+
+    static const uint32_t MAX_CHANNELS = 16;
+    static const uint32_t DEFAULT_RING_SIZE = 16384; // samples
+};
+
+// I2S_AXBAR_RX_ENABLE_0, the I2S block receiving from the crossbar, towards DOUT
+struct I2S_AXBAR_RX_ENABLE_0
+{
+    static const uint32_t addressOffset = 0x00;
+
+    static const uint32_t EN_bit = 0;
+    static const uint32_t EN_bitWidth = 1;
+};
+
+// I2S_AXBAR_RX_CIF_CTRL_0
+struct I2S_AXBAR_RX_CIF_CTRL_0
+{
+    static const uint32_t addressOffset = 0x20;
+};
+
+// I2S_AXBAR_TX_ENABLE_0, the I2S block sending to the crossbar, from DIN
+struct I2S_AXBAR_TX_ENABLE_0
+{
+    static const uint32_t addressOffset = 0x40;
+
+    static const uint32_t EN_bit = 0;
+    static const uint32_t EN_bitWidth = 1;
+};
+
+// I2S_AXBAR_TX_CIF_CTRL_0
+struct I2S_AXBAR_TX_CIF_CTRL_0
+{
+    static const uint32_t addressOffset = 0x60;
+};
+
+// I2S_ENABLE_0
+struct I2S_ENABLE_0
+{
+    static const uint32_t addressOffset = 0x80;
+
+    static const uint32_t EN_bit = 0;
+    static const uint32_t EN_bitWidth = 1;
+};
+
+// I2S_SOFT_RESET_0, self clearing
+struct I2S_SOFT_RESET_0
+{
+    static const uint32_t addressOffset = 0x84;
+
+    static const uint32_t SOFT_RESET_bit = 0;
+    static const uint32_t SOFT_RESET_bitWidth = 1;
+};
+
+// I2S_CTRL_0
+struct I2S_CTRL_0
+{
+    static const uint32_t addressOffset = 0xA0;
+
+    static const uint32_t FRAME_FORMAT_bit = 12;
+    static const uint32_t FRAME_FORMAT_bitWidth = 3;
+
+    static const uint32_t MASTER_bit = 10;
+    static const uint32_t MASTER_bitWidth = 1;
+
+    static const uint32_t LRCK_POLARITY_bit = 9;
+    static const uint32_t LRCK_POLARITY_bitWidth = 1;
+
+    static const uint32_t LPBK_bit = 8;
+    static const uint32_t LPBK_bitWidth = 1;
+
+    static const uint32_t BIT_SIZE_bit = 0;
+    static const uint32_t BIT_SIZE_bitWidth = 3;
+};
+
+// I2S_TIMING_0
+struct I2S_TIMING_0
+{
+    static const uint32_t addressOffset = 0xA4;
+
+    static const uint32_t NON_SYM_bit = 12;
+    static const uint32_t NON_SYM_bitWidth = 1;
+
+    static const uint32_t CHANNEL_BIT_COUNT_bit = 0;
+    static const uint32_t CHANNEL_BIT_COUNT_bitWidth = 11;
+};
+
+// Audio client interface control, the same layout in every CIF_CTRL register
+struct AUDIO_CIF_CTRL
+{
+    static const uint32_t AUDIO_CHANNELS_bit = 20;
+    static const uint32_t AUDIO_CHANNELS_bitWidth = 4;
+
+    static const uint32_t CLIENT_CHANNELS_bit = 16;
+    static const uint32_t CLIENT_CHANNELS_bitWidth = 4;
+
+    static const uint32_t AUDIO_BITS_bit = 12;
+    static const uint32_t AUDIO_BITS_bitWidth = 4;
+
+    static const uint32_t CLIENT_BITS_bit = 8;
+    static const uint32_t CLIENT_BITS_bitWidth = 4;
+};
+
+// ADMAIF_XBAR_RX_ENABLE_0, channel n at addressOffset + n*ADMAIF_CHANNEL_STRIDE
+struct ADMAIF_XBAR_RX_ENABLE_0
+{
+    static const uint32_t addressOffset = 0x00;
+
+    static const uint32_t EN_bit = 0;
+    static const uint32_t EN_bitWidth = 1;
+};
+
+// ADMAIF_XBAR_RX_SOFT_RESET_0
+struct ADMAIF_XBAR_RX_SOFT_RESET_0
+{
+    static const uint32_t addressOffset = 0x04;
+};
+
+// ADMAIF_XBAR_RX_STATUS_0
+struct ADMAIF_XBAR_RX_STATUS_0
+{
+    static const uint32_t addressOffset = 0x0C;
+
+    static const uint32_t FIFO_EMPTY_bit = 2;
+    static const uint32_t FIFO_EMPTY_bitWidth = 1;
+
+    static const uint32_t FIFO_FULL_bit = 1;
+    static const uint32_t FIFO_FULL_bitWidth = 1;
+};
+
+// ADMAIF_CHAN_ACIF_RX_CTRL_0
+struct ADMAIF_CHAN_ACIF_RX_CTRL_0
+{
+    static const uint32_t addressOffset = 0x20;
+};
+
+// ADMAIF_XBAR_RX_FIFO_READ_0, every load pops one sample
+struct ADMAIF_XBAR_RX_FIFO_READ_0
+{
+    static const uint32_t addressOffset = 0x2C;
+};
+
+// ADMAIF_XBAR_TX_ENABLE_0
+struct ADMAIF_XBAR_TX_ENABLE_0
+{
+    static const uint32_t addressOffset = 0x300;
+
+    static const uint32_t EN_bit = 0;
+    static const uint32_t EN_bitWidth = 1;
+};
+
+// ADMAIF_XBAR_TX_SOFT_RESET_0
+struct ADMAIF_XBAR_TX_SOFT_RESET_0
+{
+    static const uint32_t addressOffset = 0x304;
+};
+
+// ADMAIF_XBAR_TX_STATUS_0
+struct ADMAIF_XBAR_TX_STATUS_0
+{
+    static const uint32_t addressOffset = 0x30C;
+
+    static const uint32_t FIFO_EMPTY_bit = 2;
+    static const uint32_t FIFO_EMPTY_bitWidth = 1;
+
+    static const uint32_t FIFO_FULL_bit = 1;
+    static const uint32_t FIFO_FULL_bitWidth = 1;
+};
+
+// ADMAIF_CHAN_ACIF_TX_CTRL_0
+struct ADMAIF_CHAN_ACIF_TX_CTRL_0
+{
+    static const uint32_t addressOffset = 0x320;
+};
+
+// ADMAIF_XBAR_TX_FIFO_WRITE_0, every store pushes one sample
+struct ADMAIF_XBAR_TX_FIFO_WRITE_0
+{
+    static const uint32_t addressOffset = 0x32C;
+};
+
+// ADMAIF_GLOBAL_ENABLE_0
+struct ADMAIF_GLOBAL_ENABLE_0
+{
+    static const uint32_t addressOffset = 0x700;
+
+    static const uint32_t EN_bit = 0;
+    static const uint32_t EN_bitWidth = 1;
+};
+
+struct I2sStreamCounts
+{
+    uint64_t samplesSent;
+    uint64_t samplesReceived;
+    uint64_t txUnderruns;  // the TX FIFO ran empty with nothing left in the ring
+    uint64_t rxDrops;      // received samples lost to a full RX ring
+};
+
+class I2sController
+{
+    public:
+        // admaifChannel 0 - 9, the one the crossbar connects to I2S4
+        I2sController(uint32_t admaifChannel);
+        ~I2sController();
+
+        I2sController(const I2sController&) = delete;
+        I2sController& operator=(const I2sController&) = delete;
+
+        /*
+         * LRCK framing, bitsPerSample 8, 16, 24 or 32 per channel. As master
+         * the bit clock comes from PLLP through the CAR divider and the
+         * actual frame rate is returned, as slave SCLK and FS come from the
+         * other end and sampleRate is returned unchanged. Not while
+         * streaming, stopStreaming() first.
+         */
+        uint32_t configure(uint32_t sampleRate, uint32_t bitsPerSample, uint32_t channels, bool master);
+
+        /*
+         * Streaming thread, pinned to cpu when it is not -1. Samples are
+         * one 32 bit word per channel, interleaved.
+         */
+        void startStreaming(uint32_t ringSize = i2sController::DEFAULT_RING_SIZE, int cpu = -1);
+        void stopStreaming();
+
+        // Producer side of the TX ring, returns how many samples fit.
+        uint32_t writeSamples(const uint32_t* samples, uint32_t count);
+        // Consumer side of the RX ring, returns how many samples were read.
+        uint32_t readSamples(uint32_t* samples, uint32_t count);
+
+        I2sStreamCounts getCounts();
+
+        /*
+         * Header pins 12, 35, 38 and 40: pinmux to I2S4B, input buffers on,
+         * out of tristate, and the GPIO controller handing PJ.04 - PJ.07 to
+         * the SFIO.
+         */
+        static void attachHeaderPins();
+
+    private:
+        void streamLoop(int cpu);
+        void enable(bool on);
+
+        PeripheralController i2s;
+        PeripheralController admaif;
+        CarController clockAndReset;
+        const uint32_t rxChannelOffset;
+        const uint32_t txChannelOffset;
+
+        std::unique_ptr<RingBuffer<uint32_t>> txRing;
+        std::unique_ptr<RingBuffer<uint32_t>> rxRing;
+        std::thread streamThread;
+        std::atomic<bool> running;
+
+        std::atomic<uint64_t> samplesSent;
+        std::atomic<uint64_t> samplesReceived;
+        std::atomic<uint64_t> txUnderruns;
+        std::atomic<uint64_t> rxDrops;
+};
+
+#endif //I2S_CONTROLLER_H
@@ -0,0 +1,416 @@
+#include "padGroupController.h"
+#include <cstdint>
+#include <algorithm>
+#include <cassert>
+
+// Where a pad group keeps its drive and slew fields, a width of 0 means it has none
+struct PadGroupFields
+{
+    uint32_t addressOffset;
+    uint32_t driveUpBit;
+    uint32_t driveUpBitWidth;
+    uint32_t driveDownBit;
+    uint32_t driveDownBitWidth;
+    uint32_t slewRiseBit;
+    uint32_t slewRiseBitWidth;
+    uint32_t slewFallBit;
+    uint32_t slewFallBitWidth;
+};
+
+template<typename PAD_CFG>
+static PadGroupFields driveFields()
+{
+    PadGroupFields fields = {PAD_CFG::addressOffset, PAD_CFG::DRVUP_bit, PAD_CFG::DRVUP_bitWidth, PAD_CFG::DRVDN_bit, PAD_CFG::DRVDN_bitWidth, 0, 0, 0, 0};
+    return fields;
+}
+
+template<typename PAD_CFG>
+static PadGroupFields driveCzFields()
+{
+    PadGroupFields fields = {PAD_CFG::addressOffset, PAD_CFG::DRVUP_CZ_bit, PAD_CFG::DRVUP_CZ_bitWidth, PAD_CFG::DRVDN_CZ_bit, PAD_CFG::DRVDN_CZ_bitWidth, 0, 0, 0, 0};
+    return fields;
+}
+
+template<typename PAD_CFG>
+static PadGroupFields slewFields()
+{
+    PadGroupFields fields = {PAD_CFG::addressOffset, 0, 0, 0, 0, PAD_CFG::SLWR_bit, PAD_CFG::SLWR_bitWidth, PAD_CFG::SLWF_bit, PAD_CFG::SLWF_bitWidth};
+    return fields;
+}
+
+static const PadGroupFields* getHeaderPinFields(uint32_t headerPin)
+{
+    static const PadGroupFields noPadGroup = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+
+    // Indexed by header pin number, 0 is unused
+    static const PadGroupFields headerPins[padGroupController::NUMBER_OF_HEADER_PINS + 1] =
+    {
+        noPadGroup,
+        noPadGroup,                        // 1 3.3V
+        noPadGroup,                        // 2 5V
+        driveFields<GEN2_I2C_SDA_CFG>(),   // 3
+        noPadGroup,                        // 4 5V
+        driveFields<GEN2_I2C_SCL_CFG>(),   // 5
+        noPadGroup,                        // 6 GND
+        driveFields<AUD_MCLK_CFG>(),       // 7
+        driveFields<UART2_TX_CFG>(),       // 8
+        noPadGroup,                        // 9 GND
+        driveFields<UART2_RX_CFG>(),       // 10
+        driveFields<UART2_RTS_CFG>(),      // 11
+        driveFields<DAP4_SCLK_CFG>(),      // 12
+        slewFields<SPI2_SCK_CFG>(),        // 13
+        noPadGroup,                        // 14 GND
+        driveFields<LCD_TE_CFG>(),         // 15
+        slewFields<SPI2_CS1_CFG>(),        // 16
+        noPadGroup,                        // 17 3.3V
+        slewFields<SPI2_CS0_CFG>(),        // 18
+        slewFields<SPI1_MOSI_CFG>(),       // 19
+        noPadGroup,                        // 20 GND
+        slewFields<SPI1_MISO_CFG>(),       // 21
+        slewFields<SPI2_MISO_CFG>(),       // 22
+        slewFields<SPI1_SCK_CFG>(),        // 23
+        slewFields<SPI1_CS0_CFG>(),        // 24
+        noPadGroup,                        // 25 GND
+        slewFields<SPI1_CS1_CFG>(),        // 26
+        driveFields<GEN1_I2C_SDA_CFG>(),   // 27
+        driveFields<GEN1_I2C_SCL_CFG>(),   // 28
+        driveFields<CAM_AF_EN_CFG>(),      // 29
+        noPadGroup,                        // 30 GND
+        driveCzFields<GPIO_PZ0_CFG>(),     // 31
+        driveFields<LCD_BL_PWM_CFG>(),     // 32
+        driveFields<GPIO_PE6_CFG>(),       // 33
+        noPadGroup,                        // 34 GND
+        driveFields<DAP4_FS_CFG>(),        // 35
+        driveFields<UART2_CTS_CFG>(),      // 36
+        slewFields<SPI2_MOSI_CFG>(),       // 37
+        driveFields<DAP4_DIN_CFG>(),       // 38
+        noPadGroup,                        // 39 GND
+        driveFields<DAP4_DOUT_CFG>(),      // 40
+    };
+
+    assert((headerPin >= 1) && (headerPin <= padGroupController::NUMBER_OF_HEADER_PINS));
+    return &headerPins[headerPin];
+}
+
+static uint32_t fieldMask(uint32_t bit, uint32_t bitWidth)
+{
+    return ((1 << bitWidth) - 1) << bit;
+}
+
+PadGroupController::PadGroupController() : padGroup(padGroupController::baseAddress)
+{
+}
+
+bool PadGroupController::hasPadGroup(uint32_t headerPin)
+{
+    return getHeaderPinFields(headerPin)->addressOffset != 0;
+}
+
+void PadGroupController::stageHeaderPin(uint32_t headerPin, uint32_t preset)
+{
+    uint32_t addressOffset;
+    uint32_t bitMask;
+    uint32_t value;
+
+    getHeaderPinUpdate(headerPin, preset, addressOffset, bitMask, value);
+    stage(addressOffset, bitMask, value);
+}
+
+void PadGroupController::stageHeaderPin(uint32_t headerPin, const PadGroupSettings& settings)
+{
+    uint32_t addressOffset;
+    uint32_t bitMask;
+    uint32_t value;
+
+    getHeaderPinUpdate(headerPin, settings, addressOffset, bitMask, value);
+    stage(addressOffset, bitMask, value);
+}
+
+void PadGroupController::getHeaderPinUpdate(uint32_t headerPin, uint32_t preset, uint32_t& addressOffset, uint32_t& bitMask, uint32_t& value)
+{
+    const PadGroupFields* fields = getHeaderPinFields(headerPin);
+    PadGroupSettings settings;
+
+    switch(preset)
+    {
+        case padGroupController::PRESET_RESET:
+            settings.driveUp = 0;
+            settings.driveDown = 0;
+            settings.slewRise = 0;
+            settings.slewFall = 0;
+            break;
+        case padGroupController::PRESET_FASTEST_EDGES:
+            settings.driveUp = (1 << fields->driveUpBitWidth) - 1;
+            settings.driveDown = (1 << fields->driveDownBitWidth) - 1;
+            settings.slewRise = padGroupController::SLWR_BITFIELD_HIGHEST;
+            settings.slewFall = padGroupController::SLWF_BITFIELD_HIGHEST;
+            break;
+        case padGroupController::PRESET_SLOWEST_EDGES:
+            settings.driveUp = 0;
+            settings.driveDown = 0;
+            settings.slewRise = padGroupController::SLWR_BITFIELD_LOWEST;
+            settings.slewFall = padGroupController::SLWF_BITFIELD_LOWEST;
+            break;
+        default:
+            assert(!"unknown pad group preset");
+            settings.driveUp = 0;
+            settings.driveDown = 0;
+            settings.slewRise = 0;
+            settings.slewFall = 0;
+            break;
+    }
+
+    getHeaderPinUpdate(headerPin, settings, addressOffset, bitMask, value);
+}
+
+void PadGroupController::getHeaderPinUpdate(uint32_t headerPin, const PadGroupSettings& settings, uint32_t& addressOffset, uint32_t& bitMask, uint32_t& value)
+{
+    const PadGroupFields* fields = getHeaderPinFields(headerPin);
+    assert(fields->addressOffset != 0);
+
+    addressOffset = fields->addressOffset;
+    bitMask = 0;
+    value = 0;
+
+    if(fields->driveUpBitWidth != 0)
+    {
+        assert(settings.driveUp < (1u << fields->driveUpBitWidth));
+        assert(settings.driveDown < (1u << fields->driveDownBitWidth));
+        bitMask |= fieldMask(fields->driveUpBit, fields->driveUpBitWidth) | fieldMask(fields->driveDownBit, fields->driveDownBitWidth);
+        value |= (settings.driveUp << fields->driveUpBit) | (settings.driveDown << fields->driveDownBit);
+    }
+    if(fields->slewRiseBitWidth != 0)
+    {
+        assert(settings.slewRise < (1u << fields->slewRiseBitWidth));
+        assert(settings.slewFall < (1u << fields->slewFallBitWidth));
+        bitMask |= fieldMask(fields->slewRiseBit, fields->slewRiseBitWidth) | fieldMask(fields->slewFallBit, fields->slewFallBitWidth);
+        value |= (settings.slewRise << fields->slewRiseBit) | (settings.slewFall << fields->slewFallBit);
+    }
+}
+
+uint32_t PadGroupController::commit()
+{
+    std::sort(staged.begin(), staged.end(), [](const StagedWrite& a, const StagedWrite& b)
+    {
+        return a.addressOffset < b.addressOffset;
+    });
+
+    uint32_t writes = 0;
+    for(uint32_t i = 0; i < staged.size(); i++)
+    {
+        uint32_t current = padGroup.getRegister(staged[i].addressOffset);
+        uint32_t updated = (current & ~staged[i].bitMask) | staged[i].value;
+
+        if(updated != current)
+        {
+            padGroup.setRegister(staged[i].addressOffset, updated);
+            writes++;
+        }
+    }
+
+    staged.clear();
+    return writes;
+}
+
+void PadGroupController::discard()
+{
+    staged.clear();
+}
+
+PadGroupSettings PadGroupController::getHeaderPin(uint32_t headerPin)
+{
+    const PadGroupFields* fields = getHeaderPinFields(headerPin);
+    assert(fields->addressOffset != 0);
+
+    uint32_t current = padGroup.getRegister(fields->addressOffset);
+    PadGroupSettings settings;
+
+    settings.driveUp = (current & fieldMask(fields->driveUpBit, fields->driveUpBitWidth)) >> fields->driveUpBit;
+    settings.driveDown = (current & fieldMask(fields->driveDownBit, fields->driveDownBitWidth)) >> fields->driveDownBit;
+    settings.slewRise = (current & fieldMask(fields->slewRiseBit, fields->slewRiseBitWidth)) >> fields->slewRiseBit;
+    settings.slewFall = (current & fieldMask(fields->slewFallBit, fields->slewFallBitWidth)) >> fields->slewFallBit;
+
+    return settings;
+}
+
+// A later change to the same register wins over an earlier one, bit by bit
+void PadGroupController::stage(uint32_t addressOffset, uint32_t bitMask, uint32_t value)
+{
+    for(uint32_t i = 0; i < staged.size(); i++)
+    {
+        if(staged[i].addressOffset == addressOffset)
+        {
+            staged[i].bitMask |= bitMask;
+            staged[i].value = (staged[i].value & ~bitMask) | value;
+            return;
+        }
+    }
+
+    StagedWrite write = {addressOffset, bitMask, value};
+    staged.push_back(write);
+}
+
+/*
+ * Instantiates the field templates for every pad group in
+ * padGroupController.h, so a struct with a missing static, a misspelled
+ * field or no addressOffset fails the build instead of the first caller.
+ * Groups with neither drive nor slew fields only have their offset checked.
+ */
+template void PadGroupController::setDrive<ALS_PROX_INT_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<AP_READY_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<AP_WAKE_BT_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<AP_WAKE_NFC_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<AUD_MCLK_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<BATT_BCL_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<BT_RST_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<BT_WAKE_AP_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<BUTTON_HOME_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<BUTTON_POWER_ON_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<BUTTON_SLIDE_SW_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<BUTTON_VOL_DOWN_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<BUTTON_VOL_UP_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<CAM1_MCLK_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<CAM1_PWDN_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<CAM1_STROBE_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<CAM2_MCLK_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<CAM2_PWDN_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<CAM_AF_EN_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<CAM_FLASH_EN_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<CAM_I2C_SCL_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<CAM_I2C_SDA_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<CAM_RST_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<CLK_32K_IN_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<CLK_32K_OUT_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<CLK_REQ_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<CORE_PWR_REQ_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<CPU_PWR_REQ_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<DAP1_DIN_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<DAP1_DOUT_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<DAP1_FS_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<DAP1_SCLK_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<DAP2_DIN_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<DAP2_DOUT_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<DAP2_FS_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<DAP2_SCLK_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<DAP4_DIN_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<DAP4_DOUT_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<DAP4_FS_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<DAP4_SCLK_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<DMIC1_CLK_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<DMIC1_DAT_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<DMIC2_CLK_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<DMIC2_DAT_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<DMIC3_CLK_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<DMIC3_DAT_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<DP_HPD_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<DVFS_CLK_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<DVFS_PWM_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<GEN1_I2C_SCL_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<GEN1_I2C_SDA_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<GEN2_I2C_SCL_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<GEN2_I2C_SDA_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<GEN3_I2C_SCL_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<GEN3_I2C_SDA_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<GPIO_PA6_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<GPIO_PCC7_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<GPIO_PE6_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<GPIO_PE7_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<GPIO_PH6_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<GPIO_PK0_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<GPIO_PK1_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<GPIO_PK2_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<GPIO_PK3_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<GPIO_PK4_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<GPIO_PK5_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<GPIO_PK6_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<GPIO_PK7_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<GPIO_PL0_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<GPIO_PL1_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDriveCz<GPIO_PZ0_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDriveCz<GPIO_PZ1_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDriveCz<GPIO_PZ2_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDriveCz<GPIO_PZ3_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDriveCz<GPIO_PZ4_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDriveCz<GPIO_PZ5_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<GPIO_X1_AUD_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<GPIO_X3_AUD_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<GPS_EN_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<GPS_RST_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<HDMI_CEC_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<HDMI_INT_DP_HPD_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<JTAG_RTCK_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<LCD_BL_EN_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<LCD_BL_PWM_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<LCD_GPIO1_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<LCD_GPIO2_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<LCD_RST_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<LCD_TE_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<MODEM_WAKE_AP_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<MOTION_INT_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<NFC_EN_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<NFC_INT_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<PEX_L0_CLKREQ_N_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<PEX_L0_RST_N_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<PEX_L1_CLKREQ_N_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<PEX_L1_RST_N_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<PEX_WAKE_N_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<PWR_I2C_SCL_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<PWR_I2C_SDA_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<PWR_INT_N_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDriveCz<QSPI_COMP_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<QSPI_SCK_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<SATA_LED_ACTIVE_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDriveCz<SDMMC1_PAD_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<SDMMC1_PAD_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<EMMC2_PAD_E_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<EMMC2_PAD_E_CFG>(uint32_t, uint32_t);
+static_assert(EMMC2_PAD_DRV_TYPE_CFG::addressOffset < 0x1000, "pad group outside the pad control page");
+static_assert(EMMC2_PAD_PUPD_CFG::addressOffset < 0x1000, "pad group outside the pad control page");
+template void PadGroupController::setDriveCz<SDMMC3_PAD_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<SDMMC3_PAD_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<EMMC4_PAD_E_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<EMMC4_PAD_E_CFG>(uint32_t, uint32_t);
+static_assert(EMMC4_PAD_DRV_TYPE_CFG::addressOffset < 0x1000, "pad group outside the pad control page");
+static_assert(EMMC4_PAD_PUPD_CFG::addressOffset < 0x1000, "pad group outside the pad control page");
+template void PadGroupController::setDrive<SHUTDOWN_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<SPDIF_IN_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<SPDIF_OUT_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<SPI1_CS0_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<SPI1_CS1_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<SPI1_MISO_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<SPI1_MOSI_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<SPI1_SCK_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<SPI2_CS0_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<SPI2_CS1_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<SPI2_MISO_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<SPI2_MOSI_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<SPI2_SCK_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<SPI4_CS0_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<SPI4_MISO_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<SPI4_MOSI_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setSlew<SPI4_SCK_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<TEMP_ALERT_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<TOUCH_CLK_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<TOUCH_INT_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<TOUCH_RST_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<UART1_CTS_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<UART1_RTS_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<UART1_RX_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<UART1_TX_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<UART2_CTS_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<UART2_RTS_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<UART2_RX_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<UART2_TX_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<UART3_CTS_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<UART3_RTS_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<UART3_RX_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<UART3_TX_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<UART4_CTS_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<UART4_RTS_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<UART4_RX_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<UART4_TX_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<USB_VBUS_EN0_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<USB_VBUS_EN1_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<WIFI_EN_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<WIFI_RST_CFG>(uint32_t, uint32_t);
+template void PadGroupController::setDrive<WIFI_WAKE_AP_CFG>(uint32_t, uint32_t);
@@ -37,12 +37,32 @@
  * drive strenth. For EMMC2_PAD_E, EMMC2_PAD_PUPD, EMMC4_PAD_E, EMMC4_PAD_PUPD 
  * registers there are other different options.
  *
+ * PadGroupController sets drive strength (DRVUP/DRVDN, how hard the pad
+ * pulls up and down, larger is stronger) and slew (SLWR/SLWF, HIGHEST is
+ * the fastest edge) either on one pad group by type, setDrive<AUD_MCLK_CFG>(),
+ * or on header pins by number. Not every group has every field, the Nano's
+ * header pads have:
+ * __________________________________________________________________
+ * Header pins                                | Fields
+ * 3, 5, 7, 8, 10, 11, 12, 15, 27 - 29, 32,   | DRVUP, DRVDN, 5 bits
+ * 33, 35, 36, 38, 40                         |
+ * 13, 16, 18, 19, 21 - 24, 26, 37            | SLWR, SLWF
+ * 31                                         | DRVUP_CZ, DRVDN_CZ, 7 bits
+ *
+ * Header pin changes are staged and written by commit(), which merges
+ * every change to the same register, reads each register once and writes
+ * it once, in address order, and skips registers that already hold the
+ * result. A preset such as PRESET_FASTEST_EDGES picks, per pad, the
+ * strongest drive and fastest slew the pad has.
  */
 
 #ifndef PAD_GROUP_CONTROLLER_H
 #define PAD_GROUP_CONTROLLER_H
 
 #include <cstdint>
+#include <vector>
+
+#include "../peripheralController/peripheralController.h"
 
 struct padGroupController
 {
@@ -77,6 +97,11 @@ struct padGroupController
     
     static const uint32_t baseAddress = 0x70000000;
 
+    static const uint32_t PRESET_RESET = 0; // every field back to its reset value of 0
+    static const uint32_t PRESET_FASTEST_EDGES = 1; // strongest drive, fastest slew
+    static const uint32_t PRESET_SLOWEST_EDGES = 2; // weakest drive, slowest slew, least ringing and EMI
+
+    static const uint32_t NUMBER_OF_HEADER_PINS = 40;
 };
 
 // 21.1.4.4
@@ -85,7 +110,7 @@ struct ALS_PROX_INT_CFG
     static const uint32_t addressOffset = 0x8E4;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -98,7 +123,7 @@ struct AP_READY_CFG
     static const uint32_t addressOffset = 0x8E8;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -111,7 +136,7 @@ struct AP_WAKE_BT_CFG
     static const uint32_t addressOffset = 0x8EC;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -124,7 +149,7 @@ struct AP_WAKE_NFC_CFG
     static const uint32_t addressOffset = 0x8F0;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -137,7 +162,7 @@ struct AUD_MCLK_CFG
     static const uint32_t addressOffset = 0x8F4;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -150,7 +175,7 @@ struct BATT_BCL_CFG
     static const uint32_t addressOffset = 0x8F8;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -162,7 +187,7 @@ struct BT_RST_CFG
     static const uint32_t addressOffset = 0x8FC;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -174,7 +199,7 @@ struct BT_WAKE_AP_CFG
     static const uint32_t addressOffset = 0x900;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -186,7 +211,7 @@ struct BUTTON_HOME_CFG
     static const uint32_t addressOffset = 0x904;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -198,7 +223,7 @@ struct BUTTON_POWER_ON_CFG
     static const uint32_t addressOffset = 0x908;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -210,7 +235,7 @@ struct BUTTON_SLIDE_SW_CFG
     static const uint32_t addressOffset = 0x90C;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -222,7 +247,7 @@ struct BUTTON_VOL_DOWN_CFG
     static const uint32_t addressOffset = 0x910;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -234,7 +259,7 @@ struct BUTTON_VOL_UP_CFG
     static const uint32_t addressOffset = 0x914;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -246,7 +271,7 @@ struct CAM1_MCLK_CFG
     static const uint32_t addressOffset = 0x918;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -258,7 +283,7 @@ struct CAM1_PWDN_CFG
     static const uint32_t addressOffset = 0x91C;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -270,7 +295,7 @@ struct CAM1_STROBE_CFG
     static const uint32_t addressOffset = 0x920;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -282,7 +307,7 @@ struct CAM2_MCLK_CFG
     static const uint32_t addressOffset = 0x924;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -294,7 +319,7 @@ struct CAM2_PWDN_CFG
     static const uint32_t addressOffset = 0x928;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -306,7 +331,7 @@ struct CAM_AF_EN_CFG
     static const uint32_t addressOffset = 0x92C;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -318,7 +343,7 @@ struct CAM_FLASH_EN_CFG
     static const uint32_t addressOffset = 0x930;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -330,7 +355,7 @@ struct CAM_I2C_SCL_CFG
     static const uint32_t addressOffset = 0x934;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -342,7 +367,7 @@ struct CAM_I2C_SDA_CFG
     static const uint32_t addressOffset = 0x938;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -354,7 +379,7 @@ struct CAM_RST_CFG
     static const uint32_t addressOffset = 0x93C;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -366,7 +391,7 @@ struct CLK_32K_IN_CFG
     static const uint32_t addressOffset = 0x940;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -378,7 +403,7 @@ struct CLK_32K_OUT_CFG
     static const uint32_t addressOffset = 0x944;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -387,10 +412,10 @@ struct CLK_32K_OUT_CFG
 // 21.1.4.29
 struct CLK_REQ_CFG
 {
-    static const uint32_t address = 0x7000 + 0x948;
+    static const uint32_t addressOffset = 0x948;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -403,7 +428,7 @@ struct CORE_PWR_REQ_CFG
     static const uint32_t addressOffset =  0x94c;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -412,10 +437,10 @@ struct CORE_PWR_REQ_CFG
 // 21.1.4.31
 struct CPU_PWR_REQ_CFG
 {
-    uint32_t addressOffset = 0x950;
+    static const uint32_t addressOffset = 0x950;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -524,7 +549,7 @@ struct DAP4_DIN_CFG
     static const uint32_t addressOffset = 0x974;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -536,7 +561,7 @@ struct DAP4_DOUT_CFG
     static const uint32_t addressOffset = 0x978;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -548,7 +573,7 @@ struct DAP4_FS_CFG
     static const uint32_t addressOffset = 0x97C;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -560,7 +585,7 @@ struct DAP4_SCLK_CFG
     static const uint32_t addressOffset = 0x980;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -572,7 +597,7 @@ struct DMIC1_CLK_CFG
     static const uint32_t addressOffset = 0x984;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -584,7 +609,7 @@ struct DMIC1_DAT_CFG
     static const uint32_t addressOffset = 0x988;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -596,7 +621,7 @@ struct DMIC2_CLK_CFG
     static const uint32_t addressOffset = 0x98C;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -608,7 +633,7 @@ struct DMIC2_DAT_CFG
     static const uint32_t addressOffset = 0x990;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -620,7 +645,7 @@ struct DMIC3_CLK_CFG
     static const uint32_t addressOffset = 0x994;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -632,7 +657,7 @@ struct DMIC3_DAT_CFG
     static const uint32_t addressOffset = 0x998;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -644,7 +669,7 @@ struct DP_HPD_CFG
     static const uint32_t addressOffset = 0x99C;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -656,7 +681,7 @@ struct DVFS_CLK_CFG
     static const uint32_t addressOffset = 0x9A0;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -668,7 +693,7 @@ struct DVFS_PWM_CFG
     static const uint32_t addressOffset = 0x9A4;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -680,7 +705,7 @@ struct GEN1_I2C_SCL_CFG
     static const uint32_t addressOffset = 0x9A8;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -692,7 +717,7 @@ struct GEN1_I2C_SDA_CFG
     static const uint32_t addressOffset = 0x9AC;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -704,7 +729,7 @@ struct GEN2_I2C_SCL_CFG
     static const uint32_t addressOffset = 0x9B0;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -716,7 +741,7 @@ struct GEN2_I2C_SDA_CFG
     static const uint32_t addressOffset = 0x9B4;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -728,7 +753,7 @@ struct GEN3_I2C_SCL_CFG
     static const uint32_t addressOffset = 0x9B8;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -740,7 +765,7 @@ struct GEN3_I2C_SDA_CFG
     static const uint32_t addressOffset = 0x9BC;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -752,7 +777,7 @@ struct GPIO_PA6_CFG
     static const uint32_t addressOffset = 0x9C0;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -764,7 +789,7 @@ struct GPIO_PCC7_CFG
     static const uint32_t addressOffset = 0x9C4;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -776,7 +801,7 @@ struct GPIO_PE6_CFG
     static const uint32_t addressOffset = 0x9C8;
 
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -788,7 +813,7 @@ struct GPIO_PE7_CFG
     static const uint32_t addressOffset = 0x9CC;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -800,7 +825,7 @@ struct GPIO_PH6_CFG
     static const uint32_t addressOffset = 0x9D0;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -932,10 +957,10 @@ struct GPIO_PZ0_CFG
     static const uint32_t addressOffset = 0x9FC;
 
     static const uint32_t DRVUP_CZ_bit = 20;
-    static const uint32_t DRVUP_CZ_bitWidth 7;
+    static const uint32_t DRVUP_CZ_bitWidth = 7;
 
     static const uint32_t DRVDN_CZ_bit = 12;
-    static const uint32_t DRVDN_CZ_bitWidth 7;
+    static const uint32_t DRVDN_CZ_bitWidth = 7;
 };
 
 
@@ -945,10 +970,10 @@ struct GPIO_PZ1_CFG
     static const uint32_t addressOffset = 0xA00;
 
     static const uint32_t DRVUP_CZ_bit = 20;
-    static const uint32_t DRVUP_CZ_bitWidth 7;
+    static const uint32_t DRVUP_CZ_bitWidth = 7;
 
     static const uint32_t DRVDN_CZ_bit = 12;
-    static const uint32_t DRVDN_CZ_bitWidth 7;
+    static const uint32_t DRVDN_CZ_bitWidth = 7;
 };
 
 // 21.1.4.76
@@ -957,10 +982,10 @@ struct GPIO_PZ2_CFG
     static const uint32_t addressOffset = 0xA04;
 
     static const uint32_t DRVUP_CZ_bit = 20;
-    static const uint32_t DRVUP_CZ_bitWidth 7;
+    static const uint32_t DRVUP_CZ_bitWidth = 7;
 
     static const uint32_t DRVDN_CZ_bit = 12;
-    static const uint32_t DRVDN_CZ_bitWidth 7;
+    static const uint32_t DRVDN_CZ_bitWidth = 7;
 };
 
 // 21.1.4.77
@@ -969,10 +994,10 @@ struct GPIO_PZ3_CFG
     static const uint32_t addressOffset = 0xA08;
 
     static const uint32_t DRVUP_CZ_bit = 20;
-    static const uint32_t DRVUP_CZ_bitWidth 7;
+    static const uint32_t DRVUP_CZ_bitWidth = 7;
 
     static const uint32_t DRVDN_CZ_bit = 12;
-    static const uint32_t DRVDN_CZ_bitWidth 7;
+    static const uint32_t DRVDN_CZ_bitWidth = 7;
 };
 
 // 21.1.4.78
@@ -981,10 +1006,10 @@ struct GPIO_PZ4_CFG
     static const uint32_t addressOffset = 0xA0C;
 
     static const uint32_t DRVUP_CZ_bit = 20;
-    static const uint32_t DRVUP_CZ_bitWidth 7;
+    static const uint32_t DRVUP_CZ_bitWidth = 7;
 
     static const uint32_t DRVDN_CZ_bit = 12;
-    static const uint32_t DRVDN_CZ_bitWidth 7;
+    static const uint32_t DRVDN_CZ_bitWidth = 7;
 };
 
 // 21.1.4.79
@@ -993,10 +1018,10 @@ struct GPIO_PZ5_CFG
     static const uint32_t addressOffset = 0xA10;
 
     static const uint32_t DRVUP_CZ_bit = 20;
-    static const uint32_t DRVUP_CZ_bitWidth 7;
+    static const uint32_t DRVUP_CZ_bitWidth = 7;
 
     static const uint32_t DRVDN_CZ_bit = 12;
-    static const uint32_t DRVDN_CZ_bitWidth 7;
+    static const uint32_t DRVDN_CZ_bitWidth = 7;
 };
 
 // 21.1.4.80
@@ -1005,7 +1030,7 @@ struct GPIO_X1_AUD_CFG
     static const uint32_t addressOffset = 0xA14;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1017,7 +1042,7 @@ struct GPIO_X3_AUD_CFG
     static const uint32_t addressOffset = 0xA18;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1029,7 +1054,7 @@ struct GPS_EN_CFG
     static const uint32_t addressOffset = 0xA1C;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1041,19 +1066,19 @@ struct GPS_RST_CFG
     static const uint32_t addressOffset = 0xA20;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
 };
 
 // 21.1.4.84
-struct GPS_RST_CFG
+struct HDMI_CEC_CFG
 {
-    static const uint32_t addressOffset = 0xA244;
+    static const uint32_t addressOffset = 0xA24;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1065,19 +1090,19 @@ struct HDMI_INT_DP_HPD_CFG
     static const uint32_t addressOffset = 0xA28;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
 };
 
 // 21.1.4.86
-struct JTAG_RTCK_CFGJTAG_RTCK_CFG
+struct JTAG_RTCK_CFG
 {
     static const uint32_t addressOffset = 0xA2C;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1089,7 +1114,7 @@ struct LCD_BL_EN_CFG
     static const uint32_t addressOffset = 0xA30;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1101,7 +1126,7 @@ struct LCD_BL_PWM_CFG
     static const uint32_t addressOffset = 0xA34;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1113,7 +1138,7 @@ struct LCD_GPIO1_CFG
     static const uint32_t addressOffset = 0xA38;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1125,7 +1150,7 @@ struct LCD_GPIO2_CFG
     static const uint32_t addressOffset = 0xA3C;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1137,7 +1162,7 @@ struct LCD_RST_CFG
     static const uint32_t addressOffset = 0xA40;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1149,7 +1174,7 @@ struct LCD_TE_CFG
     static const uint32_t addressOffset = 0xA44;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1161,7 +1186,7 @@ struct MODEM_WAKE_AP_CFG
     static const uint32_t addressOffset = 0xA48;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1173,7 +1198,7 @@ struct MOTION_INT_CFG
     static const uint32_t addressOffset = 0xA4C;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1185,7 +1210,7 @@ struct NFC_EN_CFG
     static const uint32_t addressOffset = 0xA50;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1197,7 +1222,7 @@ struct NFC_INT_CFG
     static const uint32_t addressOffset = 0xA54;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1209,7 +1234,7 @@ struct PEX_L0_CLKREQ_N_CFG
     static const uint32_t addressOffset = 0xA58;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1221,7 +1246,7 @@ struct PEX_L0_RST_N_CFG
     static const uint32_t addressOffset = 0xA5C;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1233,7 +1258,7 @@ struct PEX_L1_CLKREQ_N_CFG
     static const uint32_t addressOffset = 0xA60;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1245,7 +1270,7 @@ struct PEX_L1_RST_N_CFG
     static const uint32_t addressOffset = 0xA64;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1257,7 +1282,7 @@ struct PEX_WAKE_N_CFG
     static const uint32_t addressOffset = 0xA68;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1269,7 +1294,7 @@ struct PWR_I2C_SCL_CFG
     static const uint32_t addressOffset = 0xA6C;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1281,19 +1306,19 @@ struct PWR_I2C_SDA_CFG
     static const uint32_t addressOffset = 0xA70;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
 };
 
 // 21.1.4.104
-struct PWR_I2C_SDA_CFG
+struct PWR_INT_N_CFG
 {
     static const uint32_t addressOffset = 0xA74;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1305,10 +1330,10 @@ struct QSPI_COMP_CFG
     static const uint32_t addressOffset = 0xA78;
  
     static const uint32_t DRVUP_CZ_bit = 20;
-    static const uint32_t DRVUP_CZ_bitWidth 7;
+    static const uint32_t DRVUP_CZ_bitWidth = 7;
 
     static const uint32_t DRVDN_CZ_bit = 12;
-    static const uint32_t DRVDN_CZ_bitWidth 7;
+    static const uint32_t DRVDN_CZ_bitWidth = 7;
 };
 
 // 21.1.4.106
@@ -1329,7 +1354,7 @@ struct SATA_LED_ACTIVE_CFG
     static const uint32_t addressOffset = 0xA94;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1347,10 +1372,10 @@ struct SDMMC1_PAD_CFG
     static const uint32_t SLWR_bitWidth = 2;
  
     static const uint32_t DRVUP_CZ_bit = 20;
-    static const uint32_t DRVUP_CZ_bitWidth 7;
+    static const uint32_t DRVUP_CZ_bitWidth = 7;
 
     static const uint32_t DRVDN_CZ_bit = 12;
-    static const uint32_t DRVDN_CZ_bitWidth 7;
+    static const uint32_t DRVDN_CZ_bitWidth = 7;
 };
 
 // 21.1.4.109
@@ -1404,10 +1429,10 @@ struct EMMC2_PAD_E_CFG
     static const uint32_t CLK_PARK_bitWidth = 1;
 
     static const uint32_t DRVUP_bit = 8;
-    static const uint32_t DRVUP_bit_bitWidth = 6;
+    static const uint32_t DRVUP_bitWidth = 6;
 
     static const uint32_t DRVDN_bit = 2;
-    static const uint32_t DRVDN_bitWidth 6;
+    static const uint32_t DRVDN_bitWidth = 6;
 
     static const uint32_t E_PREEMP_bit = 1;
     static const uint32_t E_PREEMP_bitWidth = 1;
@@ -1570,10 +1595,10 @@ struct SDMMC3_PAD_CFG
     static const uint32_t SLWR_bitWidth = 2;
  
     static const uint32_t DRVUP_CZ_bit = 20;
-    static const uint32_t DRVUP_CZ_bitWidth 7;
+    static const uint32_t DRVUP_CZ_bitWidth = 7;
 
     static const uint32_t DRVDN_CZ_bit = 12;
-    static const uint32_t DRVDN_CZ_bitWidth 7;
+    static const uint32_t DRVDN_CZ_bitWidth = 7;
 };
 
 // 21.1.4.113
@@ -1627,10 +1652,10 @@ struct EMMC4_PAD_E_CFG
     static const uint32_t CLK_PARK_bitWidth = 1;
 
     static const uint32_t DRVUP_bit = 8;
-    static const uint32_t DRVUP_bit_bitWidth = 6;
+    static const uint32_t DRVUP_bitWidth = 6;
 
     static const uint32_t DRVDN_bit = 2;
-    static const uint32_t DRVDN_bitWidth 6;
+    static const uint32_t DRVDN_bitWidth = 6;
 
     static const uint32_t E_PREEMP_bit = 1;
     static const uint32_t E_PREEMP_bitWidth = 1;
@@ -1774,7 +1799,7 @@ struct SHUTDOWN_CFG
     static const uint32_t addressOffset = 0xAC8;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1786,7 +1811,7 @@ struct SPDIF_IN_CFG
     static const uint32_t addressOffset = 0xACC;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1798,7 +1823,7 @@ struct SPDIF_OUT_CFG
     static const uint32_t addressOffset = 0xAD0;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1978,7 +2003,7 @@ struct TEMP_ALERT_CFG
     static const uint32_t addressOffset = 0xB0C;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -1990,7 +2015,7 @@ struct TOUCH_CLK_CFG
     static const uint32_t addressOffset = 0xB10;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -2002,7 +2027,7 @@ struct TOUCH_INT_CFG
     static const uint32_t addressOffset = 0xB14;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -2014,7 +2039,7 @@ struct TOUCH_RST_CFG
     static const uint32_t addressOffset = 0xB18;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -2026,7 +2051,7 @@ struct UART1_CTS_CFG
     static const uint32_t addressOffset = 0xB1C;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -2038,7 +2063,7 @@ struct UART1_RTS_CFG
     static const uint32_t addressOffset = 0xB20;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -2050,7 +2075,7 @@ struct UART1_RX_CFG
     static const uint32_t addressOffset = 0xB24;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -2062,7 +2087,7 @@ struct UART1_TX_CFG
     static const uint32_t addressOffset = 0xB28;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -2074,7 +2099,7 @@ struct UART2_CTS_CFG
     static const uint32_t addressOffset = 0xB2C;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -2086,7 +2111,7 @@ struct UART2_RTS_CFG
     static const uint32_t addressOffset = 0xB30;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -2098,7 +2123,7 @@ struct UART2_RX_CFG
     static const uint32_t addressOffset = 0xB34;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -2110,7 +2135,7 @@ struct UART2_TX_CFG
     static const uint32_t addressOffset = 0xB38;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -2122,7 +2147,7 @@ struct UART3_CTS_CFG
     static const uint32_t addressOffset = 0xB3C;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -2134,7 +2159,7 @@ struct UART3_RTS_CFG
     static const uint32_t addressOffset = 0xB40;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -2146,7 +2171,7 @@ struct UART3_RX_CFG
     static const uint32_t addressOffset = 0xB44;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -2158,7 +2183,7 @@ struct UART3_TX_CFG
     static const uint32_t addressOffset = 0xB48;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -2170,7 +2195,7 @@ struct UART4_CTS_CFG
     static const uint32_t addressOffset = 0xB4C;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -2182,7 +2207,7 @@ struct UART4_RTS_CFG
     static const uint32_t addressOffset = 0xB50;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -2194,7 +2219,7 @@ struct UART4_RX_CFG
     static const uint32_t addressOffset = 0xB54;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -2206,7 +2231,7 @@ struct UART4_TX_CFG
     static const uint32_t addressOffset = 0xB58;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -2218,7 +2243,7 @@ struct USB_VBUS_EN0_CFG
     static const uint32_t addressOffset = 0xB5C;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -2230,7 +2255,7 @@ struct USB_VBUS_EN1_CFG
     static const uint32_t addressOffset = 0xB60;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -2242,7 +2267,7 @@ struct WIFI_EN_CFG
     static const uint32_t addressOffset = 0xB64;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -2254,7 +2279,7 @@ struct WIFI_RST_CFG
     static const uint32_t addressOffset = 0xB68;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
@@ -2266,10 +2291,87 @@ struct WIFI_WAKE_AP_CFG
     static const uint32_t addressOffset = 0xB6C;
     
     static const uint32_t DRVUP_bit = 20;
-    static const uint32_t DRVUP_bitWidth 5;
+    static const uint32_t DRVUP_bitWidth = 5;
 
     static const uint32_t DRVDN_bit = 12;
     static const uint32_t DRVDN_bitWidth = 5;
 };
 
-#endif //PINMUX_CONTROLLER_H
+// Raw field values for one pad group, fields the group does not have are ignored
+struct PadGroupSettings
+{
+    uint32_t driveUp;
+    uint32_t driveDown;
+    uint32_t slewRise;
+    uint32_t slewFall;
+};
+
+class PadGroupController
+{
+    public:
+        PadGroupController();
+
+        PadGroupController(const PadGroupController&) = delete;
+        PadGroupController& operator=(const PadGroupController&) = delete;
+
+        // Immediate read modify write of one pad group, for groups with DRVUP and DRVDN.
+        template<typename PAD_CFG>
+        void setDrive(uint32_t driveUp, uint32_t driveDown)
+        {
+            padGroup.setRegisterField(PAD_CFG::addressOffset, driveUp, PAD_CFG::DRVUP_bit, PAD_CFG::DRVUP_bitWidth);
+            padGroup.setRegisterField(PAD_CFG::addressOffset, driveDown, PAD_CFG::DRVDN_bit, PAD_CFG::DRVDN_bitWidth);
+        }
+
+        // Immediate read modify write of one pad group, for groups with DRVUP_CZ and DRVDN_CZ.
+        template<typename PAD_CFG>
+        void setDriveCz(uint32_t driveUp, uint32_t driveDown)
+        {
+            padGroup.setRegisterField(PAD_CFG::addressOffset, driveUp, PAD_CFG::DRVUP_CZ_bit, PAD_CFG::DRVUP_CZ_bitWidth);
+            padGroup.setRegisterField(PAD_CFG::addressOffset, driveDown, PAD_CFG::DRVDN_CZ_bit, PAD_CFG::DRVDN_CZ_bitWidth);
+        }
+
+        // Immediate read modify write of one pad group, for groups with SLWR and SLWF.
+        template<typename PAD_CFG>
+        void setSlew(uint32_t slewRise, uint32_t slewFall)
+        {
+            padGroup.setRegisterField(PAD_CFG::addressOffset, slewRise, PAD_CFG::SLWR_bit, PAD_CFG::SLWR_bitWidth);
+            padGroup.setRegisterField(PAD_CFG::addressOffset, slewFall, PAD_CFG::SLWF_bit, PAD_CFG::SLWF_bitWidth);
+        }
+
+        // Header pins 1 - 40 that have a pad group, power and ground pins do not.
+        static bool hasPadGroup(uint32_t headerPin);
+
+        /*
+         * The register, bits and value stageHeaderPin() would stage, for
+         * building writes without a mapping.
+         */
+        static void getHeaderPinUpdate(uint32_t headerPin, uint32_t preset, uint32_t& addressOffset, uint32_t& bitMask, uint32_t& value);
+        static void getHeaderPinUpdate(uint32_t headerPin, const PadGroupSettings& settings, uint32_t& addressOffset, uint32_t& bitMask, uint32_t& value);
+
+        void stageHeaderPin(uint32_t headerPin, uint32_t preset);
+        void stageHeaderPin(uint32_t headerPin, const PadGroupSettings& settings);
+
+        /*
+         * Writes everything staged since the last commit() or discard().
+         * Returns the number of registers actually written.
+         */
+        uint32_t commit();
+        void discard();
+
+        PadGroupSettings getHeaderPin(uint32_t headerPin);
+
+    private:
+        struct StagedWrite
+        {
+            uint32_t addressOffset;
+            uint32_t bitMask;
+            uint32_t value;
+        };
+
+        void stage(uint32_t addressOffset, uint32_t bitMask, uint32_t value);
+
+        PeripheralController padGroup;
+        std::vector<StagedWrite> staged;
+};
+
+#endif //PAD_GROUP_CONTROLLER_H
@@ -40,15 +40,39 @@ void PeripheralController::setRegisterField(uint32_t addrOffset, uint32_t value,
     assert(memMap != NULL);
     uint32_t bitMask = ((1 << bitWidth) - 1) << baseBit;   
 
-    *((volatile uint8_t*)memMap + (baseAddress&(BLOCK_SIZE - 1)) + addrOffset) &= ~bitMask;   
-    *((volatile uint8_t*)memMap + (baseAddress&(BLOCK_SIZE - 1)) + addrOffset) |= (value << baseBit);
+    volatile uint32_t* registerAddress = getRegisterAddress(addrOffset);
+    *registerAddress = (*registerAddress & ~bitMask) | ((value << baseBit) & bitMask);
 }
 
 uint32_t PeripheralController::getRegisterField(uint32_t addrOffset, uint32_t baseBit, uint32_t bitWidth)
 {
     assert(memMap != NULL);
     
-    uint32_t registerValue = *((volatile uint8_t*)memMap + (baseAddress&(BLOCK_SIZE - 1)) + addrOffset);
+    uint32_t registerValue = *getRegisterAddress(addrOffset);
     return (registerValue >> baseBit)&((1<<bitWidth)-1); 
 }
 
+void PeripheralController::setRegister(uint32_t addrOffset, uint32_t value)
+{
+    *getRegisterAddress(addrOffset) = value;
+}
+
+uint32_t PeripheralController::getRegister(uint32_t addrOffset)
+{
+    return *getRegisterAddress(addrOffset);
+}
+
+volatile uint32_t* PeripheralController::getRegisterAddress(uint32_t addrOffset)
+{
+    assert(memMap != NULL);
+    assert(((baseAddress&(BLOCK_SIZE - 1)) + addrOffset) < BLOCK_SIZE);
+
+    // registers are 32 bits wide, byte wide access only reaches the low byte
+    return (volatile uint32_t*)((volatile uint8_t*)memMap + (baseAddress&(BLOCK_SIZE - 1)) + addrOffset);
+}
+
+void PeripheralController::prefault(uint32_t safeOffset)
+{
+    volatile uint32_t registerValue = *getRegisterAddress(safeOffset);
+    (void)registerValue;
+}
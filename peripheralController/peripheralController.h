@@ -49,6 +49,10 @@ class PeripheralController
         PeripheralController();
         PeripheralController(uint32_t baseAddress);
         ~PeripheralController();
+
+        // The mapping is owned by the object, copies would unmap it twice.
+        PeripheralController(const PeripheralController&) = delete;
+        PeripheralController& operator=(const PeripheralController&) = delete;
         
         /*
          * The following functions use a bitmask technique to 
@@ -58,9 +62,26 @@ class PeripheralController
         void setRegisterField(uint32_t addrOffset, uint32_t value, uint32_t baseBit, uint32_t bitWidth);
         uint32_t getRegisterField(uint32_t addrOffset, uint32_t baseBit, uint32_t bitWidth);
 
+        /*
+         * Whole register access. getRegisterAddress is meant for hot loops
+         * that resolve a register once and then store to it directly, for
+         * example the GPIO_MSK_* registers which need no read-modify-write.
+         */
+        void setRegister(uint32_t addrOffset, uint32_t value);
+        uint32_t getRegister(uint32_t addrOffset);
+        volatile uint32_t* getRegisterAddress(uint32_t addrOffset);
+
+        /*
+         * Reads the register at safeOffset so the mapping is faulted in and
+         * in the TLB before a time critical loop touches it. Pick a register
+         * without read side effects, FIFO data registers are not.
+         */
+        void prefault(uint32_t safeOffset = 0);
+
+        // One mapping, every register must lie in the block holding baseAddress.
+        static const uint32_t BLOCK_SIZE = 0x1000; //4096
        
     private:
-        const uint32_t BLOCK_SIZE = 0x1000; //4096
         void* memMap = NULL;
 	uint32_t baseAddress = 0;
 
@@ -0,0 +1,462 @@
+#include "pinConfig.h"
+#include "../headerPinController/headerPinController.h"
+#include "../padGroupController/padGroupController.h"
+#include "../pinmuxController/pinmuxController.h"
+#include "../gpioController/gpio.h"
+#include "../gpioController/gpioPin.h"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <sstream>
+#include <cassert>
+
+static const uint32_t NO_PRESET = 0xFFFFFFFF;
+
+struct ParsedPin
+{
+    HeaderPinRequest request;
+    bool hasMode;
+    bool hasLevel;
+    bool hasFunction;
+    uint32_t padPreset;
+    uint32_t line;
+};
+
+static std::string trim(const std::string& text)
+{
+    size_t first = text.find_first_not_of(" \t\r");
+    if(first == std::string::npos)
+    {
+        return "";
+    }
+    size_t last = text.find_last_not_of(" \t\r");
+    return text.substr(first, last - first + 1);
+}
+
+static std::string lineError(uint32_t line, const std::string& message)
+{
+    std::ostringstream stream;
+    stream << "line " << line << ": " << message;
+    return stream.str();
+}
+
+// "13" or "SPI2_SCK", 0 when the name is not a GPIO capable header pin
+static uint32_t resolvePin(const std::string& name)
+{
+    char* end = NULL;
+    unsigned long number = strtoul(name.c_str(), &end, 10);
+
+    if((end != name.c_str()) && (*end == '\0'))
+    {
+        if((number < 1) || (number > headerPinController::NUMBER_OF_HEADER_PINS) || !HeaderPinController::isGpioPin(number))
+        {
+            return 0;
+        }
+        return number;
+    }
+
+    return HeaderPinController::findHeaderPin(name.c_str());
+}
+
+static bool finishPin(const ParsedPin& pin, std::string& error)
+{
+    if(!pin.hasMode)
+    {
+        error = lineError(pin.line, "section has no mode");
+        return false;
+    }
+    if(pin.hasLevel && (pin.request.mode != headerPinController::MODE_GPIO_OUTPUT))
+    {
+        error = lineError(pin.line, "level only applies to mode = output");
+        return false;
+    }
+    if(pin.hasFunction && (pin.request.mode != headerPinController::MODE_SFIO))
+    {
+        error = lineError(pin.line, "function only applies to mode = sfio");
+        return false;
+    }
+    return true;
+}
+
+static bool setOption(ParsedPin& pin, const std::string& key, const std::string& value, std::string& error)
+{
+    uint32_t& options = pin.request.options;
+
+    if(key == "mode")
+    {
+        if(value == "input")
+        {
+            pin.request.mode = headerPinController::MODE_GPIO_INPUT;
+        }
+        else if(value == "output")
+        {
+            pin.request.mode = headerPinController::MODE_GPIO_OUTPUT;
+        }
+        else if(value == "sfio")
+        {
+            pin.request.mode = headerPinController::MODE_SFIO;
+        }
+        else
+        {
+            error = "mode must be input, output or sfio";
+            return false;
+        }
+        pin.hasMode = true;
+    }
+    else if(key == "function")
+    {
+        uint32_t function;
+        if(!HeaderPinController::findFunction(pin.request.headerPin, value.c_str(), function))
+        {
+            error = std::string("pad ") + HeaderPinController::getHeaderPin(pin.request.headerPin).padName + " has no function " + value;
+            return false;
+        }
+        options &= ~(headerPinController::OPTION_FUNCTION |
+            (((1 << headerPinController::OPTION_FUNCTION_bitWidth) - 1) << headerPinController::OPTION_FUNCTION_bit));
+        options |= HeaderPinController::selectFunction(function);
+        pin.hasFunction = true;
+    }
+    else if(key == "level")
+    {
+        options &= ~headerPinController::OPTION_OUTPUT_HIGH;
+        if(value == "high")
+        {
+            options |= headerPinController::OPTION_OUTPUT_HIGH;
+        }
+        else if(value != "low")
+        {
+            error = "level must be low or high";
+            return false;
+        }
+        pin.hasLevel = true;
+    }
+    else if(key == "pull")
+    {
+        options &= ~(headerPinController::OPTION_PULL_UP | headerPinController::OPTION_PULL_DOWN);
+        if(value == "up")
+        {
+            options |= headerPinController::OPTION_PULL_UP;
+        }
+        else if(value == "down")
+        {
+            options |= headerPinController::OPTION_PULL_DOWN;
+        }
+        else if(value != "none")
+        {
+            error = "pull must be none, up or down";
+            return false;
+        }
+    }
+    else if(key == "input")
+    {
+        options &= ~headerPinController::OPTION_INPUT_DISABLE;
+        if(value == "off")
+        {
+            options |= headerPinController::OPTION_INPUT_DISABLE;
+        }
+        else if(value != "on")
+        {
+            error = "input must be on or off";
+            return false;
+        }
+    }
+    else if(key == "edges")
+    {
+        if(value == "reset")
+        {
+            pin.padPreset = padGroupController::PRESET_RESET;
+        }
+        else if(value == "fastest")
+        {
+            pin.padPreset = padGroupController::PRESET_FASTEST_EDGES;
+        }
+        else if(value == "slowest")
+        {
+            pin.padPreset = padGroupController::PRESET_SLOWEST_EDGES;
+        }
+        else
+        {
+            error = "edges must be reset, fastest or slowest";
+            return false;
+        }
+    }
+    else
+    {
+        error = "unknown key " + key;
+        return false;
+    }
+
+    return true;
+}
+
+static bool parse(const std::string& text, std::vector<ParsedPin>& pins, std::string& error)
+{
+    std::istringstream input(text);
+    std::string rawLine;
+    uint32_t lineNumber = 0;
+    bool inSection = false;
+
+    while(std::getline(input, rawLine))
+    {
+        lineNumber++;
+
+        std::string line = trim(rawLine.substr(0, rawLine.find_first_of(";#")));
+        if(line.empty())
+        {
+            continue;
+        }
+
+        if(line[0] == '[')
+        {
+            if((line[line.size() - 1] != ']') || (line.compare(0, 4, "[pin") != 0))
+            {
+                error = lineError(lineNumber, "expected [pin <number or pad name>]");
+                return false;
+            }
+            if(inSection && !finishPin(pins.back(), error))
+            {
+                return false;
+            }
+
+            std::string name = trim(line.substr(4, line.size() - 5));
+            uint32_t headerPin = resolvePin(name);
+            if(headerPin == 0)
+            {
+                error = lineError(lineNumber, "no GPIO capable header pin named " + name);
+                return false;
+            }
+            for(uint32_t i = 0; i < pins.size(); i++)
+            {
+                if(pins[i].request.headerPin == headerPin)
+                {
+                    error = lineError(lineNumber, "header pin " + name + " already configured");
+                    return false;
+                }
+            }
+
+            ParsedPin pin = {{headerPin, headerPinController::MODE_GPIO_INPUT, headerPinController::OPTION_NONE}, false, false, false, NO_PRESET, lineNumber};
+            pins.push_back(pin);
+            inSection = true;
+            continue;
+        }
+
+        size_t equals = line.find('=');
+        if(!inSection || (equals == std::string::npos))
+        {
+            error = lineError(lineNumber, "expected key = value inside a [pin] section");
+            return false;
+        }
+
+        std::string optionError;
+        if(!setOption(pins.back(), trim(line.substr(0, equals)), trim(line.substr(equals + 1)), optionError))
+        {
+            error = lineError(lineNumber, optionError);
+            return false;
+        }
+    }
+
+    if(inSection && !finishPin(pins.back(), error))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+static void addRecord(std::vector<PinConfigRecord>& step, uint32_t physicalAddress, uint32_t bitMask, uint32_t value)
+{
+    PinConfigRecord record = {physicalAddress, bitMask, value};
+    step.push_back(record);
+}
+
+bool PinConfigCompiler::compile(const std::string& text, std::vector<uint8_t>& image, std::string& error)
+{
+    std::vector<ParsedPin> pins;
+    if(!parse(text, pins, error))
+    {
+        return false;
+    }
+
+    std::vector<PinConfigRecord> steps[headerPinController::NUMBER_OF_STEPS];
+    std::vector<HeaderPinRequest> requests;
+
+    for(uint32_t i = 0; i < pins.size(); i++)
+    {
+        const HeaderPinRequest& request = pins[i].request;
+        uint32_t bitMask;
+        uint32_t value;
+
+        HeaderPinController::getPinmuxUpdate(request, bitMask, value);
+        addRecord(steps[headerPinController::STEP_PINMUX], pinmuxController::baseAddress + HeaderPinController::getHeaderPin(request.headerPin).pinmuxOffset, bitMask, value);
+
+        if(pins[i].padPreset != NO_PRESET)
+        {
+            uint32_t addressOffset;
+            PadGroupController::getHeaderPinUpdate(request.headerPin, pins[i].padPreset, addressOffset, bitMask, value);
+            addRecord(steps[headerPinController::STEP_PINMUX], padGroupController::baseAddress + addressOffset, bitMask, value);
+        }
+
+        requests.push_back(request);
+    }
+
+    std::vector<HeaderPinPortUpdate> ports;
+    HeaderPinController::getPortUpdates(requests, ports);
+
+    for(uint32_t i = 0; i < ports.size(); i++)
+    {
+        const HeaderPinPortUpdate& port = ports[i];
+
+        if(port.outMask != 0)
+        {
+            addRecord(steps[headerPinController::STEP_OUT], gpioController::gpioController1BaseAddress + gpioPortOffset(port.port, GPIO_MSK_OUT_0::addressOffset),
+                pinConfig::FULL_MASK, gpioMaskedValue(port.outMask, port.outValue));
+        }
+        if(port.oeClearMask != 0)
+        {
+            addRecord(steps[headerPinController::STEP_OE_CLEAR], gpioController::gpioController1BaseAddress + gpioPortOffset(port.port, GPIO_MSK_OE_0::addressOffset),
+                pinConfig::FULL_MASK, gpioMaskedValue(port.oeClearMask, 0));
+        }
+        if((port.gpioMask | port.sfioMask) != 0)
+        {
+            addRecord(steps[headerPinController::STEP_CNF], gpioController::gpioController1BaseAddress + gpioPortOffset(port.port, GPIO_MSK_CNF_0::addressOffset),
+                pinConfig::FULL_MASK, gpioMaskedValue(port.gpioMask | port.sfioMask, port.gpioMask));
+        }
+        if(port.oeSetMask != 0)
+        {
+            addRecord(steps[headerPinController::STEP_OE_SET], gpioController::gpioController1BaseAddress + gpioPortOffset(port.port, GPIO_MSK_OE_0::addressOffset),
+                pinConfig::FULL_MASK, gpioMaskedValue(port.oeSetMask, port.oeSetMask));
+        }
+    }
+
+    // Page then address order inside each step, the steps themselves stay in order
+    std::vector<PinConfigRecord> records;
+    std::vector<uint32_t> pages;
+    for(uint32_t i = 0; i < headerPinController::NUMBER_OF_STEPS; i++)
+    {
+        std::stable_sort(steps[i].begin(), steps[i].end(), [](const PinConfigRecord& a, const PinConfigRecord& b)
+        {
+            return a.physicalAddress < b.physicalAddress;
+        });
+
+        for(uint32_t j = 0; j < steps[i].size(); j++)
+        {
+            records.push_back(steps[i][j]);
+            pages.push_back(steps[i][j].physicalAddress & ~(PeripheralController::BLOCK_SIZE - 1));
+        }
+    }
+    std::sort(pages.begin(), pages.end());
+    pages.erase(std::unique(pages.begin(), pages.end()), pages.end());
+
+    PinConfigImageHeader header = {pinConfig::MAGIC, pinConfig::VERSION, (uint32_t)pages.size(), (uint32_t)records.size()};
+
+    image.resize(sizeof(header) + (pages.size()*sizeof(uint32_t)) + (records.size()*sizeof(PinConfigRecord)));
+    uint8_t* output = image.data();
+    memcpy(output, &header, sizeof(header));
+    output += sizeof(header);
+    if(!pages.empty())
+    {
+        memcpy(output, pages.data(), pages.size()*sizeof(uint32_t));
+        output += pages.size()*sizeof(uint32_t);
+    }
+    if(!records.empty())
+    {
+        memcpy(output, records.data(), records.size()*sizeof(PinConfigRecord));
+    }
+
+    return true;
+}
+
+PinConfigApplier::PinConfigApplier()
+{
+}
+
+bool PinConfigApplier::load(const std::vector<uint8_t>& image)
+{
+    PinConfigImageHeader header;
+
+    if(image.size() < sizeof(header))
+    {
+        return false;
+    }
+    memcpy(&header, image.data(), sizeof(header));
+
+    if((header.magic != pinConfig::MAGIC) || (header.version != pinConfig::VERSION) ||
+        (image.size() != (sizeof(header) + (header.numberOfPages*sizeof(uint32_t)) + (header.numberOfRecords*sizeof(PinConfigRecord)))))
+    {
+        return false;
+    }
+
+    pages.resize(header.numberOfPages);
+    records.resize(header.numberOfRecords);
+    if(!pages.empty())
+    {
+        memcpy(pages.data(), image.data() + sizeof(header), pages.size()*sizeof(uint32_t));
+    }
+    if(!records.empty())
+    {
+        memcpy(records.data(), image.data() + sizeof(header) + (pages.size()*sizeof(uint32_t)), records.size()*sizeof(PinConfigRecord));
+    }
+
+    for(uint32_t i = 0; i < pages.size(); i++)
+    {
+        if(((pages[i] & (PeripheralController::BLOCK_SIZE - 1)) != 0) || ((i > 0) && (pages[i] <= pages[i - 1])))
+        {
+            return false;
+        }
+    }
+
+    recordPages.resize(records.size());
+    for(uint32_t i = 0; i < records.size(); i++)
+    {
+        uint32_t page = records[i].physicalAddress & ~(PeripheralController::BLOCK_SIZE - 1);
+        std::vector<uint32_t>::const_iterator found = std::lower_bound(pages.begin(), pages.end(), page);
+        if((found == pages.end()) || (*found != page) || ((records[i].physicalAddress & 0x3) != 0))
+        {
+            return false;
+        }
+        recordPages[i] = found - pages.begin();
+    }
+
+    mappings.clear();
+    for(uint32_t i = 0; i < pages.size(); i++)
+    {
+        mappings.push_back(std::unique_ptr<PeripheralController>(new PeripheralController(pages[i])));
+    }
+
+    return true;
+}
+
+uint32_t PinConfigApplier::apply()
+{
+    uint32_t stores = 0;
+
+    for(uint32_t i = 0; i < records.size(); i++)
+    {
+        const PinConfigRecord& record = records[i];
+        PeripheralController& mapping = *mappings[recordPages[i]];
+        uint32_t addressOffset = record.physicalAddress & (PeripheralController::BLOCK_SIZE - 1);
+
+        if(record.bitMask == pinConfig::FULL_MASK)
+        {
+            mapping.setRegister(addressOffset, record.value);
+            stores++;
+            continue;
+        }
+
+        uint32_t current = mapping.getRegister(addressOffset);
+        uint32_t updated = (current & ~record.bitMask) | record.value;
+        if(updated != current)
+        {
+            mapping.setRegister(addressOffset, updated);
+            stores++;
+        }
+    }
+
+    return stores;
+}
+
+uint32_t PinConfigApplier::getNumberOfRecords()
+{
+    return records.size();
+}
@@ -0,0 +1,151 @@
+/**
+ * @file pinConfig.h
+ * @brief pin configuration compiler and image applier declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano declarative pin configuration
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class PinConfigCompiler
+ * @brief Compiles an INI style pin configuration into a binary apply image
+ *
+ * @section Description
+ *
+ * A configuration names header pins by number or by Tegra pad name, one
+ * section each. Everything but mode is optional:
+ *
+ *     ; status LED and a button
+ *     [pin 13]
+ *     mode = output     ; input, output or sfio
+ *     level = high      ; initial output level, low by default
+ *     edges = fastest   ; reset, fastest or slowest, pad group preset
+ *
+ *     [pin GPIO_PE6]
+ *     mode = input
+ *     pull = up         ; none, up or down
+ *
+ *     [pin UART2_TX]
+ *     mode = sfio       ; the pin's usual special function
+ *     input = off       ; input buffer, on by default
+ *
+ *     [pin 33]
+ *     mode = sfio
+ *     function = I2S5A  ; any other function of the pad, PWM2 otherwise
+ *
+ * Names resolve against the header pin table in HeaderPinController, which
+ * is built from the pinmuxController.h, gpio.h and padGroupController.h
+ * definitions. A function is named as in pinmuxController::PM_BIT_<name>
+ * and must be one of the pad's own, see HeaderPin::functions. Pad options
+ * are limited to what HeaderPinController sets: pull, input buffer and the
+ * pad group edge presets. The image holds exactly the writes HeaderPinController
+ * would issue, as (physical address, mask, value) records:
+ * ______________________________________________________________________
+ * Field    | Contents
+ * header   | PinConfigImageHeader, magic, version, page and record counts
+ * pages    | uint32_t physical address of every 4 KiB page touched, ascending
+ * records  | PinConfigRecord, in apply order
+ *
+ * A record with a mask of pinConfig::FULL_MASK is a plain store, the GPIO
+ * writes all go through the write only GPIO_MSK_* registers. Any other mask
+ * is a read modify write that is skipped when the bits already match.
+ *
+ * Records come in the same glitch free steps as HeaderPinController,
+ * pinmux and pad groups, OUT, OE clears, CNF, OE sets. Inside a step they
+ * are sorted by page and address, so the applier walks each page in one
+ * run. Reordering across steps would drive pins before their level is set,
+ * so the image is sorted by page only within a step.
+ *
+ * @class PinConfigApplier
+ * @brief Applies a compiled image
+ *
+ * Maps every page in the page table once, then streams the records. There
+ * is no parsing and no name lookup at apply time.
+ */
+
+#ifndef PIN_CONFIG_H
+#define PIN_CONFIG_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <memory>
+
+#include "../peripheralController/peripheralController.h"
+
+struct pinConfig
+{
+    static const uint32_t MAGIC = 0x434e504a; // "JPNC" little endian
+    static const uint32_t VERSION = 1;
+    static const uint32_t FULL_MASK = 0xFFFFFFFF;
+};
+
+struct PinConfigImageHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t numberOfPages;
+    uint32_t numberOfRecords;
+};
+
+struct PinConfigRecord
+{
+    uint32_t physicalAddress;
+    uint32_t bitMask;
+    uint32_t value;
+};
+
+class PinConfigCompiler
+{
+    public:
+        /*
+         * Returns false and a message naming the line on any error, the
+         * image is only written on success.
+         */
+        static bool compile(const std::string& text, std::vector<uint8_t>& image, std::string& error);
+};
+
+class PinConfigApplier
+{
+    public:
+        PinConfigApplier();
+
+        PinConfigApplier(const PinConfigApplier&) = delete;
+        PinConfigApplier& operator=(const PinConfigApplier&) = delete;
+
+        // Checks the header and sizes and maps the image's pages.
+        bool load(const std::vector<uint8_t>& image);
+
+        // Returns the number of stores issued.
+        uint32_t apply();
+
+        uint32_t getNumberOfRecords();
+
+    private:
+        std::vector<uint32_t> pages;
+        std::vector<std::unique_ptr<PeripheralController>> mappings;
+        std::vector<PinConfigRecord> records;
+        std::vector<uint32_t> recordPages; // index into mappings for every record
+};
+
+#endif //PIN_CONFIG_H
@@ -0,0 +1,304 @@
+#include "pinProfileController.h"
+#include "../padGroupController/padGroupController.h"
+#include "../pinmuxController/pinmuxController.h"
+#include "../gpioController/gpio.h"
+#include "../gpioController/gpioPin.h"
+#include <cstdint>
+#include <algorithm>
+#include <cassert>
+
+// Same bit in every header pad's pinmux register, see headerPinController.cpp
+static const uint32_t PINMUX_LOCK_bit = 7;
+
+static const uint32_t NO_PRESET = 0xFFFFFFFF;
+
+PinProfileController::PinProfileController() : pinmux(pinmuxController::baseAddress), padGroups(padGroupController::baseAddress),
+    gpio(gpioController::gpioController1BaseAddress)
+{
+    activeProfile = pinProfileController::NO_PROFILE;
+    prepared = false;
+}
+
+uint32_t PinProfileController::addProfile(const std::string& name, const std::vector<HeaderPinRequest>& requests)
+{
+    assert(!prepared);
+    assert(findProfile(name) == pinProfileController::NO_PROFILE);
+    assert(!requests.empty());
+
+    std::vector<HeaderPinRequest> sorted(requests);
+    std::sort(sorted.begin(), sorted.end(), [](const HeaderPinRequest& a, const HeaderPinRequest& b)
+    {
+        return a.headerPin < b.headerPin;
+    });
+
+    for(uint32_t i = 0; i < sorted.size(); i++)
+    {
+        assert(HeaderPinController::isGpioPin(sorted[i].headerPin));
+        assert((i == 0) || (sorted[i].headerPin != sorted[i - 1].headerPin));
+        assert(sorted[i].mode <= headerPinController::MODE_SFIO);
+    }
+
+    // Every profile covers the same pins
+    if(!profiles.empty())
+    {
+        assert(sorted.size() == profiles[0].size());
+        for(uint32_t i = 0; i < sorted.size(); i++)
+        {
+            assert(sorted[i].headerPin == profiles[0][i].headerPin);
+        }
+    }
+
+    names.push_back(name);
+    profiles.push_back(sorted);
+    return profiles.size() - 1;
+}
+
+uint32_t PinProfileController::findProfile(const std::string& name)
+{
+    for(uint32_t i = 0; i < names.size(); i++)
+    {
+        if(names[i] == name)
+        {
+            return i;
+        }
+    }
+    return pinProfileController::NO_PROFILE;
+}
+
+void PinProfileController::addWord(uint32_t physicalAddress, uint32_t profile, uint32_t bitMask, uint32_t value)
+{
+    Word* word = NULL;
+    for(uint32_t i = 0; i < words.size(); i++)
+    {
+        if(words[i].physicalAddress == physicalAddress)
+        {
+            word = &words[i];
+            break;
+        }
+    }
+
+    if(word == NULL)
+    {
+        Word newWord;
+        newWord.physicalAddress = physicalAddress;
+        newWord.registerAddress = (physicalAddress >= pinmuxController::baseAddress) ?
+            pinmux.getRegisterAddress(physicalAddress - pinmuxController::baseAddress) :
+            padGroups.getRegisterAddress(physicalAddress - padGroupController::baseAddress);
+        newWord.bitMasks.assign(profiles.size(), 0);
+        newWord.values.assign(profiles.size(), 0);
+        words.push_back(newWord);
+        word = &words.back();
+    }
+
+    word->bitMasks[profile] |= bitMask;
+    word->values[profile] = (word->values[profile] & ~bitMask) | value;
+}
+
+void PinProfileController::prepare()
+{
+    assert(!prepared);
+    assert(!profiles.empty());
+
+    uint32_t numberOfProfiles = profiles.size();
+
+    // Pinmux and pad group bits per profile
+    for(uint32_t profile = 0; profile < numberOfProfiles; profile++)
+    {
+        for(uint32_t i = 0; i < profiles[profile].size(); i++)
+        {
+            const HeaderPinRequest& request = profiles[profile][i];
+            uint32_t addressOffset;
+            uint32_t bitMask;
+            uint32_t value;
+
+            HeaderPinController::getPinmuxUpdate(request, bitMask, value);
+            addWord(pinmuxController::baseAddress + HeaderPinController::getHeaderPin(request.headerPin).pinmuxOffset, profile, bitMask, value);
+
+            uint32_t preset = NO_PRESET;
+            if((request.options & headerPinController::OPTION_FASTEST_EDGES) != 0)
+            {
+                preset = padGroupController::PRESET_FASTEST_EDGES;
+            }
+            else if((request.options & headerPinController::OPTION_SLOWEST_EDGES) != 0)
+            {
+                preset = padGroupController::PRESET_SLOWEST_EDGES;
+            }
+
+            if((preset != NO_PRESET) && PadGroupController::hasPadGroup(request.headerPin))
+            {
+                PadGroupController::getHeaderPinUpdate(request.headerPin, preset, addressOffset, bitMask, value);
+                addWord(padGroupController::baseAddress + addressOffset, profile, bitMask, value);
+            }
+        }
+    }
+
+    std::sort(words.begin(), words.end(), [](const Word& a, const Word& b)
+    {
+        return a.physicalAddress < b.physicalAddress;
+    });
+
+    // GPIO bits per profile
+    std::vector<std::vector<HeaderPinPortUpdate>> portUpdates(numberOfProfiles);
+    for(uint32_t profile = 0; profile < numberOfProfiles; profile++)
+    {
+        HeaderPinController::getPortUpdates(profiles[profile], portUpdates[profile]);
+    }
+
+    // Every profile has the same pins so the same ports, in the same order
+    for(uint32_t i = 0; i < portUpdates[0].size(); i++)
+    {
+        ports.push_back(portUpdates[0][i].port);
+        portPins.push_back(portUpdates[0][i].gpioMask | portUpdates[0][i].sfioMask);
+    }
+
+    // The prepare() state, then every profile on top of it
+    Image current;
+    for(uint32_t i = 0; i < words.size(); i++)
+    {
+        uint32_t value = *words[i].registerAddress;
+        if(words[i].physicalAddress >= pinmuxController::baseAddress)
+        {
+            assert(((value >> PINMUX_LOCK_bit) & 1) == pinmuxController::LOCK_BIT_DISABLE);
+        }
+        current.words.push_back(value);
+    }
+    for(uint32_t i = 0; i < ports.size(); i++)
+    {
+        uint32_t cnf = gpio.getRegister(gpioPortOffset(ports[i], GPIO_CNF_0_RMW::addressOffset));
+        assert(((cnf >> gpioPort::MSK_SHIFT) & portPins[i]) == 0);
+
+        PortImage port;
+        port.cnf = cnf & portPins[i];
+        port.oe = gpio.getRegister(gpioPortOffset(ports[i], GPIO_OE_0_RMW::addressOffset)) & portPins[i];
+        port.out = gpio.getRegister(gpioPortOffset(ports[i], GPIO_OUT_0_RMW::addressOffset)) & portPins[i];
+        current.ports.push_back(port);
+    }
+
+    // Bits a profile leaves alone take the value another profile sets
+    Image defaults = current;
+    for(uint32_t profile = 0; profile < numberOfProfiles; profile++)
+    {
+        for(uint32_t i = 0; i < words.size(); i++)
+        {
+            defaults.words[i] = (defaults.words[i] & ~words[i].bitMasks[profile]) | words[i].values[profile];
+        }
+        for(uint32_t i = 0; i < ports.size(); i++)
+        {
+            const HeaderPinPortUpdate& update = portUpdates[profile][i];
+            defaults.ports[i].out = (defaults.ports[i].out & ~update.outMask) | update.outValue;
+        }
+    }
+
+    std::vector<Image> images(numberOfProfiles, defaults);
+    for(uint32_t profile = 0; profile < numberOfProfiles; profile++)
+    {
+        Image& image = images[profile];
+        for(uint32_t i = 0; i < words.size(); i++)
+        {
+            image.words[i] = (image.words[i] & ~words[i].bitMasks[profile]) | words[i].values[profile];
+        }
+        for(uint32_t i = 0; i < ports.size(); i++)
+        {
+            const HeaderPinPortUpdate& update = portUpdates[profile][i];
+            image.ports[i].cnf = update.gpioMask;
+            image.ports[i].oe = update.oeSetMask;
+            image.ports[i].out = (image.ports[i].out & ~update.outMask) | update.outValue;
+        }
+    }
+
+    switches.resize((numberOfProfiles + 1)*numberOfProfiles);
+    for(uint32_t from = 0; from <= numberOfProfiles; from++)
+    {
+        const Image& fromImage = (from == numberOfProfiles) ? current : images[from];
+        for(uint32_t to = 0; to < numberOfProfiles; to++)
+        {
+            buildSwitch(fromImage, images[to], switches[(from*numberOfProfiles) + to]);
+        }
+    }
+
+    activeProfile = pinProfileController::NO_PROFILE;
+    prepared = true;
+}
+
+void PinProfileController::buildSwitch(const Image& from, const Image& to, std::vector<Store>& stores)
+{
+    stores.clear();
+
+    for(uint32_t i = 0; i < words.size(); i++)
+    {
+        if(from.words[i] != to.words[i])
+        {
+            Store store = {words[i].registerAddress, to.words[i]};
+            stores.push_back(store);
+        }
+    }
+
+    for(uint32_t i = 0; i < ports.size(); i++)
+    {
+        uint32_t changed = from.ports[i].out ^ to.ports[i].out;
+        if(changed != 0)
+        {
+            Store store = {gpio.getRegisterAddress(gpioPortOffset(ports[i], GPIO_MSK_OUT_0::addressOffset)), gpioMaskedValue(changed, to.ports[i].out)};
+            stores.push_back(store);
+        }
+    }
+
+    for(uint32_t i = 0; i < ports.size(); i++)
+    {
+        uint32_t clearBits = from.ports[i].oe & ~to.ports[i].oe;
+        if(clearBits != 0)
+        {
+            Store store = {gpio.getRegisterAddress(gpioPortOffset(ports[i], GPIO_MSK_OE_0::addressOffset)), gpioMaskedValue(clearBits, 0)};
+            stores.push_back(store);
+        }
+    }
+
+    for(uint32_t i = 0; i < ports.size(); i++)
+    {
+        uint32_t changed = from.ports[i].cnf ^ to.ports[i].cnf;
+        if(changed != 0)
+        {
+            Store store = {gpio.getRegisterAddress(gpioPortOffset(ports[i], GPIO_MSK_CNF_0::addressOffset)), gpioMaskedValue(changed, to.ports[i].cnf)};
+            stores.push_back(store);
+        }
+    }
+
+    for(uint32_t i = 0; i < ports.size(); i++)
+    {
+        uint32_t setBits = ~from.ports[i].oe & to.ports[i].oe;
+        if(setBits != 0)
+        {
+            Store store = {gpio.getRegisterAddress(gpioPortOffset(ports[i], GPIO_MSK_OE_0::addressOffset)), gpioMaskedValue(setBits, setBits)};
+            stores.push_back(store);
+        }
+    }
+}
+
+uint32_t PinProfileController::switchProfile(uint32_t profile)
+{
+    assert(prepared);
+    assert(profile < profiles.size());
+
+    if(profile == activeProfile)
+    {
+        return 0;
+    }
+
+    uint32_t from = (activeProfile == pinProfileController::NO_PROFILE) ? profiles.size() : activeProfile;
+    const std::vector<Store>& stores = switches[(from*profiles.size()) + profile];
+    const Store* store = stores.data();
+    uint32_t numberOfStores = stores.size();
+
+    for(uint32_t i = 0; i < numberOfStores; i++)
+    {
+        *store[i].registerAddress = store[i].value;
+    }
+
+    activeProfile = profile;
+    return numberOfStores;
+}
+
+uint32_t PinProfileController::getActiveProfile()
+{
+    return activeProfile;
+}
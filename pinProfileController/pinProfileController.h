@@ -0,0 +1,151 @@
+/**
+ * @file pinProfileController.h
+ * @brief pin function profile switching class declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano pin function profiles
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class PinProfileController
+ * @brief Switches a set of header pins between precomputed pin function profiles
+ *
+ * @section Description
+ *
+ * A profile is a list of HeaderPinRequest, for example SPI1 on header pins
+ * 19, 21, 23, 24 and 26 as SFIO in one profile and as GPIO for bit banging
+ * in another. Every profile must configure the same header pins.
+ *
+ * prepare() reads the pinmux, pad group and GPIO registers of those pins
+ * once and works out each profile's exact register image: the pinmux word
+ * of every pin, the pad group word when a profile asks for an edge preset,
+ * and the CNF, OE and OUT bits of every port. It then builds the store list
+ * between every pair of profiles, so switchProfile() is a loop of plain
+ * stores with no reads and no decisions:
+ * ______________________________________________________________________
+ * Step | Store                     | When
+ * 1    | pinmux, pad groups        | the word differs between the profiles
+ * 2    | GPIO_MSK_OUT              | an output level differs
+ * 3    | GPIO_MSK_OE, clears       | pins stop driving
+ * 4    | GPIO_MSK_CNF              | pins move between GPIO and SFIO
+ * 5    | GPIO_MSK_OE, sets         | outputs start driving, already at their level
+ *
+ * Bits a profile does not set, PM for a GPIO pin or OUT for an input, take
+ * the value another profile gives them, so they never cost a store. A GPIO
+ * pin keeps its SFIO function in PM and an SFIO pin keeps the GPIO level in
+ * OUT, so switching the five SPI1 pins between SPI and GPIO with unchanged
+ * pulls takes two stores on port C, CNF and one OE.
+ *
+ * The images assume nothing else writes these registers after prepare().
+ */
+
+#ifndef PIN_PROFILE_CONTROLLER_H
+#define PIN_PROFILE_CONTROLLER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../peripheralController/peripheralController.h"
+#include "../headerPinController/headerPinController.h"
+
+struct pinProfileController
+{
+    static const uint32_t NO_PROFILE = 0xFFFFFFFF;
+};
+
+class PinProfileController
+{
+    public:
+        PinProfileController();
+
+        PinProfileController(const PinProfileController&) = delete;
+        PinProfileController& operator=(const PinProfileController&) = delete;
+
+        // Profiles can only be added before prepare(). Returns the profile number.
+        uint32_t addProfile(const std::string& name, const std::vector<HeaderPinRequest>& requests);
+
+        // pinProfileController::NO_PROFILE when there is no profile called name.
+        uint32_t findProfile(const std::string& name);
+
+        /*
+         * Reads the current hardware state and builds every switch. The
+         * active profile is NO_PROFILE until the first switchProfile().
+         */
+        void prepare();
+
+        // Returns the number of stores issued, 0 when profile is already active.
+        uint32_t switchProfile(uint32_t profile);
+        uint32_t getActiveProfile();
+
+    private:
+        struct Store
+        {
+            volatile uint32_t* registerAddress;
+            uint32_t value;
+        };
+
+        // One pinmux or pad group register across all profiles
+        struct Word
+        {
+            uint32_t physicalAddress;
+            volatile uint32_t* registerAddress;
+            std::vector<uint32_t> bitMasks; // per profile
+            std::vector<uint32_t> values; // per profile
+        };
+
+        // One GPIO port's bits of the profile's pins
+        struct PortImage
+        {
+            uint32_t cnf;
+            uint32_t oe;
+            uint32_t out;
+        };
+
+        struct Image
+        {
+            std::vector<uint32_t> words; // indexed like PinProfileController::words
+            std::vector<PortImage> ports; // indexed like PinProfileController::ports
+        };
+
+        void addWord(uint32_t physicalAddress, uint32_t profile, uint32_t bitMask, uint32_t value);
+        void buildSwitch(const Image& from, const Image& to, std::vector<Store>& stores);
+
+        PeripheralController pinmux;
+        PeripheralController padGroups;
+        PeripheralController gpio;
+
+        std::vector<std::string> names;
+        std::vector<std::vector<HeaderPinRequest>> profiles;
+
+        std::vector<Word> words;
+        std::vector<uint32_t> ports; // ascending
+        std::vector<uint32_t> portPins; // bits of the profile pins per port
+
+        // Indexed by from*(number of profiles) + to over (number of profiles + 1) rows, from == number of profiles is the prepare() state
+        std::vector<std::vector<Store>> switches;
+        uint32_t activeProfile;
+        bool prepared;
+};
+
+#endif //PIN_PROFILE_CONTROLLER_H
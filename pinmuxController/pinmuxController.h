@@ -44,6 +44,8 @@
 
 #include <cstdint>
 
+#include "../peripheralController/peripheralController.h"
+
 struct pinmuxController
 {
     static const uint32_t baseAddress = 0x70003000;
@@ -136,6 +138,7 @@ struct pinmuxController
     static const uint32_t PM_BIT_UARTB_STATE_1 = 1;
     static const uint32_t PM_BIT_SDMMC1_STATE_1 = 1;
     static const uint32_t PM_BIT_CCLA = 1;
+    static const uint32_t PM_BIT_PWM0 = 1;
     static const uint32_t PM_BIT_SPDIF = 2;
     static const uint32_t PM_BIT_RSVD2 = 2;
     static const uint32_t PM_BIT_SPI3 = 2;
@@ -961,8 +964,8 @@ struct PINMUX_AUX_SPI1_CS1_0
     static const uint32_t TRISTATE_bit = 4;
     static const uint32_t TRISTATE_bitWidth = 1;
     
-    const uint32_t PUPD_bit = 2;
-    const uint32_t PUPD_bitWidth = 2;
+    static const uint32_t PUPD_bit = 2;
+    static const uint32_t PUPD_bitWidth = 2;
 
     static const uint32_t PM_bit = 0;
     static const uint32_t PM_bitWidth = 2;
@@ -2114,7 +2117,7 @@ struct PINMUX_AUX_UART1_TX_0
 // 9.15.56
 struct PINMUX_AUX_UART1_RX_0
 {
-    static const uint32_t addressOffset = 0xE48;
+    static const uint32_t addressOffset = 0xE8;
 
     static const uint32_t E_SCHMT_bit = 12;
     static const uint32_t E_SCHMT_bitWidth = 1;
@@ -3554,7 +3557,7 @@ struct PINMUX_AUX_GPIO_X3_AUD_0
     static const uint32_t PARK_bitWidth = 1;
 
     static const uint32_t TRISTATE_bit = 4;
-    const uint32_t TRISTATEf_bitWidth = 1;
+    static const uint32_t TRISTATE_bitWidth = 1;
     
     static const uint32_t PUPD_bit = 2;
     static const uint32_t PUPD_bitWidth = 2;
@@ -5917,4 +5920,17 @@ struct PINMUX_AUX_GPIO_PZ5_0
 
 };
 
+/*
+ * Hands one pad to an SFIO: selects function pm, drives the pad and sets the
+ * input buffer, which inputs and pads whose level is read back (clocks
+ * looped back to the controller) need enabled.
+ */
+template<typename PINMUX_AUX>
+inline void attachPad(PeripheralController& pinmux, uint32_t pm, uint32_t input = pinmuxController::E_INPUT_BIT_ENABLE)
+{
+    pinmux.setRegisterField(PINMUX_AUX::addressOffset, pm, PINMUX_AUX::PM_bit, PINMUX_AUX::PM_bitWidth);
+    pinmux.setRegisterField(PINMUX_AUX::addressOffset, input, PINMUX_AUX::E_INPUT_bit, PINMUX_AUX::E_INPUT_bitWidth);
+    pinmux.setRegisterField(PINMUX_AUX::addressOffset, pinmuxController::TRISTATE_BIT_PASSTHROUGH, PINMUX_AUX::TRISTATE_bit, PINMUX_AUX::TRISTATE_bitWidth);
+}
+
 #endif //PINMUX_CONTROLLER_H
@@ -0,0 +1,101 @@
+#include "pwmController.h"
+#include "../gpioController/gpio.h"
+#include "../gpioController/gpioPin.h"
+#include "../pinmuxController/pinmuxController.h"
+#include <cstdint>
+#include <cassert>
+
+PwmController::PwmController(uint32_t clockHz) : pwm(pwmController::baseAddress), clockHz(clockHz)
+{
+    assert(clockHz >= pwmController::PERIOD_STEPS);
+}
+
+uint32_t PwmController::configure(uint32_t channel, uint32_t frequencyHz, uint32_t duty)
+{
+    assert(frequencyHz > 0);
+    assert(duty <= pwmController::PWM_ALWAYS_HIGH);
+
+    // Round to the nearest divider the hardware has
+    uint64_t divider = ((uint64_t)clockHz + ((uint64_t)pwmController::PERIOD_STEPS*frequencyHz/2))/((uint64_t)pwmController::PERIOD_STEPS*frequencyHz);
+    uint32_t pfm = (divider == 0) ? 0 : divider - 1;
+    if(pfm > pwmController::MAX_PFM)
+    {
+        pfm = pwmController::MAX_PFM;
+    }
+
+    pwm.setRegister(getChannelOffset(channel),
+        (pwmController::ENB_BIT_ENABLE << PWM_CONTROLLER_PWM_CSR_0::ENB_bit) |
+        (duty << PWM_CONTROLLER_PWM_CSR_0::PWM_0_bit) |
+        (pfm << PWM_CONTROLLER_PWM_CSR_0::PFM_0_bit));
+
+    return getFrequency(channel);
+}
+
+void PwmController::setDuty(uint32_t channel, uint32_t duty)
+{
+    assert(duty <= pwmController::PWM_ALWAYS_HIGH);
+    pwm.setRegisterField(getChannelOffset(channel), duty, PWM_CONTROLLER_PWM_CSR_0::PWM_0_bit, PWM_CONTROLLER_PWM_CSR_0::PWM_0_bitWidth);
+}
+
+uint32_t PwmController::getDuty(uint32_t channel)
+{
+    return pwm.getRegisterField(getChannelOffset(channel), PWM_CONTROLLER_PWM_CSR_0::PWM_0_bit, PWM_CONTROLLER_PWM_CSR_0::PWM_0_bitWidth);
+}
+
+uint32_t PwmController::getFrequency(uint32_t channel)
+{
+    uint32_t pfm = pwm.getRegisterField(getChannelOffset(channel), PWM_CONTROLLER_PWM_CSR_0::PFM_0_bit, PWM_CONTROLLER_PWM_CSR_0::PFM_0_bitWidth);
+    return clockHz/(pwmController::PERIOD_STEPS*(pfm + 1));
+}
+
+void PwmController::enable(uint32_t channel)
+{
+    pwm.setRegisterField(getChannelOffset(channel), pwmController::ENB_BIT_ENABLE, PWM_CONTROLLER_PWM_CSR_0::ENB_bit, PWM_CONTROLLER_PWM_CSR_0::ENB_bitWidth);
+}
+
+void PwmController::disable(uint32_t channel)
+{
+    pwm.setRegisterField(getChannelOffset(channel), pwmController::ENB_BIT_DISABLE, PWM_CONTROLLER_PWM_CSR_0::ENB_bit, PWM_CONTROLLER_PWM_CSR_0::ENB_bitWidth);
+}
+
+bool PwmController::isEnabled(uint32_t channel)
+{
+    return pwm.getRegisterField(getChannelOffset(channel), PWM_CONTROLLER_PWM_CSR_0::ENB_bit, PWM_CONTROLLER_PWM_CSR_0::ENB_bitWidth) ==
+        pwmController::ENB_BIT_ENABLE;
+}
+
+uint32_t PwmController::attachHeaderPin(uint32_t headerPin)
+{
+    PeripheralController myPinMuxController(pinmuxController::baseAddress);
+    PeripheralController myGpioController(gpioController::gpioController1BaseAddress);
+
+    uint32_t channel = 0;
+    if(headerPin == 32)
+    {
+        // Header pin #32, SoM pin name: GPIO07, Tegra chip pin name: LCD_BL_PWM, GPIO Port PV.00
+        myPinMuxController.setRegisterField(PINMUX_AUX_LCD_BL_PWM_0::addressOffset, pinmuxController::PM_BIT_PWM0, PINMUX_AUX_LCD_BL_PWM_0::PM_bit, PINMUX_AUX_LCD_BL_PWM_0::PM_bitWidth);
+        myPinMuxController.setRegisterField(PINMUX_AUX_LCD_BL_PWM_0::addressOffset, pinmuxController::TRISTATE_BIT_PASSTHROUGH, PINMUX_AUX_LCD_BL_PWM_0::TRISTATE_bit, PINMUX_AUX_LCD_BL_PWM_0::TRISTATE_bitWidth);
+        myGpioController.setRegister(gpioPortOffset(gpioPort::PV, GPIO_MSK_CNF_0::addressOffset), gpioMaskedValue(1 << 0, gpioController::BIT_N_SPIO << 0));
+        channel = 0;
+    }
+    else if(headerPin == 33)
+    {
+        // Header pin #33, SoM pin name: GPIO13, Tegra chip pin name: GPIO_PE6, GPIO Port PE.06
+        myPinMuxController.setRegisterField(PINMUX_AUX_GPIO_PE6_0::addressOffset, pinmuxController::PM_BIT_PWM2, PINMUX_AUX_GPIO_PE6_0::PM_bit, PINMUX_AUX_GPIO_PE6_0::PM_bitWidth);
+        myPinMuxController.setRegisterField(PINMUX_AUX_GPIO_PE6_0::addressOffset, pinmuxController::TRISTATE_BIT_PASSTHROUGH, PINMUX_AUX_GPIO_PE6_0::TRISTATE_bit, PINMUX_AUX_GPIO_PE6_0::TRISTATE_bitWidth);
+        myGpioController.setRegister(gpioPortOffset(gpioPort::PE, GPIO_MSK_CNF_0::addressOffset), gpioMaskedValue(1 << 6, gpioController::BIT_N_SPIO << 6));
+        channel = 2;
+    }
+    else
+    {
+        assert(!"only header pins 32 and 33 have a PWM function");
+    }
+
+    return channel;
+}
+
+uint32_t PwmController::getChannelOffset(uint32_t channel)
+{
+    assert(channel < pwmController::NUMBER_OF_CHANNELS);
+    return PWM_CONTROLLER_PWM_CSR_0::addressOffset + (channel*pwmController::CHANNEL_STRIDE);
+}
@@ -0,0 +1,135 @@
+/**
+ * @file pwmController.h
+ * @brief PWM controller register declaration and class declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano PWM controller direct register access drivers
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class PwmController
+ * @brief Jetson PWM controller, four hardware PWM channels
+ *
+ * @section Description
+ *
+ * The PWM controller at 0x7000a000 has four channels, one CSR register each
+ * 0x10 apart. Each channel divides the PWM clock by (PFM + 1) and then by
+ * 256, so the output frequency is
+ *
+ *     clockHz/(256*(PFM + 1))
+ *
+ * and the output is high for PWM/256 of every period. A PWM value of 256 is
+ * always high.
+ *
+ * Two channels reach the 40 pin header:
+ * ________________________________________________________________
+ * Header Pin # | Tegra Pin Name | GPIO Port | Channel | Pinmux PM
+ * 32           | LCD_BL_PWM     | PV.00     | PWM0    | PM_BIT_PWM0
+ * 33           | GPIO_PE6       | PE.06     | PWM2    | PM_BIT_PWM2
+ *
+ * attachHeaderPin() switches one of those pads from GPIO to the PWM
+ * function in one call. The PWM clock must be running and out of reset,
+ * which the kernel normally does when the pwm node is enabled in the device
+ * tree, or CarController::bringUp(carController::PWM) does. clockHz is the
+ * rate it runs at (/sys/kernel/debug/clk/pwm/clk_rate), or what
+ * CarController::setClockRate returned.
+ */
+
+#ifndef PWM_CONTROLLER_H
+#define PWM_CONTROLLER_H
+
+#include <cstdint>
+
+#include "../peripheralController/peripheralController.h"
+
+struct pwmController
+{
+    static const uint32_t baseAddress = 0x7000a000;
+
+    static const uint32_t NUMBER_OF_CHANNELS = 4;
+    static const uint32_t CHANNEL_STRIDE = 0x10;
+
+    static const uint32_t ENB_BIT_DISABLE = 0;
+    static const uint32_t ENB_BIT_ENABLE = 1;
+
+    static const uint32_t PWM_ALWAYS_LOW = 0;
+    static const uint32_t PWM_ALWAYS_HIGH = 256;
+    static const uint32_t PERIOD_STEPS = 256;
+
+    static const uint32_t MAX_PFM = 0x1FFF;
+};
+
+// 37.3.1 PWM_CONTROLLER_PWM_CSR_0, channel n at addressOffset + n*pwmController::CHANNEL_STRIDE
+struct PWM_CONTROLLER_PWM_CSR_0
+{
+    static const uint32_t addressOffset = 0x00;
+
+    static const uint32_t ENB_bit = 31;
+    static const uint32_t ENB_bitWidth = 1;
+
+    static const uint32_t PWM_0_bit = 16;
+    static const uint32_t PWM_0_bitWidth = 15;
+
+    static const uint32_t PFM_0_bit = 0;
+    static const uint32_t PFM_0_bitWidth = 13;
+};
+
+class PwmController
+{
+    public:
+        PwmController(uint32_t clockHz);
+
+        PwmController(const PwmController&) = delete;
+        PwmController& operator=(const PwmController&) = delete;
+
+        /*
+         * Programs frequency and duty (0 - 256, 256 is always high) in one
+         * store and enables the channel. Returns the frequency actually
+         * produced, the divider only reaches clockHz/(256*n).
+         */
+        uint32_t configure(uint32_t channel, uint32_t frequencyHz, uint32_t duty);
+
+        // Changes the duty only, the new value applies from the next period.
+        void setDuty(uint32_t channel, uint32_t duty);
+        uint32_t getDuty(uint32_t channel);
+        uint32_t getFrequency(uint32_t channel);
+
+        void enable(uint32_t channel);
+        void disable(uint32_t channel);
+        bool isEnabled(uint32_t channel);
+
+        /*
+         * Header pin 32 or 33: sets the pad's pinmux to the PWM function,
+         * takes it out of tristate, and hands it from GPIO to the SFIO in
+         * GPIO_CNF. Returns the PWM channel the pin is driven by.
+         */
+        static uint32_t attachHeaderPin(uint32_t headerPin);
+
+    private:
+        static uint32_t getChannelOffset(uint32_t channel);
+
+        PeripheralController pwm;
+        const uint32_t clockHz;
+};
+
+#endif //PWM_CONTROLLER_H
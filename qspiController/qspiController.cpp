@@ -0,0 +1,282 @@
+#include "qspiController.h"
+#include "../gpioController/gpio.h"
+#include "../gpioController/gpioPin.h"
+#include "../pinmuxController/pinmuxController.h"
+#include "../timestamp/timestamp.h"
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cassert>
+
+// FIFO_STATUS bits that mean the last burst went wrong, all write 1 to clear
+static const uint32_t FIFO_ERROR_MASK = (1 << QSPI_FIFO_STATUS_0::ERR_bit) |
+    (1 << QSPI_FIFO_STATUS_0::TX_FIFO_OVF_bit) | (1 << QSPI_FIFO_STATUS_0::TX_FIFO_UNF_bit) |
+    (1 << QSPI_FIFO_STATUS_0::RX_FIFO_OVF_bit) | (1 << QSPI_FIFO_STATUS_0::RX_FIFO_UNF_bit);
+
+QspiController::QspiController() : qspi(qspiController::baseAddress)
+{
+    commandRegister = (qspiController::M_S_BIT_MASTER << QSPI_COMMAND_0::M_S_bit) |
+        (qspiController::MODE_0 << QSPI_COMMAND_0::MODE_bit) |
+        (1 << QSPI_COMMAND_0::CS_POL_INACTIVE_bit) |
+        (qspiController::CS_SW_HW_BIT_SOFTWARE << QSPI_COMMAND_0::CS_SW_HW_bit) |
+        (qspiController::CS_SW_VAL_BIT_HIGH << QSPI_COMMAND_0::CS_SW_VAL_bit) |
+        (1 << QSPI_COMMAND_0::PACKED_bit) |
+        (qspiController::BIT_LENGTH_8 << QSPI_COMMAND_0::BIT_LENGTH_bit);
+
+    readOpcode = qspiController::OPCODE_QUAD_OUTPUT_FAST_READ;
+    readAddressBytes = qspiController::DEFAULT_ADDRESS_BYTES;
+    readDummyBytes = qspiController::DEFAULT_DUMMY_BYTES;
+    reading = false;
+}
+
+uint32_t QspiController::configure(uint32_t sckHz, uint32_t mode)
+{
+    assert((mode == qspiController::MODE_0) || (mode == qspiController::MODE_3));
+
+    uint32_t bitMask = ((1 << QSPI_COMMAND_0::MODE_bitWidth) - 1) << QSPI_COMMAND_0::MODE_bit;
+    commandRegister = (commandRegister & ~bitMask) | (mode << QSPI_COMMAND_0::MODE_bit);
+    qspi.setRegister(QSPI_COMMAND_0::addressOffset, commandRegister);
+
+    return setClockRate(sckHz);
+}
+
+uint32_t QspiController::setClockRate(uint32_t sckHz)
+{
+    return clockAndReset.setClockRate(carController::QSPI, sckHz*qspiController::MODULE_CLOCK_PER_SCK)/qspiController::MODULE_CLOCK_PER_SCK;
+}
+
+void QspiController::enableController()
+{
+    clockAndReset.bringUp(carController::QSPI);
+    qspi.setRegister(QSPI_COMMAND_0::addressOffset, commandRegister);
+}
+
+void QspiController::setReadCommand(uint8_t opcode, uint32_t addressBytes, uint32_t dummyBytes)
+{
+    assert((addressBytes == 3) || (addressBytes == 4));
+    assert((1 + addressBytes + dummyBytes) <= qspiController::MAX_COMMAND_BYTES);
+    assert(!reading);
+
+    readOpcode = opcode;
+    readAddressBytes = addressBytes;
+    readDummyBytes = dummyBytes;
+}
+
+bool QspiController::command(const uint8_t* txData, uint32_t txLength, uint8_t* rxData, uint32_t rxLength)
+{
+    assert(!reading);
+
+    bool succeeded = flushFifos();
+    setChipSelect(true);
+    succeeded = succeeded && transmit(txData, txLength) && receive(rxData, rxLength, qspiController::INTERFACE_WIDTH_BIT_SINGLE);
+    setChipSelect(false);
+
+    return succeeded;
+}
+
+bool QspiController::read(uint32_t address, uint8_t* buffer, uint32_t length)
+{
+    bool succeeded = beginRead(address) && readNext(buffer, length);
+    endRead();
+
+    return succeeded;
+}
+
+bool QspiController::beginRead(uint32_t address)
+{
+    assert(!reading);
+
+    // Opcode, address most significant byte first, then dummy bytes
+    uint8_t readCommand[qspiController::MAX_COMMAND_BYTES];
+    uint32_t commandLength = 0;
+
+    readCommand[commandLength++] = readOpcode;
+    for(uint32_t i = readAddressBytes; i > 0; i--)
+    {
+        readCommand[commandLength++] = (uint8_t)(address >> (8*(i - 1)));
+    }
+    for(uint32_t i = 0; i < readDummyBytes; i++)
+    {
+        readCommand[commandLength++] = 0xFF;
+    }
+
+    reading = true;
+    if(!flushFifos())
+    {
+        return false;
+    }
+    setChipSelect(true);
+    return transmit(readCommand, commandLength);
+}
+
+bool QspiController::readNext(uint8_t* buffer, uint32_t length)
+{
+    assert(reading);
+    return receive(buffer, length, qspiController::INTERFACE_WIDTH_BIT_QUAD);
+}
+
+void QspiController::endRead()
+{
+    assert(reading);
+    setChipSelect(false);
+    reading = false;
+}
+
+/*
+ * Single line, PIO bursts of one FIFO load each. Commands are a handful of
+ * bytes so this never needs to stream.
+ */
+bool QspiController::transmit(const uint8_t* txData, uint32_t length)
+{
+    volatile uint32_t* txFifo = qspi.getRegisterAddress(QSPI_TX_FIFO_0::addressOffset);
+    uint32_t transferCommand = (commandRegister & ~(1 << QSPI_COMMAND_0::CS_SW_VAL_bit)) | (1 << QSPI_COMMAND_0::TX_EN_bit);
+
+    for(uint32_t offset = 0; offset < length; offset += qspiController::BURST_BYTES)
+    {
+        uint32_t burstLength = ((length - offset) < qspiController::BURST_BYTES) ? (length - offset) : qspiController::BURST_BYTES;
+
+        for(uint32_t i = 0; i < burstLength; i += qspiController::BYTES_PER_WORD)
+        {
+            uint32_t word = 0;
+            for(uint32_t j = 0; (j < qspiController::BYTES_PER_WORD) && ((i + j) < burstLength); j++)
+            {
+                word |= (uint32_t)txData[offset + i + j] << (8*j);
+            }
+            *txFifo = word;
+        }
+
+        qspi.setRegister(QSPI_DMA_BLK_SIZE_0::addressOffset, burstLength - 1);
+        qspi.setRegister(QSPI_COMMAND_0::addressOffset, transferCommand | (1 << QSPI_COMMAND_0::PIO_bit));
+        if(!waitReady())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+ * PIO bursts of one FIFO load, emptied once the burst is done. A run of
+ * whole words is copied straight into rxData, only the last word of a burst
+ * that is not a multiple of four bytes is unpacked byte by byte.
+ */
+bool QspiController::receive(uint8_t* rxData, uint32_t length, uint32_t interfaceWidth)
+{
+    volatile uint32_t* rxFifo = qspi.getRegisterAddress(QSPI_RX_FIFO_0::addressOffset);
+    uint32_t transferCommand = (commandRegister & ~(1 << QSPI_COMMAND_0::CS_SW_VAL_bit)) |
+        (1 << QSPI_COMMAND_0::RX_EN_bit) |
+        (interfaceWidth << QSPI_COMMAND_0::INTERFACE_WIDTH_bit);
+    bool succeeded = true;
+
+    for(uint32_t offset = 0; offset < length; offset += qspiController::BURST_BYTES)
+    {
+        uint32_t burstLength = ((length - offset) < qspiController::BURST_BYTES) ? (length - offset) : qspiController::BURST_BYTES;
+        uint32_t wholeWords = burstLength/qspiController::BYTES_PER_WORD;
+        uint32_t tailBytes = burstLength%qspiController::BYTES_PER_WORD;
+        uint8_t* destination = rxData + offset;
+
+        qspi.setRegister(QSPI_DMA_BLK_SIZE_0::addressOffset, burstLength - 1);
+        qspi.setRegister(QSPI_COMMAND_0::addressOffset, transferCommand | (1 << QSPI_COMMAND_0::PIO_bit));
+
+        if(!waitReady())
+        {
+            succeeded = false;
+            break;
+        }
+
+        for(uint32_t i = 0; i < wholeWords; i++)
+        {
+            uint32_t word = *rxFifo;
+            memcpy(destination + (i*qspiController::BYTES_PER_WORD), &word, qspiController::BYTES_PER_WORD);
+        }
+
+        if(tailBytes > 0)
+        {
+            uint32_t word = *rxFifo;
+            for(uint32_t j = 0; j < tailBytes; j++)
+            {
+                destination[(wholeWords*qspiController::BYTES_PER_WORD) + j] = (uint8_t)(word >> (8*j));
+            }
+        }
+    }
+
+    // Back to single line so the next command phase starts out right
+    qspi.setRegister(QSPI_COMMAND_0::addressOffset, commandRegister & ~(1 << QSPI_COMMAND_0::CS_SW_VAL_bit));
+    return succeeded;
+}
+
+// False on a timeout or a FIFO error, the controller is recovered either way
+bool QspiController::waitReady()
+{
+    volatile uint32_t* transferStatus = qspi.getRegisterAddress(QSPI_TRANSFER_STATUS_0::addressOffset);
+    uint64_t start = Timestamp::now();
+    while(((*transferStatus >> QSPI_TRANSFER_STATUS_0::RDY_bit) & 1) == 0)
+    {
+        if((Timestamp::now() - start) > qspiController::TIMEOUT_NS)
+        {
+            recover();
+            return false;
+        }
+    }
+    *transferStatus = 1 << QSPI_TRANSFER_STATUS_0::RDY_bit;
+
+    if((qspi.getRegister(QSPI_FIFO_STATUS_0::addressOffset) & FIFO_ERROR_MASK) != 0)
+    {
+        recover();
+        return false;
+    }
+
+    return true;
+}
+
+bool QspiController::flushFifos()
+{
+    uint32_t flushMask = (1 << QSPI_FIFO_STATUS_0::RX_FIFO_FLUSH_bit) | (1 << QSPI_FIFO_STATUS_0::TX_FIFO_FLUSH_bit);
+    volatile uint32_t* fifoStatus = qspi.getRegisterAddress(QSPI_FIFO_STATUS_0::addressOffset);
+
+    *fifoStatus = flushMask;
+    uint64_t start = Timestamp::now();
+    while((*fifoStatus & flushMask) != 0)
+    {
+        if((Timestamp::now() - start) > qspiController::TIMEOUT_NS)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Drops whatever the failed burst left behind
+void QspiController::recover()
+{
+    flushFifos();
+    qspi.setRegister(QSPI_FIFO_STATUS_0::addressOffset, FIFO_ERROR_MASK);
+    qspi.setRegister(QSPI_TRANSFER_STATUS_0::addressOffset, 1 << QSPI_TRANSFER_STATUS_0::RDY_bit);
+}
+
+void QspiController::setChipSelect(bool asserted)
+{
+    uint32_t value = commandRegister;
+    if(asserted)
+    {
+        value &= ~(1 << QSPI_COMMAND_0::CS_SW_VAL_bit);
+    }
+    qspi.setRegister(QSPI_COMMAND_0::addressOffset, value);
+}
+
+void QspiController::attachPads()
+{
+    PeripheralController myPinMuxController(pinmuxController::baseAddress);
+    PeripheralController myGpioController(gpioController::gpioController1BaseAddress);
+
+    // Not on the header, GPIO Port PEE.00 - PEE.05
+    attachPad<PINMUX_AUX_QSPI_SCK_0>(myPinMuxController, pinmuxController::PM_BIT_QSPI);
+    attachPad<PINMUX_AUX_QSPI_CS_N_0>(myPinMuxController, pinmuxController::PM_BIT_QSPI);
+    attachPad<PINMUX_AUX_QSPI_IO0_0>(myPinMuxController, pinmuxController::PM_BIT_QSPI);
+    attachPad<PINMUX_AUX_QSPI_IO1_0>(myPinMuxController, pinmuxController::PM_BIT_QSPI);
+    attachPad<PINMUX_AUX_QSPI_IO2_0>(myPinMuxController, pinmuxController::PM_BIT_QSPI);
+    attachPad<PINMUX_AUX_QSPI_IO3_0>(myPinMuxController, pinmuxController::PM_BIT_QSPI);
+    myGpioController.setRegister(gpioPortOffset(gpioPort::PEE, GPIO_MSK_CNF_0::addressOffset), gpioMaskedValue(0x3F, gpioController::BIT_N_SPIO));
+}
@@ -0,0 +1,365 @@
+/**
+ * @file qspiController.h
+ * @brief QSPI controller register declaration and class declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano QSPI controller direct register access drivers
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class QspiController
+ * @brief Polled quad SPI master for reading NOR flash on the Tegra QSPI controller
+ *
+ * @section Description
+ *
+ * Tegra210 has one QSPI controller at 0x70410000. Its pads (QSPI_SCK,
+ * QSPI_CS_N, QSPI_IO0 - QSPI_IO3, GPIO Port PEE.00 - PEE.05) are not on the
+ * 40 pin header. On the SD card Jetson Nano module they go to the on module
+ * boot flash, so anything but reads there will brick the board. On a
+ * carrier that brings them out they can drive an external flash.
+ *
+ * The register layout is the SPI controller's with two additions in
+ * COMMAND: INTERFACE_WIDTH picks one, two or four data lines for the next
+ * burst, SDR_DDR_SEL picks the clock edge. A flash read is a command phase
+ * followed by a data phase:
+ * ______________________________________________________________
+ * Phase    | Lines | Contents
+ * command  | 1     | opcode, 3 or 4 address bytes, dummy bytes
+ * data     | 4     | length bytes, streamed through the RX FIFO
+ *
+ * Chip select is driven in software so it stays asserted between the two
+ * phases and between calls to readNext(). The default read command is Quad
+ * Output Fast Read (0x6B, 1-1-4) with 8 dummy clocks, which every quad
+ * capable NOR flash supports once its QE bit is set.
+ *
+ * The data phase is split into PIO bursts of one FIFO load (64 words, 256
+ * bytes). Each burst is started, waited on until RDY, then the RX FIFO is
+ * emptied, so a reader that gets preempted can never overflow the FIFO.
+ * Whole words go straight to the caller's buffer, bytes are only unpacked
+ * at the tail.
+ *
+ * Every poll gives up after qspiController::TIMEOUT_NS, and FIFO_STATUS is
+ * checked for ERR and overflow or underflow after every burst. command(),
+ * read(), beginRead() and readNext() return false on either, with the
+ * FIFOs flushed and the error bits cleared. A streaming read that fails
+ * still needs endRead().
+ *
+ * SCK is half the QSPI module clock, which comes from PLLP_OUT0 (408 MHz)
+ * through CLK_SOURCE_QSPI, see setClockRate().
+ */
+
+#ifndef QSPI_CONTROLLER_H
+#define QSPI_CONTROLLER_H
+
+#include <cstdint>
+
+#include "../peripheralController/peripheralController.h"
+#include "../carController/carController.h"
+
+struct qspiController
+{
+    static const uint32_t baseAddress = 0x70410000;
+
+    static const uint32_t FIFO_DEPTH = 64; // 32 bit words
+    static const uint32_t BYTES_PER_WORD = 4;
+    static const uint32_t BURST_BYTES = FIFO_DEPTH*BYTES_PER_WORD; // one PIO burst never outgrows the FIFO
+
+    static const uint64_t TIMEOUT_NS = 10000000; // no RDY or flush for this long fails the transfer
+
+    static const uint32_t MODE_0 = 0; // CPOL 0, CPHA 0
+    static const uint32_t MODE_3 = 3; // CPOL 1, CPHA 1
+
+    static const uint32_t M_S_BIT_MASTER = 1;
+
+    static const uint32_t CS_SW_HW_BIT_SOFTWARE = 1;
+
+    static const uint32_t CS_SW_VAL_BIT_LOW = 0;
+    static const uint32_t CS_SW_VAL_BIT_HIGH = 1;
+
+    static const uint32_t INTERFACE_WIDTH_BIT_SINGLE = 0;
+    static const uint32_t INTERFACE_WIDTH_BIT_DUAL = 1;
+    static const uint32_t INTERFACE_WIDTH_BIT_QUAD = 2;
+
+    static const uint32_t BIT_LENGTH_8 = 7; // bits per word - 1
+
+    // SCK = module clock/2
+    static const uint32_t MODULE_CLOCK_PER_SCK = 2;
+
+    static const uint8_t OPCODE_READ_STATUS = 0x05;
+    static const uint8_t OPCODE_READ_JEDEC_ID = 0x9F;
+    static const uint8_t OPCODE_QUAD_OUTPUT_FAST_READ = 0x6B;
+    static const uint8_t OPCODE_QUAD_OUTPUT_FAST_READ_4B = 0x6C;
+
+    static const uint32_t DEFAULT_ADDRESS_BYTES = 3;
+    static const uint32_t DEFAULT_DUMMY_BYTES = 1; // 8 clocks on one line
+    static const uint32_t MAX_COMMAND_BYTES = 16;
+};
+
+// QSPI_COMMAND_0
+struct QSPI_COMMAND_0
+{
+    static const uint32_t addressOffset = 0x000;
+
+    static const uint32_t PIO_bit = 31;
+    static const uint32_t PIO_bitWidth = 1;
+
+    static const uint32_t M_S_bit = 30;
+    static const uint32_t M_S_bitWidth = 1;
+
+    static const uint32_t MODE_bit = 28;
+    static const uint32_t MODE_bitWidth = 2;
+
+    static const uint32_t CS_SEL_bit = 26;
+    static const uint32_t CS_SEL_bitWidth = 2;
+
+    static const uint32_t CS_POL_INACTIVE_bit = 22;
+    static const uint32_t CS_POL_INACTIVE_bitWidth = 1;
+
+    static const uint32_t CS_SW_HW_bit = 21;
+    static const uint32_t CS_SW_HW_bitWidth = 1;
+
+    static const uint32_t CS_SW_VAL_bit = 20;
+    static const uint32_t CS_SW_VAL_bitWidth = 1;
+
+    static const uint32_t IDLE_SDA_bit = 18;
+    static const uint32_t IDLE_SDA_bitWidth = 2;
+
+    static const uint32_t LSBIT_FE_bit = 16;
+    static const uint32_t LSBIT_FE_bitWidth = 1;
+
+    static const uint32_t LSBYTE_FE_bit = 15;
+    static const uint32_t LSBYTE_FE_bitWidth = 1;
+
+    static const uint32_t RX_EN_bit = 12;
+    static const uint32_t RX_EN_bitWidth = 1;
+
+    static const uint32_t TX_EN_bit = 11;
+    static const uint32_t TX_EN_bitWidth = 1;
+
+    static const uint32_t SDR_DDR_SEL_bit = 9;
+    static const uint32_t SDR_DDR_SEL_bitWidth = 1;
+
+    static const uint32_t INTERFACE_WIDTH_bit = 7;
+    static const uint32_t INTERFACE_WIDTH_bitWidth = 2;
+
+    static const uint32_t PACKED_bit = 5;
+    static const uint32_t PACKED_bitWidth = 1;
+
+    static const uint32_t BIT_LENGTH_bit = 0;
+    static const uint32_t BIT_LENGTH_bitWidth = 5;
+};
+
+// QSPI_COMMAND2_0
+struct QSPI_COMMAND2_0
+{
+    static const uint32_t addressOffset = 0x004;
+
+    static const uint32_t TX_TAP_DELAY_bit = 10;
+    static const uint32_t TX_TAP_DELAY_bitWidth = 5;
+
+    static const uint32_t RX_TAP_DELAY_bit = 0;
+    static const uint32_t RX_TAP_DELAY_bitWidth = 8;
+};
+
+// QSPI_CS_TIMING1_0
+struct QSPI_CS_TIMING1_0
+{
+    static const uint32_t addressOffset = 0x008;
+};
+
+// QSPI_CS_TIMING2_0
+struct QSPI_CS_TIMING2_0
+{
+    static const uint32_t addressOffset = 0x00C;
+};
+
+// QSPI_TRANSFER_STATUS_0
+struct QSPI_TRANSFER_STATUS_0
+{
+    static const uint32_t addressOffset = 0x010;
+
+    static const uint32_t RDY_bit = 30; // write 1 to clear
+    static const uint32_t RDY_bitWidth = 1;
+
+    static const uint32_t BLK_CNT_bit = 0;
+    static const uint32_t BLK_CNT_bitWidth = 16;
+};
+
+// QSPI_FIFO_STATUS_0
+struct QSPI_FIFO_STATUS_0
+{
+    static const uint32_t addressOffset = 0x014;
+
+    static const uint32_t RX_FIFO_FULL_COUNT_bit = 23;
+    static const uint32_t RX_FIFO_FULL_COUNT_bitWidth = 7;
+
+    static const uint32_t TX_FIFO_EMPTY_COUNT_bit = 16;
+    static const uint32_t TX_FIFO_EMPTY_COUNT_bitWidth = 7;
+
+    static const uint32_t RX_FIFO_FLUSH_bit = 15;
+    static const uint32_t RX_FIFO_FLUSH_bitWidth = 1;
+
+    static const uint32_t TX_FIFO_FLUSH_bit = 14;
+    static const uint32_t TX_FIFO_FLUSH_bitWidth = 1;
+
+    static const uint32_t ERR_bit = 8;
+    static const uint32_t ERR_bitWidth = 1;
+
+    static const uint32_t TX_FIFO_OVF_bit = 7;
+    static const uint32_t TX_FIFO_OVF_bitWidth = 1;
+
+    static const uint32_t TX_FIFO_UNF_bit = 6;
+    static const uint32_t TX_FIFO_UNF_bitWidth = 1;
+
+    static const uint32_t RX_FIFO_OVF_bit = 5;
+    static const uint32_t RX_FIFO_OVF_bitWidth = 1;
+
+    static const uint32_t RX_FIFO_UNF_bit = 4;
+    static const uint32_t RX_FIFO_UNF_bitWidth = 1;
+
+    static const uint32_t TX_FIFO_FULL_bit = 3;
+    static const uint32_t TX_FIFO_FULL_bitWidth = 1;
+
+    static const uint32_t TX_FIFO_EMPTY_bit = 2;
+    static const uint32_t TX_FIFO_EMPTY_bitWidth = 1;
+
+    static const uint32_t RX_FIFO_FULL_bit = 1;
+    static const uint32_t RX_FIFO_FULL_bitWidth = 1;
+
+    static const uint32_t RX_FIFO_EMPTY_bit = 0;
+    static const uint32_t RX_FIFO_EMPTY_bitWidth = 1;
+};
+
+// QSPI_TX_DATA_0
+struct QSPI_TX_DATA_0
+{
+    static const uint32_t addressOffset = 0x018;
+};
+
+// QSPI_RX_DATA_0
+struct QSPI_RX_DATA_0
+{
+    static const uint32_t addressOffset = 0x01C;
+};
+
+// QSPI_DMA_CTL_0
+struct QSPI_DMA_CTL_0
+{
+    static const uint32_t addressOffset = 0x020;
+
+    static const uint32_t DMA_EN_bit = 31;
+    static const uint32_t DMA_EN_bitWidth = 1;
+};
+
+// QSPI_DMA_BLK_SIZE_0, number of words in the next transfer - 1
+struct QSPI_DMA_BLK_SIZE_0
+{
+    static const uint32_t addressOffset = 0x024;
+
+    static const uint32_t DMA_BLOCK_SIZE_bit = 0;
+    static const uint32_t DMA_BLOCK_SIZE_bitWidth = 16;
+};
+
+// QSPI_TX_FIFO_0, every store pushes one word
+struct QSPI_TX_FIFO_0
+{
+    static const uint32_t addressOffset = 0x108;
+};
+
+// QSPI_RX_FIFO_0, every load pops one word
+struct QSPI_RX_FIFO_0
+{
+    static const uint32_t addressOffset = 0x188;
+};
+
+class QspiController
+{
+    public:
+        QspiController();
+
+        QspiController(const QspiController&) = delete;
+        QspiController& operator=(const QspiController&) = delete;
+
+        /*
+         * Master mode 0 or 3 and SCK in one go. Returns the SCK rate
+         * actually produced, which never exceeds sckHz.
+         */
+        uint32_t configure(uint32_t sckHz, uint32_t mode);
+
+        uint32_t setClockRate(uint32_t sckHz);
+
+        // Starts the module clock and pulses the controller's reset.
+        void enableController();
+
+        /*
+         * Read command used by read() and beginRead(). addressBytes is 3 or
+         * 4, dummyBytes are sent on one line, 8 dummy clocks each.
+         */
+        void setReadCommand(uint8_t opcode, uint32_t addressBytes, uint32_t dummyBytes);
+
+        /*
+         * Single line command with chip select held across both halves,
+         * for example OPCODE_READ_JEDEC_ID with a 3 byte response. Returns
+         * false on a timeout or FIFO error.
+         */
+        bool command(const uint8_t* txData, uint32_t txLength, uint8_t* rxData, uint32_t rxLength);
+
+        // length bytes from flash address into buffer, false on a timeout or FIFO error
+        bool read(uint32_t address, uint8_t* buffer, uint32_t length);
+
+        /*
+         * Streaming read. beginRead() sends the read command and leaves
+         * chip select asserted, every readNext() continues from where the
+         * last one stopped and endRead() releases the flash. Call
+         * endRead() even when beginRead() or readNext() returned false.
+         */
+        bool beginRead(uint32_t address);
+        bool readNext(uint8_t* buffer, uint32_t length);
+        void endRead();
+
+        /*
+         * Pinmux QSPI_SCK, QSPI_CS_N and QSPI_IO0 - IO3 to the QSPI function
+         * with the input buffers on, out of tristate, and the GPIO
+         * controller handing PEE.00 - PEE.05 to the SFIO.
+         */
+        static void attachPads();
+
+    private:
+        bool transmit(const uint8_t* txData, uint32_t length);
+        bool receive(uint8_t* rxData, uint32_t length, uint32_t interfaceWidth);
+        bool waitReady();
+        bool flushFifos();
+        void recover();
+        void setChipSelect(bool asserted);
+
+        PeripheralController qspi;
+        CarController clockAndReset;
+        uint32_t commandRegister;
+
+        uint8_t readOpcode;
+        uint32_t readAddressBytes;
+        uint32_t readDummyBytes;
+        bool reading;
+};
+
+#endif //QSPI_CONTROLLER_H
@@ -0,0 +1,243 @@
+#include "realTimeExecutor.h"
+#include "../timestamp/timestamp.h"
+#include "../delay/delay.h"
+#include <cstdint>
+#include <cstring>
+#include <cerrno>
+#include <cstdlib>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <cassert>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+
+// Enough stack for the loop body to never take a page fault on it
+static const uint32_t STACK_PREFAULT_BYTES = 64*1024;
+
+static std::string describeError(const char* step)
+{
+    return std::string(step) + ": " + std::strerror(errno);
+}
+
+RealTimeExecutor::RealTimeExecutor(int cpu, int priority, uint32_t maxSamples) : cpu(cpu), priority(priority)
+{
+    assert(maxSamples > 0);
+
+    samples.resize(maxSamples);
+
+    report.memoryLocked = false;
+    report.affinitySet = false;
+    report.cpuIsolated = false;
+    report.priorityRaised = false;
+    report.prefaultedPeripherals = 0;
+}
+
+void RealTimeExecutor::addPeripheral(PeripheralController& peripheral, uint32_t safeOffset)
+{
+    Peripheral entry;
+    entry.controller = &peripheral;
+    entry.safeOffset = safeOffset;
+    peripherals.push_back(entry);
+}
+
+RealTimeExecutorReport RealTimeExecutor::setup()
+{
+    report.problems.clear();
+
+    report.memoryLocked = (mlockall(MCL_CURRENT | MCL_FUTURE) == 0);
+    if(!report.memoryLocked)
+    {
+        report.problems.push_back(describeError("mlockall"));
+    }
+
+    prefaultStack();
+    std::fill(samples.begin(), samples.end(), 0);
+
+    report.prefaultedPeripherals = 0;
+    for(uint32_t i = 0; i < peripherals.size(); i++)
+    {
+        (*peripherals[i].controller).prefault(peripherals[i].safeOffset);
+        report.prefaultedPeripherals++;
+    }
+
+    report.affinitySet = false;
+    report.cpuIsolated = false;
+    if(cpu >= 0)
+    {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(cpu, &cpuSet);
+        report.affinitySet = (sched_setaffinity(0, sizeof(cpuSet), &cpuSet) == 0);
+        if(!report.affinitySet)
+        {
+            report.problems.push_back(describeError("sched_setaffinity"));
+        }
+
+        report.cpuIsolated = isCpuIsolated(cpu);
+        if(!report.cpuIsolated)
+        {
+            std::ostringstream message;
+            message << "cpu " << cpu << " is not isolated, add isolcpus=" << cpu << " to the kernel command line";
+            report.problems.push_back(message.str());
+        }
+    }
+
+    report.priorityRaised = false;
+    if(priority > 0)
+    {
+        sched_param parameters;
+        parameters.sched_priority = priority;
+        report.priorityRaised = (sched_setscheduler(0, SCHED_FIFO, &parameters) == 0);
+        if(!report.priorityRaised)
+        {
+            report.problems.push_back(describeError("sched_setscheduler SCHED_FIFO"));
+        }
+    }
+
+    isSetUp = true;
+    return report;
+}
+
+RealTimeExecutorReport RealTimeExecutor::getReport()
+{
+    return report;
+}
+
+void RealTimeExecutor::run(const std::function<bool()>& body, uint64_t periodNs)
+{
+    if(!isSetUp)
+    {
+        setup();
+    }
+
+    iterations = 0;
+    numberOfSamples = 0;
+    minPeriodNs = UINT64_MAX;
+    maxPeriodNs = 0;
+    sumPeriodNs = 0;
+    overruns = 0;
+
+    uint64_t* sampleArray = samples.data();
+    uint64_t sampleCapacity = samples.size();
+    uint64_t previousStart = 0;
+    uint64_t deadline = Timestamp::now() + periodNs;
+
+    for(;;)
+    {
+        if(periodNs != 0)
+        {
+            Delay::sleepUntil(deadline);
+        }
+
+        uint64_t start = Timestamp::now();
+        if(previousStart != 0)
+        {
+            uint64_t period = start - previousStart;
+            sampleArray[numberOfSamples%sampleCapacity] = period;
+            numberOfSamples++;
+            sumPeriodNs += period;
+            minPeriodNs = std::min(minPeriodNs, period);
+            maxPeriodNs = std::max(maxPeriodNs, period);
+        }
+        previousStart = start;
+
+        iterations++;
+        if(!body())
+        {
+            break;
+        }
+
+        if(periodNs != 0)
+        {
+            deadline += periodNs;
+            uint64_t currentTime = Timestamp::now();
+            if(currentTime > deadline)
+            {
+                // Skip the periods already missed instead of bursting through them
+                uint64_t missedPeriods = ((currentTime - deadline)/periodNs) + 1;
+                deadline += missedPeriods*periodNs;
+                overruns += missedPeriods;
+            }
+        }
+    }
+}
+
+LoopStatistics RealTimeExecutor::getStatistics()
+{
+    LoopStatistics statistics;
+    std::memset(&statistics, 0, sizeof(statistics));
+
+    statistics.iterations = iterations;
+    statistics.overruns = overruns;
+    if(numberOfSamples == 0)
+    {
+        return statistics;
+    }
+
+    statistics.minPeriodNs = minPeriodNs;
+    statistics.maxPeriodNs = maxPeriodNs;
+    statistics.meanPeriodNs = sumPeriodNs/numberOfSamples;
+
+    std::vector<uint64_t> sorted(samples.begin(), samples.begin() + std::min<uint64_t>(numberOfSamples, samples.size()));
+    std::sort(sorted.begin(), sorted.end());
+
+    statistics.p50PeriodNs = sorted[(sorted.size() - 1)*50/100];
+    statistics.p90PeriodNs = sorted[(sorted.size() - 1)*90/100];
+    statistics.p99PeriodNs = sorted[(sorted.size() - 1)*99/100];
+    statistics.p999PeriodNs = sorted[(sorted.size() - 1)*999/1000];
+
+    return statistics;
+}
+
+/*
+ * /sys/devices/system/cpu/isolated holds a cpu list such as "2-3,5", or an
+ * empty line when nothing is isolated.
+ */
+bool RealTimeExecutor::isCpuIsolated(int cpu)
+{
+    std::ifstream isolatedFile("/sys/devices/system/cpu/isolated");
+    std::string cpuList;
+    if(!std::getline(isolatedFile, cpuList))
+    {
+        return false;
+    }
+
+    std::istringstream ranges(cpuList);
+    std::string range;
+    while(std::getline(ranges, range, ','))
+    {
+        if(range.empty())
+        {
+            continue;
+        }
+
+        size_t dash = range.find('-');
+        int first = std::atoi(range.substr(0, dash).c_str());
+        int last = (dash == std::string::npos) ? first : std::atoi(range.substr(dash + 1).c_str());
+        if((cpu >= first) && (cpu <= last))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool RealTimeExecutor::raiseThreadPriority(std::thread& thread)
+{
+    sched_param parameters;
+    parameters.sched_priority = sched_get_priority_max(SCHED_FIFO) - 1;
+    return (pthread_setschedparam(thread.native_handle(), SCHED_FIFO, &parameters) == 0);
+}
+
+void RealTimeExecutor::prefaultStack()
+{
+    volatile uint8_t stack[STACK_PREFAULT_BYTES];
+    for(uint32_t i = 0; i < STACK_PREFAULT_BYTES; i += 256)
+    {
+        stack[i] = 0;
+    }
+    (void)stack;
+}
@@ -0,0 +1,146 @@
+/**
+ * @file realTimeExecutor.h
+ * @brief real-time loop executor class declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano real-time loop executor
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class RealTimeExecutor
+ * @brief Sets up the calling thread for a tight register loop and runs it
+ *
+ * @section Description
+ *
+ * setup() does the usual real-time preparation on the calling thread:
+ *
+ * 1. mlockall so nothing is paged out once the loop starts.
+ * 2. Touches the stack and the statistics buffer so they are resident.
+ * 3. Reads one register of every PeripheralController added with
+ *    addPeripheral so the register pages are mapped and in the TLB.
+ * 4. Moves the thread to the requested cpu and checks whether that cpu is
+ *    listed in /sys/devices/system/cpu/isolated.
+ * 5. Switches the thread to SCHED_FIFO at the requested priority.
+ *
+ * Every step is best effort. Whatever could not be done is reported in
+ * RealTimeExecutorReport::problems and the loop still runs, so the same
+ * code works unprivileged on a development machine.
+ *
+ * run() calls the body until it returns false and records the time between
+ * the start of consecutive iterations. With a period the body is started
+ * on absolute Timestamp::now() deadlines instead of back to back, sleeping
+ * until shortly before each deadline and spinning the rest of the way.
+ */
+
+#ifndef REAL_TIME_EXECUTOR_H
+#define REAL_TIME_EXECUTOR_H
+
+#include <cstdint>
+#include <vector>
+#include <string>
+#include <functional>
+#include <thread>
+
+#include "../peripheralController/peripheralController.h"
+
+struct RealTimeExecutorReport
+{
+    bool memoryLocked;
+    bool affinitySet;
+    bool cpuIsolated;
+    bool priorityRaised;
+    uint32_t prefaultedPeripherals;
+    std::vector<std::string> problems;
+};
+
+struct LoopStatistics
+{
+    uint64_t iterations;
+    uint64_t overruns; // periodic loops only, iterations that started late by a whole period
+    uint64_t minPeriodNs;
+    uint64_t maxPeriodNs;
+    uint64_t meanPeriodNs;
+    uint64_t p50PeriodNs;
+    uint64_t p90PeriodNs;
+    uint64_t p99PeriodNs;
+    uint64_t p999PeriodNs;
+};
+
+class RealTimeExecutor
+{
+    public:
+        /*
+         * cpu -1 leaves the affinity alone, priority 0 leaves the scheduler
+         * alone. Percentiles are computed over the last maxSamples periods,
+         * min, max and mean over all of them.
+         */
+        RealTimeExecutor(int cpu = -1, int priority = 80, uint32_t maxSamples = 100000);
+
+        void addPeripheral(PeripheralController& peripheral, uint32_t safeOffset = 0);
+
+        RealTimeExecutorReport setup();
+        RealTimeExecutorReport getReport();
+
+        /*
+         * Calls setup() if it has not been called yet, then calls body until
+         * it returns false. periodNs 0 runs the body back to back.
+         */
+        void run(const std::function<bool()>& body, uint64_t periodNs = 0);
+
+        LoopStatistics getStatistics();
+
+        static bool isCpuIsolated(int cpu);
+
+        /*
+         * Moves a worker thread to SCHED_FIFO just below the highest
+         * priority. Best effort, without privileges the thread stays
+         * SCHED_OTHER and false is returned.
+         */
+        static bool raiseThreadPriority(std::thread& thread);
+
+    private:
+        struct Peripheral
+        {
+            PeripheralController* controller;
+            uint32_t safeOffset;
+        };
+
+        void prefaultStack();
+
+        const int cpu;
+        const int priority;
+
+        std::vector<Peripheral> peripherals;
+        RealTimeExecutorReport report;
+        bool isSetUp = false;
+
+        std::vector<uint64_t> samples;
+        uint64_t iterations = 0;
+        uint64_t numberOfSamples = 0;
+        uint64_t minPeriodNs = 0;
+        uint64_t maxPeriodNs = 0;
+        uint64_t sumPeriodNs = 0;
+        uint64_t overruns = 0;
+};
+
+#endif //REAL_TIME_EXECUTOR_H
@@ -0,0 +1,153 @@
+#include "registerDiff.h"
+#include "../gpioController/gpio.h"
+#include "../gpioController/gpioPin.h"
+#include <cstdint>
+#include <algorithm>
+#include <cassert>
+
+// Port offset within a GPIO controller, the same for every register
+static const uint32_t GPIO_PORT_MASK = 0xC;
+static const uint32_t GPIO_REGISTER_MASK = 0xF0;
+static const uint32_t GPIO_PIN_BITS = 0xFF;
+
+static void addStore(std::vector<RegisterStore>& step, uint32_t registerAddress, uint32_t storeAddress, uint32_t storeValue, uint32_t currentValue, uint32_t newValue)
+{
+    RegisterStore store = {registerAddress, storeAddress, storeValue, currentValue, newValue};
+    step.push_back(store);
+}
+
+RegisterDiff::RegisterDiff()
+{
+}
+
+void RegisterDiff::plan(const std::vector<RegisterTarget>& desired, std::vector<RegisterStore>& stores)
+{
+    stores.clear();
+
+    // Stable so that later targets on the same address are merged last
+    merged = desired;
+    std::stable_sort(merged.begin(), merged.end(), [](const RegisterTarget& a, const RegisterTarget& b)
+    {
+        return a.physicalAddress < b.physicalAddress;
+    });
+
+    uint32_t numberOfTargets = 0;
+    for(uint32_t i = 0; i < merged.size(); i++)
+    {
+        assert((merged[i].physicalAddress & 0x3) == 0);
+        uint32_t value = merged[i].value & merged[i].bitMask;
+
+        if((numberOfTargets > 0) && (merged[numberOfTargets - 1].physicalAddress == merged[i].physicalAddress))
+        {
+            RegisterTarget& target = merged[numberOfTargets - 1];
+            target.value = (target.value & ~merged[i].bitMask) | value;
+            target.bitMask |= merged[i].bitMask;
+        }
+        else
+        {
+            merged[numberOfTargets] = merged[i];
+            merged[numberOfTargets].value = value;
+            numberOfTargets++;
+        }
+    }
+    merged.resize(numberOfTargets);
+
+    for(uint32_t i = 0; i < headerPinController::NUMBER_OF_STEPS; i++)
+    {
+        steps[i].clear();
+    }
+
+    // Ascending addresses, so this is one pass per page
+    for(uint32_t i = 0; i < merged.size(); i++)
+    {
+        const RegisterTarget& target = merged[i];
+        uint32_t currentValue = getMapping(target.physicalAddress).getRegister(target.physicalAddress & (PeripheralController::BLOCK_SIZE - 1));
+        uint32_t newValue = (currentValue & ~target.bitMask) | target.value;
+        uint32_t changed = currentValue ^ newValue;
+
+        if(changed == 0)
+        {
+            continue;
+        }
+
+        uint32_t gpioOffset = target.physicalAddress - gpioController::gpioController1BaseAddress;
+        bool isGpio = (target.physicalAddress >= gpioController::gpioController1BaseAddress) && (gpioOffset < PeripheralController::BLOCK_SIZE);
+        uint32_t registerOffset = gpioOffset & GPIO_REGISTER_MASK;
+
+        if(!isGpio || ((changed & ~GPIO_PIN_BITS) != 0) || (registerOffset > GPIO_OUT_0_RMW::addressOffset))
+        {
+            // Pinmux, pad groups, other registers and the CNF lock bits
+            uint32_t step = (isGpio && (registerOffset == GPIO_CNF_0_RMW::addressOffset)) ? headerPinController::STEP_CNF : headerPinController::STEP_PINMUX;
+            addStore(steps[step], target.physicalAddress, target.physicalAddress, newValue, currentValue, newValue);
+            continue;
+        }
+
+        uint32_t port = ((gpioOffset/gpioPort::CONTROLLER_STRIDE)*gpioPort::PORTS_PER_CONTROLLER) + ((gpioOffset & GPIO_PORT_MASK)/gpioPort::PORT_STRIDE);
+
+        if(registerOffset == GPIO_CNF_0_RMW::addressOffset)
+        {
+            addStore(steps[headerPinController::STEP_CNF], target.physicalAddress, gpioController::gpioController1BaseAddress + gpioPortOffset(port, GPIO_MSK_CNF_0::addressOffset),
+                gpioMaskedValue(changed, newValue), currentValue, newValue);
+        }
+        else if(registerOffset == GPIO_OUT_0_RMW::addressOffset)
+        {
+            addStore(steps[headerPinController::STEP_OUT], target.physicalAddress, gpioController::gpioController1BaseAddress + gpioPortOffset(port, GPIO_MSK_OUT_0::addressOffset),
+                gpioMaskedValue(changed, newValue), currentValue, newValue);
+        }
+        else
+        {
+            // Drivers turn off before CNF moves and on only after it, one store each
+            uint32_t storeAddress = gpioController::gpioController1BaseAddress + gpioPortOffset(port, GPIO_MSK_OE_0::addressOffset);
+            uint32_t clearBits = changed & ~newValue;
+            uint32_t setBits = changed & newValue;
+
+            if(clearBits != 0)
+            {
+                addStore(steps[headerPinController::STEP_OE_CLEAR], target.physicalAddress, storeAddress, gpioMaskedValue(clearBits, 0),
+                    currentValue, currentValue & ~clearBits);
+            }
+            if(setBits != 0)
+            {
+                addStore(steps[headerPinController::STEP_OE_SET], target.physicalAddress, storeAddress, gpioMaskedValue(setBits, setBits),
+                    currentValue & ~clearBits, newValue);
+            }
+        }
+    }
+
+    // Targets were visited in address order, so every step already is too
+    for(uint32_t i = 0; i < headerPinController::NUMBER_OF_STEPS; i++)
+    {
+        stores.insert(stores.end(), steps[i].begin(), steps[i].end());
+    }
+}
+
+uint32_t RegisterDiff::apply(const std::vector<RegisterStore>& stores)
+{
+    for(uint32_t i = 0; i < stores.size(); i++)
+    {
+        getMapping(stores[i].storeAddress).setRegister(stores[i].storeAddress & (PeripheralController::BLOCK_SIZE - 1), stores[i].storeValue);
+    }
+
+    return stores.size();
+}
+
+uint32_t RegisterDiff::update(const std::vector<RegisterTarget>& desired)
+{
+    plan(desired, updateStores);
+    return apply(updateStores);
+}
+
+PeripheralController& RegisterDiff::getMapping(uint32_t physicalAddress)
+{
+    uint32_t page = physicalAddress & ~(PeripheralController::BLOCK_SIZE - 1);
+    std::vector<uint32_t>::iterator found = std::lower_bound(pages.begin(), pages.end(), page);
+    uint32_t index = found - pages.begin();
+
+    if((found == pages.end()) || (*found != page))
+    {
+        pages.insert(found, page);
+        mappings.insert(mappings.begin() + index, std::unique_ptr<PeripheralController>(new PeripheralController(page)));
+    }
+
+    return *mappings[index];
+}
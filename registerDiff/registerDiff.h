@@ -0,0 +1,111 @@
+/**
+ * @file registerDiff.h
+ * @brief minimal write register diff class declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano minimal write register diff
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class RegisterDiff
+ * @brief Turns a desired register state into the fewest stores that reach it
+ *
+ * @section Description
+ *
+ * The desired state is a list of (physical address, mask, value) targets on
+ * the pinmux, pad group and GPIO registers, or any other register that reads
+ * back what was written. plan() reads every targeted register once, grouped
+ * by page in ascending address order, and keeps only the registers whose
+ * masked bits differ. Nothing is written, so plan() on its own is a dry run
+ * and the returned stores say what would change.
+ *
+ * GPIO_CNF, GPIO_OE and GPIO_OUT changes become single GPIO_MSK_* stores of
+ * only the changed bits, so they need no read modify write when applied.
+ * Any other change, including the CNF lock bits, is a whole word store of the
+ * value computed from the read.
+ *
+ * Stores come out in the same glitch free order as HeaderPinController:
+ * pinmux, pad groups and other registers, OUT, OE clears, CNF, OE sets. Each
+ * step is sorted by address.
+ *
+ * apply() writes the planned values as they are, so plan right before
+ * applying when something else may touch the same registers.
+ */
+
+#ifndef REGISTER_DIFF_H
+#define REGISTER_DIFF_H
+
+#include <cstdint>
+#include <vector>
+#include <memory>
+
+#include "../peripheralController/peripheralController.h"
+#include "../headerPinController/headerPinController.h"
+
+struct RegisterTarget
+{
+    uint32_t physicalAddress;
+    uint32_t bitMask;
+    uint32_t value; // bits outside bitMask are ignored
+};
+
+struct RegisterStore
+{
+    uint32_t registerAddress; // the register that changes
+    uint32_t storeAddress; // where the store goes, a GPIO_MSK_* register for GPIO changes
+    uint32_t storeValue;
+    uint32_t currentValue; // of registerAddress when planned
+    uint32_t newValue; // of registerAddress once applied
+};
+
+class RegisterDiff
+{
+    public:
+        RegisterDiff();
+
+        RegisterDiff(const RegisterDiff&) = delete;
+        RegisterDiff& operator=(const RegisterDiff&) = delete;
+
+        /*
+         * Later targets win for bits that more than one target on the same
+         * address sets. Only reads, stores is cleared first.
+         */
+        void plan(const std::vector<RegisterTarget>& desired, std::vector<RegisterStore>& stores);
+
+        // Returns the number of stores issued.
+        uint32_t apply(const std::vector<RegisterStore>& stores);
+
+        // plan() then apply(), returns the number of stores issued.
+        uint32_t update(const std::vector<RegisterTarget>& desired);
+
+    private:
+        PeripheralController& getMapping(uint32_t physicalAddress);
+
+        std::vector<uint32_t> pages; // ascending
+        std::vector<std::unique_ptr<PeripheralController>> mappings; // one per page
+        std::vector<RegisterTarget> merged;
+        std::vector<RegisterStore> steps[headerPinController::NUMBER_OF_STEPS];
+        std::vector<RegisterStore> updateStores;
+};
+
+#endif //REGISTER_DIFF_H
@@ -0,0 +1,246 @@
+#!/usr/bin/env python3
+#
+# Generates registerMetadataTable.h from the register structs in
+# pinmuxController.h, padGroupController.h and gpio.h, and the reset
+# column of pinmuxController/README.md.
+#
+# Run from anywhere after changing any of those files:
+#     python3 registerMetadata/generateRegisterMetadata.py
+#
+# Jetson Nano register metadata
+# Copyright (C) 2026  Matthew Hardenburgh
+# mdhardenburgh@protonmail.com
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# any later version.
+
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+PINMUX_BASE = 0x70003000
+PAD_GROUP_BASE = 0x70000000
+GPIO_BASE = 0x6000d000
+
+# Pinmux offsets in the README are from PAD_GROUP_BASE, the structs are from PINMUX_BASE
+README_PINMUX_OFFSET = PINMUX_BASE - PAD_GROUP_BASE
+
+NUMBER_OF_SLOTS = 1024
+NUMBER_OF_BUCKETS = 256
+EMPTY_SLOT = 0xFFFF
+
+GPIO_PORTS = ['A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+    'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'AA', 'BB', 'CC', 'DD', 'EE']
+
+# Readable per port GPIO registers: TRM name, port A struct, reset value (None when it has none)
+GPIO_REGISTERS = [
+    ('GPIO_CNF', 'GPIO_CNF_0_RMW', 0),
+    ('GPIO_OE', 'GPIO_OE_0_RMW', 0),
+    ('GPIO_OUT', 'GPIO_OUT_0_RMW', 0),
+    ('GPIO_IN', 'GPIO_IN_0_RMW', None),
+    ('GPIO_INT_STA', 'GPIO_INT_STATUS_0_RMW', 0),
+    ('GPIO_INT_ENB', 'GPIO_INT_ENB_0', 0),
+    ('GPIO_INT_LVL', 'GPIO_INT_LEVEL_0_RMW', 0),
+]
+
+
+def readFile(path):
+    with open(os.path.join(ROOT, path)) as sourceFile:
+        return sourceFile.read()
+
+
+def parseStructs(text):
+    """Returns {name: (addressOffset, [(field, bit, bitWidth)])} in file order."""
+    structs = {}
+    order = []
+    for match in re.finditer(r'^struct\s+(\w+)\s*\n\{(.*?)\n\};', text, re.S | re.M):
+        name, body = match.group(1), match.group(2)
+        offset = re.search(r'addressOffset\s*=\s*(0x[0-9A-Fa-f]+|\d+)\s*;', body)
+        if offset is None:
+            continue
+
+        constants = dict((key, int(value, 0)) for key, value in
+            re.findall(r'static const uint32_t\s+(\w+)\s*=\s*(0x[0-9A-Fa-f]+|\d+)\s*;', body))
+        fields = []
+        for key in re.findall(r'static const uint32_t\s+(\w+?)_(?:bit|baseBit)\s*=', body):
+            for suffix in ('_bit', '_baseBit'):
+                if (key + suffix) in constants and (key + '_bitWidth') in constants:
+                    fields.append((key, constants[key + suffix], constants[key + '_bitWidth']))
+                    break
+            else:
+                sys.exit('%s.%s has a bit but no bitWidth' % (name, key))
+
+        structs[name] = (int(offset.group(1), 0), fields)
+        order.append(name)
+    return [(name,) + structs[name] for name in order]
+
+
+def parseResetValues(text, sectionPrefix, offsetBias):
+    resets = {}
+    for line in text.splitlines():
+        cells = [cell.strip() for cell in line.strip().strip('|').split('|')]
+        if len(cells) < 5 or not cells[0].startswith(sectionPrefix):
+            continue
+        resets[int(cells[2], 0) - offsetBias] = (cells[1], int(cells[4], 0))
+    return resets
+
+
+def fnv(name, seed):
+    value = (2166136261 ^ ((seed * 0x9e3779b9) & 0xFFFFFFFF)) & 0xFFFFFFFF
+    for character in name.encode():
+        value = ((value ^ character) * 16777619) & 0xFFFFFFFF
+    value ^= value >> 16
+    value = (value * 0x7feb352d) & 0xFFFFFFFF
+    value ^= value >> 15
+    return value
+
+
+def buildPerfectHash(names):
+    buckets = [[] for _ in range(NUMBER_OF_BUCKETS)]
+    for index, name in enumerate(names):
+        buckets[fnv(name, 0) % NUMBER_OF_BUCKETS].append(index)
+
+    slots = [EMPTY_SLOT] * NUMBER_OF_SLOTS
+    displacements = [0] * NUMBER_OF_BUCKETS
+    for bucket in sorted(range(NUMBER_OF_BUCKETS), key=lambda b: -len(buckets[b])):
+        if not buckets[bucket]:
+            continue
+        for seed in range(1, 0xFFFF):
+            wanted = [fnv(names[index], seed) % NUMBER_OF_SLOTS for index in buckets[bucket]]
+            if len(set(wanted)) == len(wanted) and all(slots[slot] == EMPTY_SLOT for slot in wanted):
+                for slot, index in zip(wanted, buckets[bucket]):
+                    slots[slot] = index
+                displacements[bucket] = seed
+                break
+        else:
+            sys.exit('no displacement found for bucket %d' % bucket)
+    return displacements, slots
+
+
+def main():
+    readme = readFile('pinmuxController/README.md')
+    pinmuxResets = parseResetValues(readme, '9.15.', README_PINMUX_OFFSET)
+    padGroupResets = parseResetValues(readme, '21.1.', 0)
+
+    layouts = []
+    layoutIndex = {}
+    registers = []
+
+    def addLayout(fields):
+        key = tuple(fields)
+        if key not in layoutIndex:
+            layoutIndex[key] = len(layouts)
+            layouts.append(key)
+        return layoutIndex[key]
+
+    def addBlock(structs, block, base, resets):
+        missing = 0
+        for name, offset, fields in structs:
+            reset = resets.get(offset)
+            if reset is None:
+                missing += 1
+            elif reset[0] != name:
+                sys.stderr.write('note: %s at 0x%x is %s in the README\n' % (name, offset, reset[0]))
+            registers.append((name, block, base, offset, None if reset is None else reset[1], 'registerMetadata::ACCESS_READ_WRITE', addLayout(fields)))
+        if missing > 0:
+            sys.stderr.write('note: %d %s registers have no reset value in the README\n' % (missing, block.split('::')[1]))
+
+    addBlock(parseStructs(readFile('pinmuxController/pinmuxController.h')), 'registerMetadata::BLOCK_PINMUX', PINMUX_BASE, pinmuxResets)
+    addBlock(parseStructs(readFile('padGroupController/padGroupController.h')), 'registerMetadata::BLOCK_PAD_GROUP', PAD_GROUP_BASE, padGroupResets)
+
+    gpioStructs = dict((name, (offset, fields)) for name, offset, fields in parseStructs(readFile('gpioController/gpio.h')))
+    for prefix, structName, reset in GPIO_REGISTERS:
+        offset, fields = gpioStructs[structName]
+        layout = addLayout(fields)
+        access = 'registerMetadata::ACCESS_READ_ONLY' if prefix == 'GPIO_IN' else 'registerMetadata::ACCESS_READ_WRITE'
+        for port, portName in enumerate(GPIO_PORTS):
+            portOffset = ((port // 4) * 0x100) + ((port % 4) * 0x4) + offset
+            registers.append(('%s_%s' % (prefix, portName), 'registerMetadata::BLOCK_GPIO', GPIO_BASE, portOffset, reset, access, layout))
+
+    names = [register[0] for register in registers]
+    if len(set(names)) != len(names):
+        sys.exit('duplicate register names')
+    if len(names) > NUMBER_OF_SLOTS:
+        sys.exit('more registers than slots, raise NUMBER_OF_SLOTS')
+
+    displacements, slots = buildPerfectHash(names)
+
+    fields = []
+    layoutRows = []
+    for layout in layouts:
+        layoutRows.append((len(fields), len(layout)))
+        fields.extend(layout)
+
+    out = []
+    out.append('/**')
+    out.append(' * @file registerMetadataTable.h')
+    out.append(' * @brief generated register metadata table, do not edit')
+    out.append(' *')
+    out.append(' * Generated by generateRegisterMetadata.py from pinmuxController.h,')
+    out.append(' * padGroupController.h, gpio.h and pinmuxController/README.md.')
+    out.append(' */')
+    out.append('')
+    out.append('#ifndef REGISTER_METADATA_TABLE_H')
+    out.append('#define REGISTER_METADATA_TABLE_H')
+    out.append('')
+    out.append('#include <cstdint>')
+    out.append('')
+    out.append('#include "registerMetadataTypes.h"')
+    out.append('')
+    out.append('struct registerMetadataTable')
+    out.append('{')
+    out.append('    static const uint32_t NUMBER_OF_REGISTERS = %d;' % len(registers))
+    out.append('    static const uint32_t NUMBER_OF_LAYOUTS = %d;' % len(layouts))
+    out.append('    static const uint32_t NUMBER_OF_FIELDS = %d;' % len(fields))
+    out.append('    static const uint32_t NUMBER_OF_BUCKETS = %d;' % NUMBER_OF_BUCKETS)
+    out.append('    static const uint32_t NUMBER_OF_SLOTS = %d;' % NUMBER_OF_SLOTS)
+    out.append('    static const uint16_t EMPTY_SLOT = 0x%X;' % EMPTY_SLOT)
+    out.append('')
+    out.append('    static constexpr RegisterFieldInfo fields[NUMBER_OF_FIELDS] =')
+    out.append('    {')
+    for name, bit, bitWidth in fields:
+        out.append('        {"%s", %d, %d},' % (name, bit, bitWidth))
+    out.append('    };')
+    out.append('')
+    out.append('    static constexpr RegisterLayoutInfo layouts[NUMBER_OF_LAYOUTS] =')
+    out.append('    {')
+    for firstField, numberOfFields in layoutRows:
+        out.append('        {%d, %d},' % (firstField, numberOfFields))
+    out.append('    };')
+    out.append('')
+    out.append('    static constexpr RegisterInfo registers[NUMBER_OF_REGISTERS] =')
+    out.append('    {')
+    for name, block, base, offset, reset, access, layout in registers:
+        hasReset = 'true' if reset is not None else 'false'
+        out.append('        {"%s", %s, 0x%08x, 0x%03x, 0x%08x, %s, %s, %d},' % (name, block, base, offset, reset or 0, hasReset, access, layout))
+    out.append('    };')
+    out.append('')
+    out.append('    // Seed of the second hash for each bucket of the first')
+    out.append('    static constexpr uint16_t displacements[NUMBER_OF_BUCKETS] =')
+    out.append('    {')
+    for row in range(0, NUMBER_OF_BUCKETS, 16):
+        out.append('        ' + ' '.join('%d,' % value for value in displacements[row:row + 16]))
+    out.append('    };')
+    out.append('')
+    out.append('    // Index into registers, EMPTY_SLOT when no name hashes here')
+    out.append('    static constexpr uint16_t slots[NUMBER_OF_SLOTS] =')
+    out.append('    {')
+    for row in range(0, NUMBER_OF_SLOTS, 16):
+        out.append('        ' + ' '.join('0x%04X,' % value for value in slots[row:row + 16]))
+    out.append('    };')
+    out.append('};')
+    out.append('')
+    out.append('#endif //REGISTER_METADATA_TABLE_H')
+
+    with open(os.path.join(ROOT, 'registerMetadata', 'registerMetadataTable.h'), 'w') as tableFile:
+        tableFile.write('\n'.join(out) + '\n')
+
+    print('%d registers, %d layouts, %d fields' % (len(registers), len(layouts), len(fields)))
+
+
+if __name__ == '__main__':
+    main()
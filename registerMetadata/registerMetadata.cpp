@@ -0,0 +1,78 @@
+#include "registerMetadata.h"
+#include "../pinmuxController/pinmuxController.h"
+#include "../padGroupController/padGroupController.h"
+#include "../gpioController/gpio.h"
+#include "../gpioController/gpioPin.h"
+#include <cstdint>
+#include <cstring>
+#include <cassert>
+
+// The table's storage, C++11 needs a definition for odr used constexpr members
+constexpr RegisterFieldInfo registerMetadataTable::fields[];
+constexpr RegisterLayoutInfo registerMetadataTable::layouts[];
+constexpr RegisterInfo registerMetadataTable::registers[];
+constexpr uint16_t registerMetadataTable::displacements[];
+constexpr uint16_t registerMetadataTable::slots[];
+
+// Catch a table that is stale against the structs it was generated from
+static_assert(registerMetadataTable::registers[RegisterMetadata::indexOf("PINMUX_AUX_SPI1_MOSI_0")].addressOffset ==
+    PINMUX_AUX_SPI1_MOSI_0::addressOffset, "registerMetadataTable.h is out of date");
+static_assert(registerMetadataTable::registers[RegisterMetadata::indexOf("GPIO_PE6_CFG")].addressOffset ==
+    GPIO_PE6_CFG::addressOffset, "registerMetadataTable.h is out of date");
+static_assert(registerMetadataTable::registers[RegisterMetadata::indexOf("GPIO_OE_EE")].addressOffset ==
+    (gpioPort::CONTROLLER_STRIDE*7) + (gpioPort::PORT_STRIDE*2) + GPIO_OE_0_RMW::addressOffset, "registerMetadataTable.h is out of date");
+static_assert(RegisterMetadata::indexOf("PINMUX_AUX_NOT_A_PAD_0") == registerMetadata::NOT_FOUND, "perfect hash accepts unknown names");
+
+const RegisterInfo* RegisterMetadata::find(const char* name)
+{
+    uint32_t index = indexOf(name);
+    if(index == registerMetadata::NOT_FOUND)
+    {
+        return NULL;
+    }
+    return &registerMetadataTable::registers[index];
+}
+
+uint32_t RegisterMetadata::getNumberOfRegisters()
+{
+    return registerMetadataTable::NUMBER_OF_REGISTERS;
+}
+
+const RegisterInfo& RegisterMetadata::getRegister(uint32_t index)
+{
+    assert(index < registerMetadataTable::NUMBER_OF_REGISTERS);
+    return registerMetadataTable::registers[index];
+}
+
+const RegisterFieldInfo* RegisterMetadata::getFields(const RegisterInfo& info, uint32_t& numberOfFields)
+{
+    const RegisterLayoutInfo& layout = registerMetadataTable::layouts[info.layout];
+    numberOfFields = layout.numberOfFields;
+    return &registerMetadataTable::fields[layout.firstField];
+}
+
+const RegisterFieldInfo* RegisterMetadata::findField(const RegisterInfo& info, const char* name)
+{
+    uint32_t numberOfFields;
+    const RegisterFieldInfo* fields = getFields(info, numberOfFields);
+
+    for(uint32_t i = 0; i < numberOfFields; i++)
+    {
+        if(strcmp(fields[i].name, name) == 0)
+        {
+            return &fields[i];
+        }
+    }
+    return NULL;
+}
+
+uint32_t RegisterMetadata::getPhysicalAddress(const RegisterInfo& info)
+{
+    return info.baseAddress + info.addressOffset;
+}
+
+uint32_t RegisterMetadata::getFieldValue(const RegisterFieldInfo& field, uint32_t registerValue)
+{
+    uint32_t bitMask = (field.bitWidth >= 32) ? 0xFFFFFFFF : ((1u << field.bitWidth) - 1);
+    return (registerValue >> field.bit) & bitMask;
+}
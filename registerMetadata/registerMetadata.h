@@ -0,0 +1,101 @@
+/**
+ * @file registerMetadata.h
+ * @brief register metadata lookup class declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano register metadata
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class RegisterMetadata
+ * @brief Name lookup and field decoding over the generated register table
+ *
+ * @section Description
+ *
+ * registerMetadataTable.h is generated by generateRegisterMetadata.py and
+ * describes every pinmux register, every pad group register and the
+ * readable registers of all 31 GPIO ports: name, block, offset, reset value
+ * and fields. Pinmux and pad group registers are named after their structs,
+ * GPIO registers after the TRM, GPIO_CNF_A through GPIO_INT_LVL_EE. The
+ * GPIO_MSK_* aliases and GPIO_INT_CLR are write only and not listed.
+ *
+ * Names are found with a perfect hash: the first hash picks a bucket, the
+ * bucket's displacement seeds a second hash that picks a slot, and the slot
+ * holds the only register that can match. A lookup is two hashes and one
+ * string compare, with no heap and no start up cost. indexOf() is
+ * constexpr, so names known at compile time resolve at compile time:
+ *
+ *     static_assert(RegisterMetadata::indexOf("GPIO_CNF_B") != registerMetadata::NOT_FOUND, "");
+ *
+ * Regenerate the table after changing pinmuxController.h,
+ * padGroupController.h, gpio.h or the pinmux README.
+ */
+
+#ifndef REGISTER_METADATA_H
+#define REGISTER_METADATA_H
+
+#include <cstdint>
+
+#include "registerMetadataTypes.h"
+#include "registerMetadataTable.h"
+
+class RegisterMetadata
+{
+    public:
+        // Index into the table, registerMetadata::NOT_FOUND for an unknown name.
+        static constexpr uint32_t indexOf(const char* name)
+        {
+            return checkSlot(name, registerMetadataTable::slots[registerNameHash(name,
+                registerMetadataTable::displacements[registerNameHash(name, 0) % registerMetadataTable::NUMBER_OF_BUCKETS]) %
+                registerMetadataTable::NUMBER_OF_SLOTS]);
+        }
+
+        // NULL for an unknown name.
+        static const RegisterInfo* find(const char* name);
+
+        static uint32_t getNumberOfRegisters();
+        static const RegisterInfo& getRegister(uint32_t index);
+
+        // The register's fields, most significant first for most registers.
+        static const RegisterFieldInfo* getFields(const RegisterInfo& info, uint32_t& numberOfFields);
+
+        // NULL when the register has no field called name.
+        static const RegisterFieldInfo* findField(const RegisterInfo& info, const char* name);
+
+        static uint32_t getPhysicalAddress(const RegisterInfo& info);
+        static uint32_t getFieldValue(const RegisterFieldInfo& field, uint32_t registerValue);
+
+    private:
+        static constexpr bool namesEqual(const char* a, const char* b)
+        {
+            return (*a == *b) && ((*a == '\0') || namesEqual(a + 1, b + 1));
+        }
+
+        static constexpr uint32_t checkSlot(const char* name, uint32_t index)
+        {
+            return ((index != registerMetadataTable::EMPTY_SLOT) && namesEqual(registerMetadataTable::registers[index].name, name)) ?
+                index : registerMetadata::NOT_FOUND;
+        }
+};
+
+#endif //REGISTER_METADATA_H
@@ -0,0 +1,847 @@
+/**
+ * @file registerMetadataTable.h
+ * @brief generated register metadata table, do not edit
+ *
+ * Generated by generateRegisterMetadata.py from pinmuxController.h,
+ * padGroupController.h, gpio.h and pinmuxController/README.md.
+ */
+
+#ifndef REGISTER_METADATA_TABLE_H
+#define REGISTER_METADATA_TABLE_H
+
+#include <cstdint>
+
+#include "registerMetadataTypes.h"
+
+struct registerMetadataTable
+{
+    static const uint32_t NUMBER_OF_REGISTERS = 533;
+    static const uint32_t NUMBER_OF_LAYOUTS = 17;
+    static const uint32_t NUMBER_OF_FIELDS = 169;
+    static const uint32_t NUMBER_OF_BUCKETS = 256;
+    static const uint32_t NUMBER_OF_SLOTS = 1024;
+    static const uint16_t EMPTY_SLOT = 0xFFFF;
+
+    static constexpr RegisterFieldInfo fields[NUMBER_OF_FIELDS] =
+    {
+        {"DRV_TYPE", 13, 2},
+        {"E_SCHMT", 12, 1},
+        {"E_HSM", 9, 1},
+        {"LOCK", 7, 1},
+        {"E_INPUT", 6, 1},
+        {"PARK", 5, 1},
+        {"TRISTATE", 4, 1},
+        {"PUPD", 2, 2},
+        {"PM", 0, 2},
+        {"E_SCHMT", 12, 1},
+        {"E_OD", 11, 1},
+        {"E_IO_HV", 10, 1},
+        {"E_LPDR", 8, 1},
+        {"LOCK", 7, 1},
+        {"E_INPUT", 6, 1},
+        {"PARK", 5, 1},
+        {"TRISTATE", 4, 1},
+        {"PUPD", 2, 2},
+        {"PM", 0, 2},
+        {"E_SCHMT", 12, 1},
+        {"E_OD", 11, 1},
+        {"E_LPDR", 8, 1},
+        {"LOCK", 7, 1},
+        {"E_INPUT", 6, 1},
+        {"PARK", 5, 1},
+        {"TRISTATE", 4, 1},
+        {"PUPD", 2, 2},
+        {"PM", 0, 2},
+        {"E_PREEMP", 15, 1},
+        {"DRV_TYPE", 13, 2},
+        {"E_SCHMT", 12, 1},
+        {"E_HSM", 9, 1},
+        {"LOCK", 7, 1},
+        {"E_INPUT", 6, 1},
+        {"PARK", 5, 1},
+        {"TRISTATE", 4, 1},
+        {"PUPD", 2, 2},
+        {"PM", 0, 2},
+        {"E_SCHMT", 12, 1},
+        {"E_HSM", 9, 1},
+        {"LOCK", 7, 1},
+        {"E_INPUT", 6, 1},
+        {"PARK", 5, 1},
+        {"TRISTATE", 4, 1},
+        {"PUPD", 2, 2},
+        {"PM", 0, 2},
+        {"E_SCHMT", 12, 1},
+        {"E_LPDR", 8, 1},
+        {"LOCK", 7, 1},
+        {"PUPD", 2, 2},
+        {"E_SCHMT", 12, 1},
+        {"E_LPDR", 8, 1},
+        {"LOCK", 7, 1},
+        {"E_INPUT", 6, 1},
+        {"PUPD", 2, 2},
+        {"DRVUP", 20, 5},
+        {"DRVDN", 12, 5},
+        {"SLWF", 30, 2},
+        {"SLWR", 28, 2},
+        {"DRVUP_CZ", 20, 7},
+        {"DRVDN_CZ", 12, 7},
+        {"SLWF", 30, 2},
+        {"SLWR", 28, 2},
+        {"DRVUP_CZ", 20, 7},
+        {"DRVDN_CZ", 12, 7},
+        {"SLWF", 30, 2},
+        {"SLWR", 28, 2},
+        {"DAT7_PARK", 26, 1},
+        {"DAT6_PARK", 25, 1},
+        {"DAT5_PARK", 24, 1},
+        {"DAT4_PARK", 23, 1},
+        {"DAT3_PARK", 22, 1},
+        {"DAT2_PARK", 21, 1},
+        {"DAT1_PARK", 20, 1},
+        {"DAT0_PARK", 19, 1},
+        {"CMD_PARK", 18, 1},
+        {"DQSB_PARK", 17, 1},
+        {"DQS_PARK", 16, 1},
+        {"CLKB_PARK", 15, 1},
+        {"CLK_PARK", 14, 1},
+        {"DRVUP", 8, 6},
+        {"DRVDN", 2, 6},
+        {"E_PREEMP", 1, 1},
+        {"E_SCHMT", 0, 1},
+        {"PAD_D7_DRV_TYPE", 20, 1},
+        {"PAD_D6_DRV_TYPE", 18, 1},
+        {"PAD_D5_DRV_TYPE", 16, 1},
+        {"PAD_D4_DRV_TYPE", 14, 1},
+        {"PAD_D3_DRV_TYPE", 12, 1},
+        {"PAD_D2_DRV_TYPE", 10, 1},
+        {"PAD_D1_DRV_TYPE", 8, 1},
+        {"PAD_D0_DRV_TYPE", 6, 1},
+        {"PAD_CLKB_DRV_TYPE", 4, 1},
+        {"PAD_CLK_DRV_TYPE", 2, 1},
+        {"PAD_CMD_DRV_TYPE", 0, 1},
+        {"PAD_DQSB_PUPD_PULLU", 25, 1},
+        {"PAD_DQSB_PUPD_PULLD", 24, 1},
+        {"PAD_DQS_PUPD_PULLU", 23, 1},
+        {"PAD_DQS_PUPD_PULLD", 22, 1},
+        {"PAD_D7_PUPD_PULLU", 21, 1},
+        {"PAD_D7_PUPD_PULLD", 20, 1},
+        {"PAD_D6_PUPD_PULLU", 19, 1},
+        {"PAD_D6_PUPD_PULLD", 18, 1},
+        {"PAD_D5_PUPD_PULLU", 17, 1},
+        {"PAD_D5_PUPD_PULLD", 16, 1},
+        {"PAD_D4_PUPD_PULLU", 15, 1},
+        {"PAD_D4_PUPD_PULLD", 14, 1},
+        {"PAD_D3_PUPD_PULLU", 13, 1},
+        {"PAD_D3_PUPD_PULLD", 12, 1},
+        {"PAD_D2_PUPD_PULLU", 11, 1},
+        {"PAD_D2_PUPD_PULLD", 10, 1},
+        {"PAD_D1_PUPD_PULLU", 9, 1},
+        {"PAD_D1_PUPD_PULLD", 8, 1},
+        {"PAD_D0_PUPD_PULLU", 7, 1},
+        {"PAD_D0_PUPD_PULLD", 6, 1},
+        {"PAD_CLKB_PUPD_PULLU", 5, 1},
+        {"PAD_CLKB_PUPD_PULLD", 4, 1},
+        {"PAD_CLK_PUPD_PULLU", 3, 1},
+        {"PAD_CLK_PUPD_PULLD", 2, 1},
+        {"PAD_CMD_PUPD_PULLU", 1, 1},
+        {"PAD_CMD_PUPD_PULLD", 0, 1},
+        {"LOCK_7", 15, 1},
+        {"LOCK_6", 14, 1},
+        {"LOCK_5", 13, 1},
+        {"LOCK_4", 12, 1},
+        {"LOCK_3", 11, 1},
+        {"LOCK_2", 10, 1},
+        {"LOCK_1", 9, 1},
+        {"LOCK_0", 8, 1},
+        {"BIT_7", 7, 1},
+        {"BIT_6", 6, 1},
+        {"BIT_5", 5, 1},
+        {"BIT_4", 4, 1},
+        {"BIT_3", 3, 1},
+        {"BIT_2", 2, 1},
+        {"BIT_1", 1, 1},
+        {"BIT_0", 0, 1},
+        {"BIT_7", 7, 1},
+        {"BIT_6", 6, 1},
+        {"BIT_5", 5, 1},
+        {"BIT_4", 4, 1},
+        {"BIT_3", 3, 1},
+        {"BIT_2", 2, 1},
+        {"BIT_1", 1, 1},
+        {"BIT_0", 0, 1},
+        {"DELTA_7", 23, 1},
+        {"DELTA_6", 22, 1},
+        {"DELTA_5", 21, 1},
+        {"DELTA_4", 20, 1},
+        {"DELTA_3", 19, 1},
+        {"DELTA_2", 18, 1},
+        {"DELTA_1", 17, 1},
+        {"DELTA_0", 16, 1},
+        {"EDGE_7", 15, 1},
+        {"EDGE_6", 14, 1},
+        {"EDGE_5", 13, 1},
+        {"EDGE_4", 12, 1},
+        {"EDGE_3", 11, 1},
+        {"EDGE_2", 10, 1},
+        {"EDGE_1", 9, 1},
+        {"EDGE_0", 8, 1},
+        {"BIT_7", 7, 1},
+        {"BIT_6", 6, 1},
+        {"BIT_5", 5, 1},
+        {"BIT_4", 4, 1},
+        {"BIT_3", 3, 1},
+        {"BIT_2", 2, 1},
+        {"BIT_1", 1, 1},
+        {"BIT_0", 0, 1},
+    };
+
+    static constexpr RegisterLayoutInfo layouts[NUMBER_OF_LAYOUTS] =
+    {
+        {0, 9},
+        {9, 10},
+        {19, 9},
+        {28, 10},
+        {38, 8},
+        {46, 4},
+        {50, 5},
+        {55, 2},
+        {57, 2},
+        {59, 2},
+        {61, 4},
+        {65, 19},
+        {84, 11},
+        {95, 26},
+        {121, 16},
+        {137, 8},
+        {145, 24},
+    };
+
+    static constexpr RegisterInfo registers[NUMBER_OF_REGISTERS] =
+    {
+        {"PINMUX_AUX_SDMMC1_CLK_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x000, 0x00002074, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_SDMMC1_CMD_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x004, 0x00002078, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_SDMMC1_DAT3_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x008, 0x00002078, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_SDMMC1_DAT2_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x00c, 0x00002078, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_SDMMC1_DAT1_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x010, 0x00002078, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_SDMMC1_DAT0_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x014, 0x00002078, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_SDMMC3_CLK_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x01c, 0x00002074, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_SDMMC3_CMD_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x020, 0x00002078, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_SDMMC3_DAT0_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x024, 0x00002078, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_SDMMC3_DAT1_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x028, 0x00002078, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_SDMMC3_DAT2_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x02c, 0x00002078, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_SDMMC3_DAT3_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x030, 0x00002078, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_PEX_L0_RST_N_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x038, 0x00000460, true, registerMetadata::ACCESS_READ_WRITE, 1},
+        {"PINMUX_AUX_PEX_L0_CLKREQ_N_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x03c, 0x00000470, true, registerMetadata::ACCESS_READ_WRITE, 1},
+        {"PINMUX_AUX_PEX_WAKE_N_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x040, 0x00000470, true, registerMetadata::ACCESS_READ_WRITE, 1},
+        {"PINMUX_AUX_PEX_L1_RST_N_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x044, 0x00000460, true, registerMetadata::ACCESS_READ_WRITE, 1},
+        {"PINMUX_AUX_PEX_L1_CLKREQ_N_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x048, 0x00000470, true, registerMetadata::ACCESS_READ_WRITE, 1},
+        {"PINMUX_AUX_SATA_LED_ACTIVE_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x04c, 0x00000060, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_SPI1_MOSI_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x050, 0x0000e074, true, registerMetadata::ACCESS_READ_WRITE, 3},
+        {"PINMUX_AUX_SPI1_MISO_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x054, 0x0000e074, true, registerMetadata::ACCESS_READ_WRITE, 3},
+        {"PINMUX_AUX_SPI1_SCK_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x058, 0x0000e074, true, registerMetadata::ACCESS_READ_WRITE, 3},
+        {"PINMUX_AUX_SPI1_CS0_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x05c, 0x0000e078, true, registerMetadata::ACCESS_READ_WRITE, 3},
+        {"PINMUX_AUX_SPI1_CS1_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x060, 0x0000e078, true, registerMetadata::ACCESS_READ_WRITE, 3},
+        {"PINMUX_AUX_SPI2_MOSI_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x064, 0x00006074, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_SPI2_MISO_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x068, 0x00006074, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_SPI2_SCK_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x06c, 0x00006074, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_SPI2_CSO_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x070, 0x00006078, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_SPI2_CS1_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x074, 0x00006078, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_SPI4_MOSI_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x078, 0x0000e074, true, registerMetadata::ACCESS_READ_WRITE, 3},
+        {"PINMUX_AUX_SPI4_MISO_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x07c, 0x0000e074, true, registerMetadata::ACCESS_READ_WRITE, 3},
+        {"PINMUX_AUX_SPI4_SCK_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x080, 0x0000e074, true, registerMetadata::ACCESS_READ_WRITE, 3},
+        {"PINMUX_AUX_SPI4_CS0_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x084, 0x0000e078, true, registerMetadata::ACCESS_READ_WRITE, 3},
+        {"PINMUX_AUX_QSPI_SCK_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x088, 0x00003078, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_QSPI_CS_N_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x08c, 0x00003078, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_QSPI_IO0_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x090, 0x00003078, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_QSPI_IO1_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x094, 0x00003078, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_QSPI_IO2_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x098, 0x00003078, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_QSPI_IO3_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x09c, 0x00003078, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_DMIC1_CLK_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x0a4, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 4},
+        {"PINMUX_AUX_DMIC1_DAT_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x0a8, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_DMIC2_CLK_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x0ac, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_DMIC2_DAT_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x0b0, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_DMIC3_CLK_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x0b4, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_DMIC3_DAT_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x0b8, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_GEN1_I2C_SCL_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x0bc, 0x00000570, true, registerMetadata::ACCESS_READ_WRITE, 1},
+        {"PINMUX_AUX_GEN1_I2C_SDA_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x0c0, 0x00000570, true, registerMetadata::ACCESS_READ_WRITE, 1},
+        {"PINMUX_AUX_GEN2_I2C_SCL_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x0c4, 0x00000572, true, registerMetadata::ACCESS_READ_WRITE, 1},
+        {"PINMUX_AUX_GEN2_I2C_SDA_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x0c8, 0x00000572, true, registerMetadata::ACCESS_READ_WRITE, 1},
+        {"PINMUX_AUX_GEN3_I2C_SCL_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x0cc, 0x00000570, true, registerMetadata::ACCESS_READ_WRITE, 1},
+        {"PINMUX_AUX_GEN3_I2C_SDA_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x0d0, 0x00000570, true, registerMetadata::ACCESS_READ_WRITE, 1},
+        {"PINMUX_AUX_CAM_I2C_SCL_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x0d4, 0x00000570, true, registerMetadata::ACCESS_READ_WRITE, 1},
+        {"PINMUX_AUX_CAM_I2C_SDA_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x0d8, 0x00000570, true, registerMetadata::ACCESS_READ_WRITE, 1},
+        {"PINMUX_AUX_PWR_I2C_SCL_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x0dc, 0x00000170, true, registerMetadata::ACCESS_READ_WRITE, 1},
+        {"PINMUX_AUX_PWR_I2C_SDA_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x0e0, 0x00000170, true, registerMetadata::ACCESS_READ_WRITE, 1},
+        {"PINMUX_AUX_UART1_TX_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x0e4, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_UART1_RX_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x0e8, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_UART1_RTS_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x0ec, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_UART1_CTS_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x0f0, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_UART2_TX_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x0f4, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_UART2_RX_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x0f8, 0x00000078, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_UART2_RTS_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x0fc, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_UART2_CTS_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x100, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_UART3_TX_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x104, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_UART3_RX_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x108, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_UART3_RTS_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x10c, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_UART3_CTS_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x110, 0x00000078, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_UART4_TX_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x114, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_UART4_RX_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x118, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_UART4_RTS_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x11c, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_UART4_CTS_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x120, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_DAP1_FS_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x124, 0x00006074, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_DAP1_DIN_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x128, 0x00006074, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_DAP1_DOUT_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x12c, 0x00006074, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_DAP1_SCLK_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x130, 0x00006074, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_DAP2_FS_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x134, 0x00006074, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_DAP2_DIN_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x138, 0x00006074, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_DAP2_DOUT_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x13c, 0x00006074, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_DAP2_SCLK_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x140, 0x00006074, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_DAP4_FS_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x144, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_DAP4_DIN_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x148, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_DAP4_DOUT_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x14c, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_DAP4_SCLK_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x150, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_CAM1_MCLK_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x154, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_CAM2_MCLK_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x158, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_JTAG_RTCK_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x15c, 0x00000068, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_CLK_32K_IN_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x160, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 5},
+        {"PINMUX_AUX_CLK_32K_OUT_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x164, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_BATT_BCL_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x168, 0x00000570, true, registerMetadata::ACCESS_READ_WRITE, 1},
+        {"PINMUX_AUX_CLK_REQ_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x16c, 0x00000040, true, registerMetadata::ACCESS_READ_WRITE, 6},
+        {"PINMUX_AUX_CPU_PWR_REQ_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x170, 0x00000040, true, registerMetadata::ACCESS_READ_WRITE, 6},
+        {"PINMUX_AUX_PWR_INT_N_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x174, 0x00000040, true, registerMetadata::ACCESS_READ_WRITE, 6},
+        {"PINMUX_AUX_SHUTDOWN_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x178, 0x00000040, true, registerMetadata::ACCESS_READ_WRITE, 6},
+        {"PINMUX_AUX_CORE_PWR_REQ_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x17c, 0x00000040, true, registerMetadata::ACCESS_READ_WRITE, 6},
+        {"PINMUX_AUX_AUD_MCLK_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x180, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_DVFS_PWM_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x184, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_DVFS_CLK_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x188, 0x00000078, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_GPIO_X1_AUD_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x18c, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_GPIO_X3_AUD_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x190, 0x00000078, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_GPIO_PCC7_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x194, 0x00000570, true, registerMetadata::ACCESS_READ_WRITE, 1},
+        {"PINMUX_AUX_HDMI_CEC_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x198, 0x00000570, true, registerMetadata::ACCESS_READ_WRITE, 1},
+        {"PINMUX_AUX_HDMI_INT_DP_HPD_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x19c, 0x00000574, true, registerMetadata::ACCESS_READ_WRITE, 1},
+        {"PINMUX_AUX_SPDIF_OUT_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x1a0, 0x00000078, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_SPDIF_IN_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x1a4, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_USB_VBUS_EN0_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x1a8, 0x00000560, true, registerMetadata::ACCESS_READ_WRITE, 1},
+        {"PINMUX_AUX_USB_VBUS_EN1_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x1ac, 0x00000560, true, registerMetadata::ACCESS_READ_WRITE, 1},
+        {"PINMUX_AUX_DP_HPD0_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x1b0, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_WIFI_EN_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x1b4, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_WIFI_RST_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x1b8, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_WIFI_WAKE_AP_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x1bc, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_AP_WAKE_BT_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x1c0, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_BT_RST_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x1c4, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_BT_WAKE_AP_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x1c8, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_AP_WAKE_NFC_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x1cc, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_NFC_EN_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x1d0, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_NFC_INT_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x1d4, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_GPS_EN_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x1d8, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_GPS_RST_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x1dc, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_CAM_RST_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x1e0, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_CAM_AF_EN_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x1e4, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_CAM_FLASH_EN_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x1e8, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_CAM1_PWDN_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x1ec, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_CAM2_PWDN_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x1f0, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_CAM1_STROBE_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x1f4, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_LCD_TE_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x1f8, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_LCD_BL_PWM_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x1fc, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_LCD_BL_EN_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x200, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_LCD_RST_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x204, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_LCD_GPIO1_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x208, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_LCD_GPIO2_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x20c, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_AP_READY_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x210, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_TOUCH_RST_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x214, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_TOUCH_CLK_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x218, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_MODEM_WAKE_AP_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x21c, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_TOUCH_INT_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x220, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_MOTION_INT_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x224, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_ALS_PROX_INT_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x228, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_TEMP_ALERT_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x22c, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_BUTTON_POWER_ON_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x230, 0x00000078, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_BUTTON_VOL_UP_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x234, 0x00000078, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_BUTTON_VOL_DOWN_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x238, 0x00000078, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_BUTTON_SLIDE_SW_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x23c, 0x00000078, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_BUTTON_HOME_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x240, 0x00000078, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_GPIO_PA6_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x244, 0x00000030, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_GPIO_PE6_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x248, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_GPIO_PE7_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x24c, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_GPIO_PH6_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x250, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_GPIO_PK0_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x254, 0x00006074, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_GPIO_PK1_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x258, 0x00006074, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_GPIO_PK2_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x25c, 0x00006074, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_GPIO_PK3_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x260, 0x00006074, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_GPIO_PK4_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x264, 0x00006074, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_GPIO_PK5_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x268, 0x00006074, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_GPIO_PK6_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x26c, 0x00006074, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_GPIO_PK7_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x270, 0x00006074, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_GPIO_PL0_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x274, 0x00006074, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_GPIO_PL1_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x278, 0x00006074, true, registerMetadata::ACCESS_READ_WRITE, 0},
+        {"PINMUX_AUX_GPIO_PZ0_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x27c, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_GPIO_PZ1_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x280, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_GPIO_PZ2_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x284, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_GPIO_PZ3_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x288, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_GPIO_PZ4_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x28c, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"PINMUX_AUX_GPIO_PZ5_0", registerMetadata::BLOCK_PINMUX, 0x70003000, 0x290, 0x00000074, true, registerMetadata::ACCESS_READ_WRITE, 2},
+        {"ALS_PROX_INT_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x8e4, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"AP_READY_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x8e8, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"AP_WAKE_BT_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x8ec, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"AP_WAKE_NFC_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x8f0, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"AUD_MCLK_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x8f4, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"BATT_BCL_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x8f8, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"BT_RST_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x8fc, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"BT_WAKE_AP_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x900, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"BUTTON_HOME_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x904, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"BUTTON_POWER_ON_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x908, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"BUTTON_SLIDE_SW_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x90c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"BUTTON_VOL_DOWN_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x910, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"BUTTON_VOL_UP_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x914, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"CAM1_MCLK_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x918, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"CAM1_PWDN_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x91c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"CAM1_STROBE_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x920, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"CAM2_MCLK_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x924, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"CAM2_PWDN_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x928, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"CAM_AF_EN_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x92c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"CAM_FLASH_EN_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x930, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"CAM_I2C_SCL_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x934, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"CAM_I2C_SDA_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x938, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"CAM_RST_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x93c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"CLK_32K_IN_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x940, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"CLK_32K_OUT_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x944, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"CLK_REQ_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x948, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"CORE_PWR_REQ_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x94c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"CPU_PWR_REQ_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x950, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"DAP1_DIN_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x954, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"DAP1_DOUT_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x958, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"DAP1_FS_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x95c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"DAP1_SCLK_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x960, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"DAP2_DIN_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x964, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"DAP2_DOUT_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x968, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"DAP2_FS_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x96c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"DAP2_SCLK_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x970, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"DAP4_DIN_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x974, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"DAP4_DOUT_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x978, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"DAP4_FS_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x97c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"DAP4_SCLK_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x980, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"DMIC1_CLK_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x984, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"DMIC1_DAT_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x988, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"DMIC2_CLK_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x98c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"DMIC2_DAT_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x990, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"DMIC3_CLK_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x994, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"DMIC3_DAT_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x998, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"DP_HPD_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x99c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"DVFS_CLK_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x9a0, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"DVFS_PWM_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x9a4, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"GEN1_I2C_SCL_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x9a8, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"GEN1_I2C_SDA_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x9ac, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"GEN2_I2C_SCL_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x9b0, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"GEN2_I2C_SDA_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x9b4, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"GEN3_I2C_SCL_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x9b8, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"GEN3_I2C_SDA_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x9bc, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"GPIO_PA6_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x9c0, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"GPIO_PCC7_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x9c4, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"GPIO_PE6_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x9c8, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"GPIO_PE7_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x9cc, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"GPIO_PH6_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x9d0, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"GPIO_PK0_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x9d4, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"GPIO_PK1_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x9d8, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"GPIO_PK2_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x9dc, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"GPIO_PK3_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x9e0, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"GPIO_PK4_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x9e4, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"GPIO_PK5_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x9e8, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"GPIO_PK6_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x9ec, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"GPIO_PK7_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x9f0, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"GPIO_PL0_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x9f4, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"GPIO_PL1_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x9f8, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"GPIO_PZ0_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0x9fc, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 9},
+        {"GPIO_PZ1_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa00, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 9},
+        {"GPIO_PZ2_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa04, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 9},
+        {"GPIO_PZ3_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa08, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 9},
+        {"GPIO_PZ4_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa0c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 9},
+        {"GPIO_PZ5_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa10, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 9},
+        {"GPIO_X1_AUD_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa14, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"GPIO_X3_AUD_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa18, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"GPS_EN_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa1c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"GPS_RST_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa20, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"HDMI_CEC_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa24, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"HDMI_INT_DP_HPD_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa28, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"JTAG_RTCK_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa2c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"LCD_BL_EN_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa30, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"LCD_BL_PWM_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa34, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"LCD_GPIO1_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa38, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"LCD_GPIO2_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa3c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"LCD_RST_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa40, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"LCD_TE_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa44, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"MODEM_WAKE_AP_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa48, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"MOTION_INT_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa4c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"NFC_EN_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa50, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"NFC_INT_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa54, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"PEX_L0_CLKREQ_N_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa58, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"PEX_L0_RST_N_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa5c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"PEX_L1_CLKREQ_N_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa60, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"PEX_L1_RST_N_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa64, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"PEX_WAKE_N_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa68, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"PWR_I2C_SCL_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa6c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"PWR_I2C_SDA_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa70, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"PWR_INT_N_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa74, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"QSPI_COMP_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa78, 0x00808000, true, registerMetadata::ACCESS_READ_WRITE, 9},
+        {"QSPI_SCK_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa90, 0x50000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"SATA_LED_ACTIVE_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa94, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"SDMMC1_PAD_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa98, 0x00808000, true, registerMetadata::ACCESS_READ_WRITE, 10},
+        {"EMMC2_PAD_E_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xa9c, 0x07ffc310, true, registerMetadata::ACCESS_READ_WRITE, 11},
+        {"EMMC2_PAD_DRV_TYPE_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xaa0, 0x00155555, true, registerMetadata::ACCESS_READ_WRITE, 12},
+        {"EMMC2_PAD_PUPD_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xaa4, 0x026aaaa6, true, registerMetadata::ACCESS_READ_WRITE, 13},
+        {"SDMMC3_PAD_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xab0, 0x00808000, true, registerMetadata::ACCESS_READ_WRITE, 10},
+        {"EMMC4_PAD_E_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xab4, 0x07ffc310, true, registerMetadata::ACCESS_READ_WRITE, 11},
+        {"EMMC4_PAD_DRV_TYPE_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xab8, 0x00155555, true, registerMetadata::ACCESS_READ_WRITE, 12},
+        {"EMMC4_PAD_PUPD_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xabc, 0x026aaaa6, true, registerMetadata::ACCESS_READ_WRITE, 13},
+        {"SHUTDOWN_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xac8, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"SPDIF_IN_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xacc, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"SPDIF_OUT_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xad0, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"SPI1_CS0_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xad4, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"SPI1_CS1_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xad8, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"SPI1_MISO_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xadc, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"SPI1_MOSI_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xae0, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"SPI1_SCK_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xae4, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"SPI2_CS0_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xae8, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"SPI2_CS1_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xaec, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"SPI2_MISO_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xaf0, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"SPI2_MOSI_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xaf4, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"SPI2_SCK_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xaf8, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"SPI4_CS0_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xafc, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"SPI4_MISO_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb00, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"SPI4_MOSI_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb04, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"SPI4_SCK_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb08, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 8},
+        {"TEMP_ALERT_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb0c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"TOUCH_CLK_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb10, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"TOUCH_INT_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb14, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"TOUCH_RST_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb18, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"UART1_CTS_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb1c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"UART1_RTS_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb20, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"UART1_RX_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb24, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"UART1_TX_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb28, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"UART2_CTS_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb2c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"UART2_RTS_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb30, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"UART2_RX_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb34, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"UART2_TX_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb38, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"UART3_CTS_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb3c, 0x00000000, false, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"UART3_RTS_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb40, 0x00000000, false, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"UART3_RX_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb44, 0x00000000, false, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"UART3_TX_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb48, 0x00000000, false, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"UART4_CTS_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb4c, 0x00000000, false, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"UART4_RTS_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb50, 0x00000000, false, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"UART4_RX_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb54, 0x00000000, false, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"UART4_TX_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb58, 0x00000000, false, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"USB_VBUS_EN0_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb5c, 0x00000000, false, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"USB_VBUS_EN1_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb60, 0x00000000, false, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"WIFI_EN_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb64, 0x00000000, false, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"WIFI_RST_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb68, 0x00000000, false, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"WIFI_WAKE_AP_CFG", registerMetadata::BLOCK_PAD_GROUP, 0x70000000, 0xb6c, 0x00000000, false, registerMetadata::ACCESS_READ_WRITE, 7},
+        {"GPIO_CNF_A", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x000, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_B", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x004, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_C", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x008, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_D", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x00c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_E", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x100, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_F", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x104, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_G", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x108, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_H", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x10c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_I", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x200, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_J", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x204, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_K", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x208, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_L", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x20c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_M", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x300, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_N", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x304, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_O", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x308, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_P", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x30c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_Q", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x400, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_R", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x404, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_S", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x408, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_T", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x40c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_U", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x500, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_V", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x504, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_W", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x508, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_X", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x50c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_Y", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x600, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_Z", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x604, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_AA", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x608, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_BB", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x60c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_CC", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x700, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_DD", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x704, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_CNF_EE", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x708, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 14},
+        {"GPIO_OE_A", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x010, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_B", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x014, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_C", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x018, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_D", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x01c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_E", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x110, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_F", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x114, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_G", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x118, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_H", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x11c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_I", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x210, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_J", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x214, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_K", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x218, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_L", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x21c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_M", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x310, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_N", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x314, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_O", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x318, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_P", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x31c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_Q", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x410, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_R", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x414, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_S", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x418, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_T", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x41c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_U", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x510, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_V", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x514, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_W", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x518, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_X", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x51c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_Y", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x610, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_Z", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x614, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_AA", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x618, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_BB", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x61c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_CC", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x710, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_DD", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x714, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OE_EE", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x718, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_A", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x020, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_B", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x024, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_C", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x028, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_D", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x02c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_E", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x120, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_F", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x124, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_G", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x128, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_H", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x12c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_I", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x220, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_J", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x224, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_K", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x228, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_L", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x22c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_M", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x320, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_N", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x324, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_O", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x328, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_P", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x32c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_Q", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x420, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_R", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x424, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_S", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x428, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_T", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x42c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_U", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x520, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_V", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x524, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_W", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x528, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_X", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x52c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_Y", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x620, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_Z", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x624, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_AA", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x628, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_BB", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x62c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_CC", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x720, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_DD", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x724, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_OUT_EE", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x728, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_IN_A", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x030, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_B", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x034, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_C", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x038, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_D", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x03c, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_E", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x130, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_F", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x134, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_G", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x138, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_H", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x13c, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_I", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x230, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_J", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x234, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_K", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x238, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_L", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x23c, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_M", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x330, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_N", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x334, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_O", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x338, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_P", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x33c, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_Q", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x430, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_R", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x434, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_S", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x438, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_T", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x43c, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_U", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x530, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_V", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x534, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_W", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x538, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_X", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x53c, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_Y", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x630, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_Z", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x634, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_AA", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x638, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_BB", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x63c, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_CC", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x730, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_DD", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x734, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_IN_EE", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x738, 0x00000000, false, registerMetadata::ACCESS_READ_ONLY, 15},
+        {"GPIO_INT_STA_A", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x040, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_B", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x044, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_C", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x048, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_D", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x04c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_E", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x140, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_F", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x144, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_G", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x148, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_H", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x14c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_I", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x240, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_J", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x244, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_K", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x248, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_L", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x24c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_M", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x340, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_N", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x344, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_O", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x348, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_P", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x34c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_Q", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x440, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_R", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x444, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_S", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x448, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_T", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x44c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_U", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x540, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_V", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x544, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_W", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x548, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_X", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x54c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_Y", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x640, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_Z", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x644, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_AA", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x648, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_BB", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x64c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_CC", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x740, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_DD", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x744, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_STA_EE", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x748, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_A", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x050, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_B", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x054, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_C", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x058, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_D", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x05c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_E", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x150, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_F", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x154, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_G", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x158, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_H", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x15c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_I", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x250, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_J", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x254, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_K", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x258, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_L", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x25c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_M", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x350, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_N", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x354, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_O", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x358, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_P", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x35c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_Q", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x450, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_R", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x454, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_S", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x458, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_T", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x45c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_U", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x550, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_V", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x554, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_W", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x558, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_X", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x55c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_Y", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x650, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_Z", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x654, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_AA", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x658, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_BB", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x65c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_CC", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x750, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_DD", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x754, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_ENB_EE", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x758, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 15},
+        {"GPIO_INT_LVL_A", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x060, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_B", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x064, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_C", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x068, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_D", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x06c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_E", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x160, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_F", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x164, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_G", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x168, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_H", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x16c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_I", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x260, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_J", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x264, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_K", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x268, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_L", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x26c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_M", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x360, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_N", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x364, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_O", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x368, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_P", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x36c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_Q", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x460, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_R", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x464, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_S", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x468, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_T", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x46c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_U", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x560, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_V", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x564, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_W", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x568, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_X", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x56c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_Y", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x660, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_Z", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x664, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_AA", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x668, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_BB", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x66c, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_CC", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x760, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_DD", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x764, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+        {"GPIO_INT_LVL_EE", registerMetadata::BLOCK_GPIO, 0x6000d000, 0x768, 0x00000000, true, registerMetadata::ACCESS_READ_WRITE, 16},
+    };
+
+    // Seed of the second hash for each bucket of the first
+    static constexpr uint16_t displacements[NUMBER_OF_BUCKETS] =
+    {
+        1, 1, 0, 4, 1, 0, 2, 1, 1, 1, 1, 1, 2, 1, 2, 1,
+        1, 3, 2, 1, 1, 3, 1, 1, 1, 2, 0, 1, 3, 4, 1, 1,
+        2, 1, 3, 0, 1, 1, 2, 1, 0, 0, 1, 2, 6, 0, 3, 1,
+        0, 2, 1, 1, 1, 1, 2, 1, 2, 0, 1, 0, 2, 0, 1, 2,
+        2, 0, 2, 1, 1, 1, 3, 2, 0, 0, 3, 7, 1, 1, 1, 2,
+        5, 1, 4, 0, 1, 1, 1, 1, 4, 1, 3, 2, 1, 1, 1, 3,
+        1, 0, 1, 1, 2, 3, 4, 0, 1, 0, 3, 1, 1, 6, 2, 1,
+        4, 2, 3, 2, 2, 1, 2, 2, 1, 1, 2, 4, 8, 1, 1, 5,
+        1, 2, 6, 0, 3, 2, 2, 3, 0, 2, 0, 8, 2, 1, 4, 1,
+        1, 2, 2, 1, 1, 1, 1, 0, 5, 1, 2, 3, 1, 3, 2, 1,
+        6, 4, 0, 0, 0, 4, 4, 1, 2, 1, 2, 3, 2, 2, 5, 0,
+        1, 4, 2, 2, 1, 4, 1, 0, 5, 2, 0, 1, 0, 6, 1, 1,
+        3, 2, 1, 1, 2, 1, 1, 1, 1, 2, 3, 2, 2, 5, 0, 1,
+        2, 2, 3, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 0, 7,
+        0, 1, 2, 2, 1, 5, 2, 1, 3, 1, 0, 1, 0, 0, 6, 1,
+        1, 3, 1, 5, 6, 6, 5, 1, 2, 3, 2, 2, 2, 0, 0, 2,
+    };
+
+    // Index into registers, EMPTY_SLOT when no name hashes here
+    static constexpr uint16_t slots[NUMBER_OF_SLOTS] =
+    {
+        0xFFFF, 0xFFFF, 0x0090, 0x0176, 0x00D3, 0xFFFF, 0x01EC, 0xFFFF, 0x0182, 0x0192, 0x00E3, 0xFFFF, 0x01DE, 0x0033, 0x00FD, 0xFFFF,
+        0xFFFF, 0xFFFF, 0x00DE, 0xFFFF, 0x0117, 0xFFFF, 0xFFFF, 0x0019, 0x01D4, 0xFFFF, 0x00F1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0x0052, 0xFFFF, 0xFFFF, 0x0053, 0xFFFF, 0x00CD, 0xFFFF, 0xFFFF, 0xFFFF, 0x00AE, 0x014D, 0x01A9, 0xFFFF, 0xFFFF, 0x01AC, 0xFFFF,
+        0xFFFF, 0x0113, 0xFFFF, 0x0172, 0xFFFF, 0x00C8, 0xFFFF, 0xFFFF, 0x0134, 0xFFFF, 0xFFFF, 0xFFFF, 0x0138, 0xFFFF, 0x0186, 0x00AA,
+        0x00F2, 0x00B2, 0xFFFF, 0xFFFF, 0x00ED, 0xFFFF, 0xFFFF, 0x001B, 0xFFFF, 0xFFFF, 0x007E, 0xFFFF, 0x002C, 0x01C8, 0xFFFF, 0x0097,
+        0x00BB, 0x013C, 0xFFFF, 0x01E4, 0xFFFF, 0xFFFF, 0x0025, 0x0209, 0xFFFF, 0xFFFF, 0x0064, 0x00D1, 0x019E, 0xFFFF, 0x0021, 0xFFFF,
+        0x004E, 0x01C9, 0xFFFF, 0xFFFF, 0x0198, 0x00EB, 0xFFFF, 0xFFFF, 0x0124, 0x014B, 0xFFFF, 0xFFFF, 0x016C, 0x00B7, 0x01B4, 0xFFFF,
+        0xFFFF, 0x0008, 0xFFFF, 0xFFFF, 0x017C, 0xFFFF, 0x0115, 0xFFFF, 0x00DC, 0xFFFF, 0x0077, 0x011E, 0xFFFF, 0x000C, 0x0091, 0x0015,
+        0xFFFF, 0x00D2, 0x0003, 0xFFFF, 0x0048, 0x00FC, 0xFFFF, 0x0159, 0xFFFF, 0x003B, 0x005F, 0x00A7, 0x0166, 0xFFFF, 0x01B0, 0xFFFF,
+        0xFFFF, 0x01EE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x002F, 0xFFFF, 0x012F, 0xFFFF, 0x00C3, 0x00F4, 0xFFFF,
+        0x00B1, 0xFFFF, 0x0103, 0xFFFF, 0x0144, 0x01D9, 0x01A5, 0xFFFF, 0x004B, 0xFFFF, 0x0195, 0x0076, 0xFFFF, 0x01DF, 0xFFFF, 0x00D8,
+        0xFFFF, 0xFFFF, 0xFFFF, 0x00BC, 0xFFFF, 0xFFFF, 0xFFFF, 0x0163, 0x01F7, 0x009D, 0x0206, 0x00AC, 0xFFFF, 0x011D, 0x0147, 0x0096,
+        0xFFFF, 0x01E8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x011A, 0x010B, 0x0105, 0xFFFF, 0xFFFF, 0x0069,
+        0x010C, 0x00BF, 0x01C0, 0x0001, 0xFFFF, 0xFFFF, 0x01FC, 0xFFFF, 0x0031, 0xFFFF, 0xFFFF, 0x0194, 0xFFFF, 0x00EE, 0xFFFF, 0xFFFF,
+        0x00B0, 0x00D9, 0x01CE, 0xFFFF, 0x01B3, 0x018C, 0xFFFF, 0xFFFF, 0x00FA, 0x01B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01F8, 0x01F9,
+        0x0154, 0xFFFF, 0x01B2, 0xFFFF, 0xFFFF, 0xFFFF, 0x017D, 0x01CB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0164, 0xFFFF, 0x0073, 0x01CA,
+        0x010D, 0x014F, 0x0017, 0x0188, 0x0149, 0x00A5, 0x01B9, 0xFFFF, 0xFFFF, 0x01F6, 0x0004, 0xFFFF, 0x01DA, 0x0075, 0xFFFF, 0x0059,
+        0x0155, 0xFFFF, 0xFFFF, 0x01D1, 0x01BF, 0xFFFF, 0x00A0, 0x0038, 0xFFFF, 0x0092, 0x0189, 0x0136, 0x0040, 0x00DF, 0x0114, 0xFFFF,
+        0x01C7, 0x019D, 0xFFFF, 0x0101, 0x0026, 0x00E1, 0x0061, 0xFFFF, 0xFFFF, 0xFFFF, 0x0185, 0x01B7, 0x01EA, 0xFFFF, 0xFFFF, 0x00AD,
+        0x006C, 0x0121, 0xFFFF, 0xFFFF, 0xFFFF, 0x0047, 0x01EB, 0x0029, 0x0191, 0x00E2, 0xFFFF, 0xFFFF, 0x00E0, 0x01F4, 0xFFFF, 0x01D6,
+        0xFFFF, 0x00E7, 0xFFFF, 0xFFFF, 0xFFFF, 0x004C, 0x019F, 0xFFFF, 0xFFFF, 0x017E, 0xFFFF, 0x00E8, 0xFFFF, 0x008B, 0x0203, 0xFFFF,
+        0x0066, 0xFFFF, 0xFFFF, 0xFFFF, 0x0045, 0x00CC, 0xFFFF, 0x006F, 0x0141, 0xFFFF, 0x01D2, 0x00F3, 0xFFFF, 0xFFFF, 0xFFFF, 0x018F,
+        0xFFFF, 0xFFFF, 0xFFFF, 0x0143, 0x000A, 0x019C, 0xFFFF, 0xFFFF, 0x00FB, 0xFFFF, 0xFFFF, 0x008C, 0x01A0, 0xFFFF, 0xFFFF, 0xFFFF,
+        0x0062, 0xFFFF, 0xFFFF, 0x0024, 0x0060, 0x0140, 0x002D, 0x0102, 0x00C2, 0xFFFF, 0xFFFF, 0x005C, 0x0107, 0xFFFF, 0x0094, 0x0080,
+        0x0146, 0xFFFF, 0x013A, 0x0041, 0xFFFF, 0xFFFF, 0xFFFF, 0x00E5, 0xFFFF, 0x005B, 0xFFFF, 0x008A, 0x001A, 0x003D, 0xFFFF, 0xFFFF,
+        0x01B5, 0x01B1, 0x018E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0087, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0012, 0xFFFF, 0x00F7, 0x0118, 0x013E, 0xFFFF, 0xFFFF, 0x0171, 0x0079, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xFFFF, 0x01C6, 0x009F, 0x00EF, 0x0116, 0xFFFF, 0x01D3, 0xFFFF, 0x0179, 0x0180, 0x020F, 0xFFFF, 0x0167, 0xFFFF, 0x0131, 0x014C,
+        0xFFFF, 0xFFFF, 0x01E7, 0x01E1, 0x01DB, 0xFFFF, 0x00DA, 0x01CD, 0x01DC, 0x0093, 0xFFFF, 0x0133, 0x00A1, 0x009E, 0xFFFF, 0x0039,
+        0x018A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01AF, 0xFFFF, 0xFFFF, 0x0013, 0x0057, 0x0106, 0x014A, 0x0022, 0xFFFF, 0xFFFF, 0x004D,
+        0x016D, 0xFFFF, 0x00D4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x009B, 0x00B5, 0xFFFF, 0x012E, 0x0034, 0xFFFF, 0xFFFF, 0x00BE, 0xFFFF,
+        0xFFFF, 0xFFFF, 0xFFFF, 0x013D, 0x00BD, 0x015D, 0x015A, 0x00D5, 0x001C, 0xFFFF, 0x01C2, 0x002A, 0xFFFF, 0xFFFF, 0x0037, 0xFFFF,
+        0x001E, 0xFFFF, 0x01C4, 0xFFFF, 0x00B6, 0xFFFF, 0xFFFF, 0xFFFF, 0x01BB, 0x0162, 0x01E3, 0x0070, 0x0081, 0x012A, 0x0193, 0xFFFF,
+        0x0132, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0184, 0xFFFF, 0x01AB, 0x0006, 0x01AD, 0x0177, 0x0158, 0xFFFF, 0x0200, 0xFFFF, 0xFFFF,
+        0x01FD, 0xFFFF, 0xFFFF, 0x0051, 0x016E, 0x0157, 0x0046, 0xFFFF, 0x000E, 0x015E, 0xFFFF, 0x00C6, 0x003E, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xFFFF, 0xFFFF, 0xFFFF, 0x00C0, 0xFFFF, 0x01BC, 0x01F3, 0x0139, 0xFFFF, 0xFFFF, 0xFFFF, 0x0002, 0x0127, 0x01F2, 0x0201, 0x00D7,
+        0x011B, 0xFFFF, 0x0173, 0xFFFF, 0x00CE, 0xFFFF, 0xFFFF, 0x0128, 0xFFFF, 0x00C5, 0x00AF, 0x0072, 0x0123, 0x00EC, 0x013B, 0x00A9,
+        0x020E, 0xFFFF, 0xFFFF, 0x0030, 0x006A, 0xFFFF, 0xFFFF, 0x000D, 0xFFFF, 0xFFFF, 0x0065, 0x0086, 0x011F, 0x010E, 0x00CB, 0xFFFF,
+        0xFFFF, 0x01CF, 0xFFFF, 0x01FF, 0xFFFF, 0xFFFF, 0x007C, 0x0178, 0x01ED, 0x0168, 0x01F1, 0xFFFF, 0x008F, 0x0104, 0x01CC, 0xFFFF,
+        0x001D, 0x0129, 0x000F, 0xFFFF, 0x0169, 0x0044, 0x0197, 0xFFFF, 0xFFFF, 0x008E, 0xFFFF, 0x006E, 0xFFFF, 0x0032, 0xFFFF, 0x0078,
+        0x017B, 0x0199, 0x005D, 0x01FB, 0x01FE, 0xFFFF, 0xFFFF, 0x00A3, 0x010A, 0xFFFF, 0x0050, 0x01A3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xFFFF, 0xFFFF, 0x01D7, 0x0196, 0xFFFF, 0x01BE, 0x00E4, 0x0054, 0xFFFF, 0xFFFF, 0x00B4, 0x01E2, 0xFFFF, 0x00AB, 0x01C5, 0x0058,
+        0xFFFF, 0x00FE, 0x0151, 0x00B3, 0xFFFF, 0xFFFF, 0xFFFF, 0x012B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0112, 0xFFFF, 0xFFFF, 0x0095,
+        0x0119, 0xFFFF, 0xFFFF, 0xFFFF, 0x00BA, 0xFFFF, 0xFFFF, 0x015B, 0xFFFF, 0x01B8, 0x0005, 0x0148, 0xFFFF, 0xFFFF, 0x0181, 0x0082,
+        0xFFFF, 0x0043, 0x01A7, 0x00C9, 0x0211, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x012C, 0x0074, 0xFFFF, 0xFFFF, 0x0098, 0xFFFF,
+        0xFFFF, 0x0120, 0xFFFF, 0x020D, 0x00F5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00C1, 0x00C4, 0x014E, 0x0085, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00A4, 0x01A4, 0x00D0, 0xFFFF, 0xFFFF, 0x003F, 0xFFFF, 0x01BD, 0x00B8, 0x0130, 0xFFFF,
+        0x0142, 0xFFFF, 0xFFFF, 0x020A, 0x011C, 0xFFFF, 0x0214, 0x0067, 0x01A1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0x00E9, 0xFFFF, 0x01A8, 0x00F6, 0x0009, 0xFFFF, 0x0007, 0x00B9, 0x0016, 0x0161, 0x010F, 0xFFFF, 0x01AA, 0x0036, 0xFFFF, 0xFFFF,
+        0xFFFF, 0xFFFF, 0xFFFF, 0x01C3, 0xFFFF, 0x005E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0068, 0x0160, 0xFFFF, 0x0170, 0x0152, 0xFFFF,
+        0xFFFF, 0x019B, 0x016B, 0x019A, 0xFFFF, 0x0153, 0xFFFF, 0x009A, 0xFFFF, 0x006D, 0xFFFF, 0x007B, 0xFFFF, 0xFFFF, 0x01F0, 0xFFFF,
+        0xFFFF, 0x0089, 0x0042, 0x00A2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0150, 0x00CA, 0x0084, 0x01AE, 0x003C, 0x00DB, 0x01C1, 0xFFFF,
+        0xFFFF, 0xFFFF, 0xFFFF, 0x002E, 0xFFFF, 0xFFFF, 0xFFFF, 0x0071, 0x0100, 0x001F, 0xFFFF, 0x00A6, 0x017A, 0xFFFF, 0xFFFF, 0x007D,
+        0x0165, 0x0190, 0x01A2, 0x01F5, 0xFFFF, 0x0145, 0x0212, 0xFFFF, 0x0055, 0x0108, 0xFFFF, 0xFFFF, 0x020B, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xFFFF, 0x0135, 0xFFFF, 0x00FF, 0x0000, 0xFFFF, 0xFFFF, 0x002B, 0xFFFF, 0x01EF, 0x013F, 0x0014, 0xFFFF, 0x0088, 0x0027, 0x0109,
+        0xFFFF, 0x0208, 0xFFFF, 0x01E0, 0x018B, 0x01E5, 0xFFFF, 0xFFFF, 0xFFFF, 0x01DD, 0x0122, 0x0137, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+        0xFFFF, 0xFFFF, 0xFFFF, 0x01D0, 0x020C, 0x012D, 0xFFFF, 0x0011, 0xFFFF, 0x0174, 0xFFFF, 0xFFFF, 0xFFFF, 0x0204, 0x00F0, 0xFFFF,
+        0x0207, 0x00EA, 0xFFFF, 0x00F9, 0x0018, 0xFFFF, 0xFFFF, 0x008D, 0x0056, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x01E9, 0x01BA, 0x0049,
+        0x0202, 0xFFFF, 0xFFFF, 0xFFFF, 0x0156, 0x00DD, 0x00A8, 0x0210, 0xFFFF, 0xFFFF, 0x015F, 0x0020, 0x016F, 0x0110, 0xFFFF, 0x000B,
+        0x0183, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0111, 0xFFFF, 0x0187, 0x01D5, 0x005A, 0x00F8, 0x0213, 0xFFFF, 0xFFFF, 0x0125, 0xFFFF,
+        0x0035, 0x016A, 0x018D, 0xFFFF, 0x0205, 0xFFFF, 0xFFFF, 0x00E6, 0xFFFF, 0x0126, 0xFFFF, 0xFFFF, 0x00D6, 0xFFFF, 0x00C7, 0xFFFF,
+        0x01A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x007A, 0x0175, 0xFFFF,
+        0xFFFF, 0x01D8, 0x0099, 0x0028, 0x015C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x017F, 0x003A, 0xFFFF, 0xFFFF, 0xFFFF, 0x004A, 0x0010,
+        0x01E6, 0x004F, 0xFFFF, 0x006B, 0x0063, 0x007F, 0xFFFF, 0x0083, 0xFFFF, 0xFFFF, 0xFFFF, 0x00CF, 0x009C, 0xFFFF, 0x01FA, 0x0023,
+    };
+};
+
+#endif //REGISTER_METADATA_TABLE_H
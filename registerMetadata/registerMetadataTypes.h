@@ -0,0 +1,101 @@
+/**
+ * @file registerMetadataTypes.h
+ * @brief register metadata types
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano register metadata
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @section Description
+ *
+ * Entry types of the generated table in registerMetadataTable.h and the
+ * name hash it is indexed by. Everything here is a literal type so the whole
+ * table is constexpr, lives in read only data and needs no start up code.
+ */
+
+#ifndef REGISTER_METADATA_TYPES_H
+#define REGISTER_METADATA_TYPES_H
+
+#include <cstdint>
+
+struct registerMetadata
+{
+    static const uint32_t BLOCK_PINMUX = 0; // pinmuxController::baseAddress
+    static const uint32_t BLOCK_PAD_GROUP = 1; // padGroupController::baseAddress
+    static const uint32_t BLOCK_GPIO = 2; // gpioController::gpioController1BaseAddress
+
+    static const uint32_t ACCESS_READ_WRITE = 0;
+    static const uint32_t ACCESS_READ_ONLY = 1;
+
+    static const uint32_t NOT_FOUND = 0xFFFFFFFF;
+};
+
+struct RegisterFieldInfo
+{
+    const char* name; // "PUPD", "BIT_3" ...
+    uint32_t bit;
+    uint32_t bitWidth;
+};
+
+// Registers with identical fields share one layout
+struct RegisterLayoutInfo
+{
+    uint32_t firstField; // index into registerMetadataTable::fields
+    uint32_t numberOfFields;
+};
+
+struct RegisterInfo
+{
+    const char* name; // struct name, or GPIO_CNF_A style TRM name for the GPIO ports
+    uint32_t block;
+    uint32_t baseAddress;
+    uint32_t addressOffset; // from baseAddress
+    uint32_t resetValue;
+    bool hasResetValue; // false for GPIO_IN and registers the README has no reset for
+    uint32_t access;
+    uint32_t layout; // index into registerMetadataTable::layouts
+};
+
+/*
+ * FNV-1a with a seed mixed into the offset basis and a final avalanche, the
+ * same function generateRegisterMetadata.py builds the table with. Recursive
+ * to stay within C++11 constexpr.
+ */
+constexpr uint32_t registerNameFnv(const char* name, uint32_t hash)
+{
+    return (*name == '\0') ? hash : registerNameFnv(name + 1, (hash ^ (uint32_t)(unsigned char)*name)*16777619u);
+}
+
+constexpr uint32_t registerNameAvalanche(uint32_t hash)
+{
+    return hash ^ (hash >> 15);
+}
+
+constexpr uint32_t registerNameHash(const char* name, uint32_t seed)
+{
+    return registerNameAvalanche((registerNameFnv(name, 2166136261u ^ (seed*0x9e3779b9u)) ^
+        (registerNameFnv(name, 2166136261u ^ (seed*0x9e3779b9u)) >> 16))*0x7feb352du);
+}
+
+#endif //REGISTER_METADATA_TYPES_H
@@ -0,0 +1,164 @@
+/**
+ * @file ringBuffer.h
+ * @brief single producer, single consumer lock-free ring buffer
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano single producer, single consumer ring buffer
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class RingBuffer
+ * @brief Lock-free FIFO between one producer thread and one consumer thread
+ *
+ * @section Description
+ *
+ * Meant for handing data between a polling thread that owns a peripheral
+ * FIFO and the rest of the program. Exactly one thread may call the write
+ * side (push, write) and exactly one the read side (pop, read), neither
+ * ever blocks or takes a lock.
+ *
+ * The capacity is rounded up to a power of two so the indices wrap with a
+ * mask. head and tail only ever count up, each is written by one side and
+ * is padded onto its own cache line so the two threads do not fight over it.
+ */
+
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <cstdint>
+#include <atomic>
+#include <vector>
+
+template<typename T>
+class RingBuffer
+{
+    public:
+        RingBuffer(uint32_t minimumCapacity) : buffer(roundUpToPowerOfTwo(minimumCapacity)), mask(buffer.size() - 1)
+        {
+            head = 0;
+            tail = 0;
+        }
+
+        RingBuffer(const RingBuffer&) = delete;
+        RingBuffer& operator=(const RingBuffer&) = delete;
+
+        // Producer side. Returns false, dropping value, when full.
+        bool push(const T& value)
+        {
+            uint32_t currentHead = head.load(std::memory_order_relaxed);
+            if((currentHead - tail.load(std::memory_order_acquire)) > mask)
+            {
+                return false;
+            }
+
+            buffer[currentHead & mask] = value;
+            head.store(currentHead + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Producer side. Returns how many of the count values fit.
+        uint32_t write(const T* values, uint32_t count)
+        {
+            uint32_t currentHead = head.load(std::memory_order_relaxed);
+            uint32_t space = (mask + 1) - (currentHead - tail.load(std::memory_order_acquire));
+            if(count > space)
+            {
+                count = space;
+            }
+
+            for(uint32_t i = 0; i < count; i++)
+            {
+                buffer[(currentHead + i) & mask] = values[i];
+            }
+            head.store(currentHead + count, std::memory_order_release);
+            return count;
+        }
+
+        // Consumer side. Returns false when empty.
+        bool pop(T& value)
+        {
+            uint32_t currentTail = tail.load(std::memory_order_relaxed);
+            if(currentTail == head.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+
+            value = buffer[currentTail & mask];
+            tail.store(currentTail + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Consumer side. Returns how many values, up to count, were read.
+        uint32_t read(T* values, uint32_t count)
+        {
+            uint32_t currentTail = tail.load(std::memory_order_relaxed);
+            uint32_t available = head.load(std::memory_order_acquire) - currentTail;
+            if(count > available)
+            {
+                count = available;
+            }
+
+            for(uint32_t i = 0; i < count; i++)
+            {
+                values[i] = buffer[(currentTail + i) & mask];
+            }
+            tail.store(currentTail + count, std::memory_order_release);
+            return count;
+        }
+
+        // Exact from either side for its own end, a snapshot otherwise.
+        uint32_t size() const
+        {
+            return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+        }
+
+        uint32_t capacity() const
+        {
+            return mask + 1;
+        }
+
+    private:
+        static uint32_t roundUpToPowerOfTwo(uint32_t value)
+        {
+            uint32_t powerOfTwo = 1;
+            while(powerOfTwo < value)
+            {
+                powerOfTwo <<= 1;
+            }
+            return powerOfTwo;
+        }
+
+        // Padding instead of alignas, C++11 new does not honour over-aligned types
+        static const uint32_t CACHE_LINE_SIZE = 64;
+
+        std::vector<T> buffer;
+        const uint32_t mask;
+
+        uint8_t headPadding[CACHE_LINE_SIZE];
+        std::atomic<uint32_t> head; // written by the producer
+        uint8_t tailPadding[CACHE_LINE_SIZE - sizeof(std::atomic<uint32_t>)];
+        std::atomic<uint32_t> tail; // written by the consumer
+        uint8_t endPadding[CACHE_LINE_SIZE - sizeof(std::atomic<uint32_t>)];
+};
+
+#endif //RING_BUFFER_H
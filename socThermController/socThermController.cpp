@@ -0,0 +1,144 @@
+#include "socThermController.h"
+#include "../timestamp/timestamp.h"
+#include <cstdint>
+#include <cassert>
+
+SocThermController::SocThermController() : socTherm(socThermController::baseAddress)
+{
+    warmMilliCelsius = socThermController::DEFAULT_WARM_MILLICELSIUS;
+    hotMilliCelsius = socThermController::DEFAULT_HOT_MILLICELSIUS;
+    hysteresisMilliCelsius = socThermController::DEFAULT_HYSTERESIS_MILLICELSIUS;
+    pollIntervalNs = socThermController::DEFAULT_POLL_INTERVAL_NS;
+
+    nextPollNs = 0;
+    state = socThermController::STATE_NORMAL;
+    hotEvents = 0;
+
+    lastReading.timestampNs = 0;
+    for(uint32_t i = 0; i < socThermController::NUMBER_OF_SENSORS; i++)
+    {
+        lastReading.milliCelsius[i] = 0;
+    }
+    lastReading.hottestMilliCelsius = 0;
+}
+
+bool SocThermController::isRunning()
+{
+    return clockAndReset.isClockEnabled(carController::SOC_THERM) && !clockAndReset.isInReset(carController::SOC_THERM);
+}
+
+int32_t SocThermController::getTemperature(uint32_t sensor)
+{
+    assert(sensor < socThermController::NUMBER_OF_SENSORS);
+
+    // CPU and GPU share TEMP1, MEM and PLLX share TEMP2, the even sensor in the upper half
+    uint32_t addressOffset = (sensor < socThermController::MEM) ? SOC_THERM_SENSOR_TEMP1_0::addressOffset : SOC_THERM_SENSOR_TEMP2_0::addressOffset;
+    uint32_t shift = ((sensor%2) == 0) ? SOC_THERM_SENSOR_TEMP1_0::CPU_TEMP_bit : SOC_THERM_SENSOR_TEMP1_0::GPU_TEMP_bit;
+
+    return decodeReadback((socTherm.getRegister(addressOffset) >> shift) & 0xFFFF);
+}
+
+void SocThermController::read(SocThermReading& reading)
+{
+    uint32_t temp1 = socTherm.getRegister(SOC_THERM_SENSOR_TEMP1_0::addressOffset);
+    uint32_t temp2 = socTherm.getRegister(SOC_THERM_SENSOR_TEMP2_0::addressOffset);
+
+    reading.timestampNs = Timestamp::now();
+    reading.milliCelsius[socThermController::CPU] = decodeReadback((temp1 >> SOC_THERM_SENSOR_TEMP1_0::CPU_TEMP_bit) & 0xFFFF);
+    reading.milliCelsius[socThermController::GPU] = decodeReadback((temp1 >> SOC_THERM_SENSOR_TEMP1_0::GPU_TEMP_bit) & 0xFFFF);
+    reading.milliCelsius[socThermController::MEM] = decodeReadback((temp2 >> SOC_THERM_SENSOR_TEMP2_0::MEM_TEMP_bit) & 0xFFFF);
+    reading.milliCelsius[socThermController::PLLX] = decodeReadback((temp2 >> SOC_THERM_SENSOR_TEMP2_0::PLLX_TEMP_bit) & 0xFFFF);
+
+    reading.hottestMilliCelsius = reading.milliCelsius[0];
+    for(uint32_t i = 1; i < socThermController::NUMBER_OF_SENSORS; i++)
+    {
+        if(reading.milliCelsius[i] > reading.hottestMilliCelsius)
+        {
+            reading.hottestMilliCelsius = reading.milliCelsius[i];
+        }
+    }
+}
+
+void SocThermController::setThresholds(int32_t warmMilliCelsius, int32_t hotMilliCelsius, int32_t hysteresisMilliCelsius)
+{
+    assert(warmMilliCelsius <= hotMilliCelsius);
+    assert(hysteresisMilliCelsius >= 0);
+
+    (*this).warmMilliCelsius = warmMilliCelsius;
+    (*this).hotMilliCelsius = hotMilliCelsius;
+    (*this).hysteresisMilliCelsius = hysteresisMilliCelsius;
+}
+
+void SocThermController::setPollInterval(uint32_t intervalNs)
+{
+    pollIntervalNs = intervalNs;
+}
+
+uint32_t SocThermController::poll()
+{
+    uint64_t currentTime = Timestamp::now();
+    if(currentTime < nextPollNs)
+    {
+        return state;
+    }
+
+    nextPollNs = currentTime + pollIntervalNs;
+    read(lastReading);
+
+    uint32_t newState = classify(lastReading.hottestMilliCelsius);
+    if((newState == socThermController::STATE_HOT) && (state != socThermController::STATE_HOT))
+    {
+        hotEvents++;
+    }
+    state = newState;
+
+    return state;
+}
+
+uint32_t SocThermController::getState()
+{
+    return state;
+}
+
+const SocThermReading& SocThermController::getLastReading()
+{
+    return lastReading;
+}
+
+uint64_t SocThermController::getHotEvents()
+{
+    return hotEvents;
+}
+
+int32_t SocThermController::decodeReadback(uint32_t readback)
+{
+    int32_t milliCelsius = (int32_t)((readback >> socThermReadback::VALUE_bit) & ((1 << socThermReadback::VALUE_bitWidth) - 1))*1000;
+
+    if(((readback >> socThermReadback::ADD_HALF_bit) & 1) != 0)
+    {
+        milliCelsius += 500;
+    }
+    if(((readback >> socThermReadback::NEGATE_bit) & 1) != 0)
+    {
+        milliCelsius = -milliCelsius;
+    }
+
+    return milliCelsius;
+}
+
+// Rising takes the threshold itself, falling has to clear it by the hysteresis
+uint32_t SocThermController::classify(int32_t hottestMilliCelsius)
+{
+    int32_t hotExit = hotMilliCelsius - hysteresisMilliCelsius;
+    int32_t warmExit = warmMilliCelsius - hysteresisMilliCelsius;
+
+    if((hottestMilliCelsius >= hotMilliCelsius) || ((state == socThermController::STATE_HOT) && (hottestMilliCelsius > hotExit)))
+    {
+        return socThermController::STATE_HOT;
+    }
+    if((hottestMilliCelsius >= warmMilliCelsius) || ((state != socThermController::STATE_NORMAL) && (hottestMilliCelsius > warmExit)))
+    {
+        return socThermController::STATE_WARM;
+    }
+    return socThermController::STATE_NORMAL;
+}
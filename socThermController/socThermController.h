@@ -0,0 +1,187 @@
+/**
+ * @file socThermController.h
+ * @brief SoC thermal sensor register declaration and class declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano SoC thermal sensor direct register access drivers
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class SocThermController
+ * @brief SoC thermal sensor readout with a cheap, rate limited check for real time loops
+ *
+ * @section Description
+ *
+ * SOC_THERM at 0x700e2000 samples the on die temperature sensors and
+ * publishes the hottest reading of each sensor group in two readback
+ * registers, two groups per register:
+ * ________________________________________
+ * Register      | Bits 31:16 | Bits 15:0
+ * SENSOR_TEMP1  | CPU        | GPU
+ * SENSOR_TEMP2  | MEM        | PLLX
+ *
+ * A readback is 8 bits of whole degrees in 15:8, a half degree in bit 7
+ * and a sign in bit 0. The sensors are calibrated and started by the
+ * kernel's soctherm driver, which also owns the throttling. This class
+ * only reads, it never resets or reclocks the block, isRunning() says
+ * whether there is anything to read.
+ *
+ * One readback is a single uncached load, far cheaper than the sysfs
+ * thermal zone. A spinning loop still should not read it every pass, the
+ * sensors only update every few milliseconds. poll() reads the sensors at
+ * most once per poll interval and otherwise costs a Timestamp::now() and a
+ * compare. It classifies the hottest group against two thresholds with
+ * hysteresis, so a loop can back off when it goes WARM, flag degraded
+ * timing when it goes HOT, and is not flipped back and forth by noise at
+ * a threshold.
+ */
+
+#ifndef SOC_THERM_CONTROLLER_H
+#define SOC_THERM_CONTROLLER_H
+
+#include <cstdint>
+
+#include "../peripheralController/peripheralController.h"
+#include "../carController/carController.h"
+
+struct socThermController
+{
+    static const uint32_t baseAddress = 0x700e2000;
+
+    static const uint32_t CPU = 0;
+    static const uint32_t GPU = 1;
+    static const uint32_t MEM = 2;
+    static const uint32_t PLLX = 3;
+    static const uint32_t NUMBER_OF_SENSORS = 4;
+
+    static const uint32_t STATE_NORMAL = 0;
+    static const uint32_t STATE_WARM = 1;
+    static const uint32_t STATE_HOT = 2;
+
+    static const int32_t DEFAULT_WARM_MILLICELSIUS = 80000;
+    static const int32_t DEFAULT_HOT_MILLICELSIUS = 90000;
+    static const int32_t DEFAULT_HYSTERESIS_MILLICELSIUS = 3000;
+    static const uint32_t DEFAULT_POLL_INTERVAL_NS = 10000000;
+};
+
+// SOC_THERM_SENSOR_TEMP1_0
+struct SOC_THERM_SENSOR_TEMP1_0
+{
+    static const uint32_t addressOffset = 0x1C8;
+
+    static const uint32_t CPU_TEMP_bit = 16;
+    static const uint32_t CPU_TEMP_bitWidth = 16;
+
+    static const uint32_t GPU_TEMP_bit = 0;
+    static const uint32_t GPU_TEMP_bitWidth = 16;
+};
+
+// SOC_THERM_SENSOR_TEMP2_0
+struct SOC_THERM_SENSOR_TEMP2_0
+{
+    static const uint32_t addressOffset = 0x1CC;
+
+    static const uint32_t MEM_TEMP_bit = 16;
+    static const uint32_t MEM_TEMP_bitWidth = 16;
+
+    static const uint32_t PLLX_TEMP_bit = 0;
+    static const uint32_t PLLX_TEMP_bitWidth = 16;
+};
+
+// Layout of one 16 bit readback
+struct socThermReadback
+{
+    static const uint32_t VALUE_bit = 8; // whole degrees
+    static const uint32_t VALUE_bitWidth = 8;
+
+    static const uint32_t ADD_HALF_bit = 7;
+    static const uint32_t ADD_HALF_bitWidth = 1;
+
+    static const uint32_t NEGATE_bit = 0;
+    static const uint32_t NEGATE_bitWidth = 1;
+};
+
+struct SocThermReading
+{
+    uint64_t timestampNs;
+    int32_t milliCelsius[socThermController::NUMBER_OF_SENSORS];
+    int32_t hottestMilliCelsius;
+};
+
+class SocThermController
+{
+    public:
+        SocThermController();
+
+        SocThermController(const SocThermController&) = delete;
+        SocThermController& operator=(const SocThermController&) = delete;
+
+        // True when the block is clocked and out of reset.
+        bool isRunning();
+
+        // socThermController::CPU through PLLX, in millidegrees Celsius.
+        int32_t getTemperature(uint32_t sensor);
+
+        // Both readback registers, two loads.
+        void read(SocThermReading& reading);
+
+        /*
+         * A state is entered when the hottest group reaches its threshold
+         * and left when it drops hysteresisMilliCelsius below it.
+         */
+        void setThresholds(int32_t warmMilliCelsius, int32_t hotMilliCelsius, int32_t hysteresisMilliCelsius);
+        void setPollInterval(uint32_t intervalNs);
+
+        /*
+         * Returns the current socThermController::STATE_*, reading the
+         * sensors only when the poll interval has passed since the last read.
+         */
+        uint32_t poll();
+
+        // The state and reading from the last time poll() read the sensors.
+        uint32_t getState();
+        const SocThermReading& getLastReading();
+
+        // How many times poll() has moved into STATE_HOT.
+        uint64_t getHotEvents();
+
+        static int32_t decodeReadback(uint32_t readback);
+
+    private:
+        uint32_t classify(int32_t hottestMilliCelsius);
+
+        PeripheralController socTherm;
+        CarController clockAndReset;
+
+        int32_t warmMilliCelsius;
+        int32_t hotMilliCelsius;
+        int32_t hysteresisMilliCelsius;
+        uint32_t pollIntervalNs;
+
+        uint64_t nextPollNs;
+        uint32_t state;
+        uint64_t hotEvents;
+        SocThermReading lastReading;
+};
+
+#endif //SOC_THERM_CONTROLLER_H
@@ -0,0 +1,307 @@
+#include "softPwm.h"
+#include "../gpioController/gpio.h"
+#include "../timestamp/timestamp.h"
+#include "../delay/delay.h"
+#include "../realTimeExecutor/realTimeExecutor.h"
+#include <cstdint>
+#include <algorithm>
+#include <limits>
+#include <cassert>
+
+SoftPwm::SoftPwm(uint32_t periodNs) : gpio(gpioController::gpioController1BaseAddress), periodNs(periodNs)
+{
+    assert(periodNs > 0);
+    scheduleChanged = false;
+    running = false;
+}
+
+SoftPwm::~SoftPwm()
+{
+    stop();
+}
+
+uint32_t SoftPwm::addChannel(GpioPin pin, uint32_t dutyNs)
+{
+    assert(!running);
+    assert(pin.port < gpioPort::NUMBER_OF_PORTS);
+    assert(pin.bit < gpioPort::PINS_PER_PORT);
+    assert(dutyNs <= periodNs);
+
+    std::lock_guard<std::mutex> configLock(configMutex);
+    pins.push_back(pin);
+    duties.push_back(dutyNs);
+
+    std::lock_guard<std::mutex> statisticsLock(statisticsMutex);
+    ChannelAccumulator accumulator;
+    clearAccumulator(accumulator);
+    statistics.push_back(accumulator);
+
+    return pins.size() - 1;
+}
+
+void SoftPwm::setDuty(uint32_t channel, uint32_t dutyNs)
+{
+    assert(dutyNs <= periodNs);
+
+    std::lock_guard<std::mutex> configLock(configMutex);
+    assert(channel < duties.size());
+    duties[channel] = dutyNs;
+    buildSchedule(pendingSchedule);
+    scheduleChanged = true;
+}
+
+uint32_t SoftPwm::getDuty(uint32_t channel)
+{
+    std::lock_guard<std::mutex> configLock(configMutex);
+    assert(channel < duties.size());
+    return duties[channel];
+}
+
+uint32_t SoftPwm::getNumberOfChannels()
+{
+    std::lock_guard<std::mutex> configLock(configMutex);
+    return pins.size();
+}
+
+void SoftPwm::start()
+{
+    assert(!running);
+
+    {
+        std::lock_guard<std::mutex> configLock(configMutex);
+        buildSchedule(activeSchedule);
+        scheduleChanged = false;
+    }
+
+    running = true;
+    pwmThread = std::thread(&SoftPwm::run, this);
+    RealTimeExecutor::raiseThreadPriority(pwmThread);
+}
+
+void SoftPwm::stop()
+{
+    if(!running)
+    {
+        return;
+    }
+
+    running = false;
+    pwmThread.join();
+}
+
+SoftPwmChannelStatistics SoftPwm::getStatistics(uint32_t channel)
+{
+    std::lock_guard<std::mutex> statisticsLock(statisticsMutex);
+    assert(channel < statistics.size());
+
+    SoftPwmChannelStatistics channelStatistics;
+    const ChannelAccumulator& accumulator = statistics[channel];
+
+    channelStatistics.edges = accumulator.edges;
+    if(accumulator.edges == 0)
+    {
+        channelStatistics.minLatenessNs = 0;
+        channelStatistics.maxLatenessNs = 0;
+        channelStatistics.meanLatenessNs = 0;
+    }
+    else
+    {
+        channelStatistics.minLatenessNs = accumulator.minLatenessNs;
+        channelStatistics.maxLatenessNs = accumulator.maxLatenessNs;
+        channelStatistics.meanLatenessNs = accumulator.sumLatenessNs/(int64_t)accumulator.edges;
+    }
+    channelStatistics.jitterNs = channelStatistics.maxLatenessNs - channelStatistics.minLatenessNs;
+
+    return channelStatistics;
+}
+
+uint64_t SoftPwm::getOverruns()
+{
+    std::lock_guard<std::mutex> statisticsLock(statisticsMutex);
+    return overruns;
+}
+
+void SoftPwm::resetStatistics()
+{
+    std::lock_guard<std::mutex> statisticsLock(statisticsMutex);
+    for(uint32_t i = 0; i < statistics.size(); i++)
+    {
+        clearAccumulator(statistics[i]);
+    }
+    overruns = 0;
+}
+
+/*
+ * Compiles the current duties into edges. Called with configMutex held.
+ *
+ * The first edge group is the rising edge at time zero, one store per port
+ * that drives every channel on that port high, or low for a duty of zero.
+ * After that each distinct (duty, port) pair becomes one falling edge store.
+ * Channels at 100% duty never fall.
+ */
+void SoftPwm::buildSchedule(Schedule& schedule)
+{
+    schedule.edges.clear();
+    schedule.edgeChannels.clear();
+
+    std::vector<uint32_t> order(pins.size());
+    for(uint32_t i = 0; i < order.size(); i++)
+    {
+        order[i] = i;
+    }
+
+    // Rising edges, grouped by port
+    std::sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b)
+    {
+        return pins[a].port < pins[b].port;
+    });
+
+    for(uint32_t i = 0; i < order.size();)
+    {
+        uint32_t port = pins[order[i]].port;
+        uint32_t bitMask = 0;
+        uint32_t bitValues = 0;
+
+        Edge edge;
+        edge.timeNs = 0;
+        edge.firstChannel = schedule.edgeChannels.size();
+        edge.numberOfChannels = 0;
+
+        for(; (i < order.size()) && (pins[order[i]].port == port); i++)
+        {
+            uint32_t channel = order[i];
+            bitMask |= 1 << pins[channel].bit;
+            if(duties[channel] > 0)
+            {
+                bitValues |= 1 << pins[channel].bit;
+            }
+            schedule.edgeChannels.push_back(channel);
+            edge.numberOfChannels++;
+        }
+
+        edge.registerAddress = gpio.getRegisterAddress(gpioPortOffset(port, GPIO_MSK_OUT_0::addressOffset));
+        edge.value = gpioMaskedValue(bitMask, bitValues);
+        schedule.edges.push_back(edge);
+    }
+
+    // Falling edges, sorted by time then grouped by port
+    order.erase(std::remove_if(order.begin(), order.end(), [this](uint32_t channel)
+    {
+        return (duties[channel] == 0) || (duties[channel] >= periodNs);
+    }), order.end());
+
+    std::sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b)
+    {
+        if(duties[a] != duties[b])
+        {
+            return duties[a] < duties[b];
+        }
+        return pins[a].port < pins[b].port;
+    });
+
+    for(uint32_t i = 0; i < order.size();)
+    {
+        uint32_t timeNs = duties[order[i]];
+        uint32_t port = pins[order[i]].port;
+        uint32_t bitMask = 0;
+
+        Edge edge;
+        edge.timeNs = timeNs;
+        edge.firstChannel = schedule.edgeChannels.size();
+        edge.numberOfChannels = 0;
+
+        for(; (i < order.size()) && (duties[order[i]] == timeNs) && (pins[order[i]].port == port); i++)
+        {
+            bitMask |= 1 << pins[order[i]].bit;
+            schedule.edgeChannels.push_back(order[i]);
+            edge.numberOfChannels++;
+        }
+
+        edge.registerAddress = gpio.getRegisterAddress(gpioPortOffset(port, GPIO_MSK_OUT_0::addressOffset));
+        edge.value = gpioMaskedValue(bitMask, 0);
+        schedule.edges.push_back(edge);
+    }
+}
+
+void SoftPwm::run()
+{
+    std::vector<ChannelAccumulator> periodStatistics(statistics.size());
+    for(uint32_t i = 0; i < periodStatistics.size(); i++)
+    {
+        clearAccumulator(periodStatistics[i]);
+    }
+
+    uint64_t periodStart = Timestamp::now() + periodNs;
+
+    while(running)
+    {
+        // Only swap on a period boundary so a period is never half old, half new
+        if(scheduleChanged && configMutex.try_lock())
+        {
+            std::swap(activeSchedule, pendingSchedule);
+            scheduleChanged = false;
+            configMutex.unlock();
+        }
+
+        const Edge* edges = activeSchedule.edges.data();
+        const uint32_t* edgeChannels = activeSchedule.edgeChannels.data();
+        uint32_t numberOfEdges = activeSchedule.edges.size();
+
+        for(uint32_t i = 0; i < numberOfEdges; i++)
+        {
+            uint64_t deadline = periodStart + edges[i].timeNs;
+            Delay::sleepUntil(deadline);
+            *edges[i].registerAddress = edges[i].value;
+            int64_t latenessNs = (int64_t)(Timestamp::now() - deadline);
+
+            for(uint32_t j = 0; j < edges[i].numberOfChannels; j++)
+            {
+                ChannelAccumulator& accumulator = periodStatistics[edgeChannels[edges[i].firstChannel + j]];
+                accumulator.edges++;
+                accumulator.sumLatenessNs += latenessNs;
+                accumulator.minLatenessNs = std::min(accumulator.minLatenessNs, latenessNs);
+                accumulator.maxLatenessNs = std::max(accumulator.maxLatenessNs, latenessNs);
+            }
+        }
+
+        mergeStatistics(periodStatistics);
+
+        periodStart += periodNs;
+        uint64_t currentTime = Timestamp::now();
+        if(currentTime > periodStart)
+        {
+            // Missed at least one whole period, skip ahead instead of bursting
+            uint64_t missedPeriods = ((currentTime - periodStart)/periodNs) + 1;
+            periodStart += missedPeriods*periodNs;
+
+            std::lock_guard<std::mutex> statisticsLock(statisticsMutex);
+            overruns += missedPeriods;
+        }
+    }
+}
+
+void SoftPwm::mergeStatistics(std::vector<ChannelAccumulator>& periodStatistics)
+{
+    std::lock_guard<std::mutex> statisticsLock(statisticsMutex);
+    for(uint32_t i = 0; i < periodStatistics.size(); i++)
+    {
+        if(periodStatistics[i].edges == 0)
+        {
+            continue;
+        }
+
+        statistics[i].edges += periodStatistics[i].edges;
+        statistics[i].sumLatenessNs += periodStatistics[i].sumLatenessNs;
+        statistics[i].minLatenessNs = std::min(statistics[i].minLatenessNs, periodStatistics[i].minLatenessNs);
+        statistics[i].maxLatenessNs = std::max(statistics[i].maxLatenessNs, periodStatistics[i].maxLatenessNs);
+        clearAccumulator(periodStatistics[i]);
+    }
+}
+
+void SoftPwm::clearAccumulator(ChannelAccumulator& accumulator)
+{
+    accumulator.edges = 0;
+    accumulator.minLatenessNs = std::numeric_limits<int64_t>::max();
+    accumulator.maxLatenessNs = std::numeric_limits<int64_t>::min();
+    accumulator.sumLatenessNs = 0;
+}
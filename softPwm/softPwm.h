@@ -0,0 +1,145 @@
+/**
+ * @file softPwm.h
+ * @brief multi-channel software PWM class declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano multi-channel software PWM
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class SoftPwm
+ * @brief Software PWM on GPIO pins without a hardware PWM function
+ *
+ * @section Description
+ *
+ * Runs any number of PWM channels sharing one period on a single thread.
+ * Whenever the duty cycles change the period is compiled into a list of
+ * edges sorted by time. Every edge holds one GPIO_MSK_OUT store per port it
+ * touches, so channels on the same port with the same duty toggle together
+ * and the cost of an edge does not grow with the number of channels.
+ *
+ * All channels go high at the start of the period (channels with a duty of
+ * zero are held low) and fall at their duty time. The pins must already be
+ * configured as GPIO outputs.
+ *
+ * For every edge the thread records how late the store completed relative to
+ * its deadline, per channel, see getStatistics().
+ */
+
+#ifndef SOFT_PWM_H
+#define SOFT_PWM_H
+
+#include <cstdint>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+
+#include "../peripheralController/peripheralController.h"
+#include "../gpioController/gpioPin.h"
+
+struct SoftPwmChannelStatistics
+{
+    uint64_t edges;
+    int64_t minLatenessNs;
+    int64_t maxLatenessNs;
+    int64_t meanLatenessNs;
+    int64_t jitterNs; // maxLatenessNs - minLatenessNs
+};
+
+class SoftPwm
+{
+    public:
+        SoftPwm(uint32_t periodNs);
+        ~SoftPwm();
+
+        SoftPwm(const SoftPwm&) = delete;
+        SoftPwm& operator=(const SoftPwm&) = delete;
+
+        /*
+         * Channels can only be added while the PWM is stopped. Returns the
+         * channel number used by setDuty and getStatistics.
+         */
+        uint32_t addChannel(GpioPin pin, uint32_t dutyNs);
+
+        // Takes effect at the start of the next period.
+        void setDuty(uint32_t channel, uint32_t dutyNs);
+        uint32_t getDuty(uint32_t channel);
+        uint32_t getNumberOfChannels();
+
+        void start();
+        void stop();
+
+        SoftPwmChannelStatistics getStatistics(uint32_t channel);
+        uint64_t getOverruns();
+        void resetStatistics();
+
+    private:
+        struct Edge
+        {
+            uint32_t timeNs; // from the start of the period
+            volatile uint32_t* registerAddress;
+            uint32_t value;
+            uint32_t firstChannel; // index into Schedule::edgeChannels
+            uint32_t numberOfChannels;
+        };
+
+        struct Schedule
+        {
+            std::vector<Edge> edges;
+            std::vector<uint32_t> edgeChannels;
+        };
+
+        struct ChannelAccumulator
+        {
+            uint64_t edges;
+            int64_t minLatenessNs;
+            int64_t maxLatenessNs;
+            int64_t sumLatenessNs;
+        };
+
+        void buildSchedule(Schedule& schedule);
+        void run();
+        void mergeStatistics(std::vector<ChannelAccumulator>& periodStatistics);
+        static void clearAccumulator(ChannelAccumulator& accumulator);
+
+        PeripheralController gpio;
+        const uint32_t periodNs;
+
+        std::vector<GpioPin> pins;
+        std::vector<uint32_t> duties;
+
+        std::mutex configMutex; // guards duties and pendingSchedule
+        Schedule pendingSchedule;
+        Schedule activeSchedule; // only touched by the PWM thread while running
+        std::atomic<bool> scheduleChanged;
+
+        std::mutex statisticsMutex;
+        std::vector<ChannelAccumulator> statistics;
+        uint64_t overruns = 0;
+
+        std::thread pwmThread;
+        std::atomic<bool> running;
+};
+
+#endif //SOFT_PWM_H
@@ -0,0 +1,244 @@
+#include "spiController.h"
+#include "../gpioController/gpio.h"
+#include "../gpioController/gpioPin.h"
+#include "../pinmuxController/pinmuxController.h"
+#include "../timestamp/timestamp.h"
+#include <cstdint>
+#include <cstddef>
+#include <cassert>
+
+// FIFO_STATUS bits that mean the last burst went wrong, all write 1 to clear
+static const uint32_t FIFO_ERROR_MASK = (1 << SPI_FIFO_STATUS_0::ERR_bit) |
+    (1 << SPI_FIFO_STATUS_0::TX_FIFO_OVF_bit) | (1 << SPI_FIFO_STATUS_0::TX_FIFO_UNF_bit) |
+    (1 << SPI_FIFO_STATUS_0::RX_FIFO_OVF_bit) | (1 << SPI_FIFO_STATUS_0::RX_FIFO_UNF_bit);
+
+static uint32_t getBaseAddress(uint32_t controller)
+{
+    static const uint32_t baseAddresses[] = {spiController::SPI1_baseAddress, spiController::SPI2_baseAddress,
+        spiController::SPI3_baseAddress, spiController::SPI4_baseAddress};
+
+    assert((controller >= spiController::SPI1) && (controller <= spiController::SPI4));
+    return baseAddresses[controller - spiController::SPI1];
+}
+
+static uint32_t getCarDevice(uint32_t controller)
+{
+    static const uint32_t carDevices[] = {carController::SBC1, carController::SBC2, carController::SBC3, carController::SBC4};
+
+    assert((controller >= spiController::SPI1) && (controller <= spiController::SPI4));
+    return carDevices[controller - spiController::SPI1];
+}
+
+SpiController::SpiController(uint32_t controller) : spi(getBaseAddress(controller)), carDevice(getCarDevice(controller))
+{
+    command = (spiController::M_S_BIT_MASTER << SPI_COMMAND_0::M_S_bit) |
+        (spiController::MODE_0 << SPI_COMMAND_0::MODE_bit) |
+        (0 << SPI_COMMAND_0::CS_SEL_bit) |
+        (0xF << SPI_COMMAND_0::CS_POL_INACTIVE_bit) |
+        (spiController::CS_SW_HW_BIT_SOFTWARE << SPI_COMMAND_0::CS_SW_HW_bit) |
+        (spiController::CS_SW_VAL_BIT_HIGH << SPI_COMMAND_0::CS_SW_VAL_bit) |
+        (1 << SPI_COMMAND_0::PACKED_bit) |
+        (spiController::BIT_LENGTH_8 << SPI_COMMAND_0::BIT_LENGTH_bit);
+}
+
+uint32_t SpiController::configure(uint32_t clockHz, uint32_t mode, uint32_t chipSelect)
+{
+    setMode(mode);
+    setChipSelect(chipSelect);
+    return setClockRate(clockHz);
+}
+
+uint32_t SpiController::setClockRate(uint32_t clockHz)
+{
+    return clockAndReset.setClockRate(carDevice, clockHz);
+}
+
+void SpiController::enableController()
+{
+    clockAndReset.bringUp(carDevice);
+    spi.setRegister(SPI_COMMAND_0::addressOffset, command);
+}
+
+void SpiController::setMode(uint32_t mode)
+{
+    assert(mode <= spiController::MODE_3);
+
+    uint32_t bitMask = ((1 << SPI_COMMAND_0::MODE_bitWidth) - 1) << SPI_COMMAND_0::MODE_bit;
+    command = (command & ~bitMask) | (mode << SPI_COMMAND_0::MODE_bit);
+    spi.setRegister(SPI_COMMAND_0::addressOffset, command);
+}
+
+void SpiController::setChipSelect(uint32_t chipSelect)
+{
+    assert(chipSelect < spiController::MAX_CHIP_SELECT);
+
+    uint32_t bitMask = ((1 << SPI_COMMAND_0::CS_SEL_bitWidth) - 1) << SPI_COMMAND_0::CS_SEL_bit;
+    command = (command & ~bitMask) | (chipSelect << SPI_COMMAND_0::CS_SEL_bit);
+    spi.setRegister(SPI_COMMAND_0::addressOffset, command);
+}
+
+bool SpiController::transfer(const uint8_t* txData, uint8_t* rxData, uint32_t length)
+{
+    if(length == 0)
+    {
+        return true;
+    }
+
+    uint32_t transferCommand = command & ~(1 << SPI_COMMAND_0::CS_SW_VAL_bit);
+    if(txData != NULL)
+    {
+        transferCommand |= 1 << SPI_COMMAND_0::TX_EN_bit;
+    }
+    if(rxData != NULL)
+    {
+        transferCommand |= 1 << SPI_COMMAND_0::RX_EN_bit;
+    }
+
+    if(!flushFifos())
+    {
+        return false;
+    }
+
+    // Assert chip select once for every burst
+    spi.setRegister(SPI_COMMAND_0::addressOffset, transferCommand);
+
+    bool succeeded = true;
+    const uint32_t burstBytes = spiController::FIFO_DEPTH*spiController::BYTES_PER_WORD;
+    for(uint32_t offset = 0; succeeded && (offset < length); offset += burstBytes)
+    {
+        uint32_t burstLength = ((length - offset) < burstBytes) ? (length - offset) : burstBytes;
+        succeeded = transferBurst((txData != NULL) ? txData + offset : NULL, (rxData != NULL) ? rxData + offset : NULL, burstLength, transferCommand);
+    }
+
+    spi.setRegister(SPI_COMMAND_0::addressOffset, command);
+    return succeeded;
+}
+
+bool SpiController::write(const uint8_t* txData, uint32_t length)
+{
+    return transfer(txData, NULL, length);
+}
+
+bool SpiController::read(uint8_t* rxData, uint32_t length)
+{
+    return transfer(NULL, rxData, length);
+}
+
+/*
+ * One FIFO load. Bytes are packed four to a word, first byte in the low
+ * byte, the same order the controller shifts them out in packed mode. False
+ * on a timeout or a FIFO error, the controller is recovered either way.
+ */
+bool SpiController::transferBurst(const uint8_t* txData, uint8_t* rxData, uint32_t length, uint32_t transferCommand)
+{
+    volatile uint32_t* txFifo = spi.getRegisterAddress(SPI_TX_FIFO_0::addressOffset);
+    volatile uint32_t* rxFifo = spi.getRegisterAddress(SPI_RX_FIFO_0::addressOffset);
+    volatile uint32_t* transferStatus = spi.getRegisterAddress(SPI_TRANSFER_STATUS_0::addressOffset);
+    uint32_t words = (length + spiController::BYTES_PER_WORD - 1)/spiController::BYTES_PER_WORD;
+
+    spi.setRegister(SPI_DMA_BLK_SIZE_0::addressOffset, length - 1);
+
+    if(txData != NULL)
+    {
+        for(uint32_t i = 0; i < length; i += spiController::BYTES_PER_WORD)
+        {
+            uint32_t word = 0;
+            for(uint32_t j = 0; (j < spiController::BYTES_PER_WORD) && ((i + j) < length); j++)
+            {
+                word |= (uint32_t)txData[i + j] << (8*j);
+            }
+            *txFifo = word;
+        }
+    }
+
+    spi.setRegister(SPI_COMMAND_0::addressOffset, transferCommand | (1 << SPI_COMMAND_0::PIO_bit));
+
+    uint64_t start = Timestamp::now();
+    while(((*transferStatus >> SPI_TRANSFER_STATUS_0::RDY_bit) & 1) == 0)
+    {
+        if((Timestamp::now() - start) > spiController::TIMEOUT_NS)
+        {
+            recover();
+            return false;
+        }
+    }
+    *transferStatus = 1 << SPI_TRANSFER_STATUS_0::RDY_bit;
+
+    if((spi.getRegister(SPI_FIFO_STATUS_0::addressOffset) & FIFO_ERROR_MASK) != 0)
+    {
+        recover();
+        return false;
+    }
+
+    if(rxData != NULL)
+    {
+        for(uint32_t i = 0; i < words; i++)
+        {
+            uint32_t word = *rxFifo;
+            for(uint32_t j = 0; (j < spiController::BYTES_PER_WORD) && (((i*spiController::BYTES_PER_WORD) + j) < length); j++)
+            {
+                rxData[(i*spiController::BYTES_PER_WORD) + j] = (uint8_t)(word >> (8*j));
+            }
+        }
+    }
+
+    return true;
+}
+
+bool SpiController::flushFifos()
+{
+    uint32_t flushMask = (1 << SPI_FIFO_STATUS_0::RX_FIFO_FLUSH_bit) | (1 << SPI_FIFO_STATUS_0::TX_FIFO_FLUSH_bit);
+    volatile uint32_t* fifoStatus = spi.getRegisterAddress(SPI_FIFO_STATUS_0::addressOffset);
+
+    *fifoStatus = flushMask;
+    uint64_t start = Timestamp::now();
+    while((*fifoStatus & flushMask) != 0)
+    {
+        if((Timestamp::now() - start) > spiController::TIMEOUT_NS)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Drops whatever the failed burst left behind
+void SpiController::recover()
+{
+    flushFifos();
+    spi.setRegister(SPI_FIFO_STATUS_0::addressOffset, FIFO_ERROR_MASK);
+    spi.setRegister(SPI_TRANSFER_STATUS_0::addressOffset, 1 << SPI_TRANSFER_STATUS_0::RDY_bit);
+}
+
+void SpiController::attachHeaderBus(uint32_t headerBus)
+{
+    PeripheralController myPinMuxController(pinmuxController::baseAddress);
+    PeripheralController myGpioController(gpioController::gpioController1BaseAddress);
+
+    if(headerBus == spiController::HEADER_SPI0)
+    {
+        // Header pins #19, #21, #23, #24, #26, Tegra SPI1, GPIO Port PC.00 - PC.04
+        attachPad<PINMUX_AUX_SPI1_MOSI_0>(myPinMuxController, pinmuxController::PM_BIT_SPI1);
+        attachPad<PINMUX_AUX_SPI1_MISO_0>(myPinMuxController, pinmuxController::PM_BIT_SPI1);
+        attachPad<PINMUX_AUX_SPI1_SCK_0>(myPinMuxController, pinmuxController::PM_BIT_SPI1);
+        attachPad<PINMUX_AUX_SPI1_CS0_0>(myPinMuxController, pinmuxController::PM_BIT_SPI1);
+        attachPad<PINMUX_AUX_SPI1_CS1_0>(myPinMuxController, pinmuxController::PM_BIT_SPI1);
+        myGpioController.setRegister(gpioPortOffset(gpioPort::PC, GPIO_MSK_CNF_0::addressOffset), gpioMaskedValue(0x1F, gpioController::BIT_N_SPIO));
+    }
+    else if(headerBus == spiController::HEADER_SPI1)
+    {
+        // Header pins #37, #22, #13, #18, Tegra SPI2, GPIO Port PB.04 - PB.07, #16 GPIO Port PDD.00
+        attachPad<PINMUX_AUX_SPI2_MOSI_0>(myPinMuxController, pinmuxController::PM_BIT_SPI2);
+        attachPad<PINMUX_AUX_SPI2_MISO_0>(myPinMuxController, pinmuxController::PM_BIT_SPI2);
+        attachPad<PINMUX_AUX_SPI2_SCK_0>(myPinMuxController, pinmuxController::PM_BIT_SPI2);
+        attachPad<PINMUX_AUX_SPI2_CSO_0>(myPinMuxController, pinmuxController::PM_BIT_SPI2);
+        attachPad<PINMUX_AUX_SPI2_CS1_0>(myPinMuxController, pinmuxController::PM_BIT_SPI2);
+        myGpioController.setRegister(gpioPortOffset(gpioPort::PB, GPIO_MSK_CNF_0::addressOffset), gpioMaskedValue(0xF0, gpioController::BIT_N_SPIO));
+        myGpioController.setRegister(gpioPortOffset(gpioPort::PDD, GPIO_MSK_CNF_0::addressOffset), gpioMaskedValue(0x01, gpioController::BIT_N_SPIO));
+    }
+    else
+    {
+        assert(!"the header only has SPI0 and SPI1");
+    }
+}
@@ -0,0 +1,362 @@
+/**
+ * @file spiController.h
+ * @brief SPI controller register declaration and class declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano SPI controller direct register access drivers
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class SpiController
+ * @brief Polled SPI master on the Tegra SPI controllers
+ *
+ * @section Description
+ *
+ * Tegra210 has four SPI controllers, 0x200 apart from 0x7000d400. The
+ * header's two buses are wired to the first two, note the off by one in the
+ * naming:
+ * _________________________________________________________________
+ * Header Bus | Controller | Base Address | Pins (header #)
+ * SPI0       | SPI1       | 0x7000d400   | MOSI 19, MISO 21, SCK 23, CS0 24, CS1 26
+ * SPI1       | SPI2       | 0x7000d600   | MOSI 37, MISO 22, SCK 13, CS0 18, CS1 16
+ *
+ * transfer() runs in PIO mode with 8 bit packed words. Each burst loads up
+ * to the 64 word TX FIFO (256 bytes) with whole register stores, starts the
+ * controller, polls for ready and drains the RX FIFO the same way, so a
+ * short sensor read is a handful of register accesses and no system call.
+ * Chip select is driven in software for the whole transfer so it stays
+ * asserted between bursts.
+ *
+ * Every poll gives up after spiController::TIMEOUT_NS, and FIFO_STATUS is
+ * checked for ERR and overflow or underflow after every burst. transfer(),
+ * write() and read() return false on either, with chip select released,
+ * the FIFOs flushed and the error bits cleared.
+ *
+ * SCK runs at the controller's module clock, which comes from PLLP_OUT0
+ * (408 MHz) through the CAR CLK_SOURCE_SBCn divider, see setClockRate().
+ * The module clock must be enabled and the controller out of reset, the
+ * kernel does that while spidev has the bus open, otherwise call
+ * enableController().
+ */
+
+#ifndef SPI_CONTROLLER_H
+#define SPI_CONTROLLER_H
+
+#include <cstdint>
+
+#include "../peripheralController/peripheralController.h"
+#include "../carController/carController.h"
+
+struct spiController
+{
+    static const uint32_t SPI1_baseAddress = 0x7000d400;
+    static const uint32_t SPI2_baseAddress = 0x7000d600;
+    static const uint32_t SPI3_baseAddress = 0x7000d800;
+    static const uint32_t SPI4_baseAddress = 0x7000da00;
+
+    static const uint32_t SPI1 = 1;
+    static const uint32_t SPI2 = 2;
+    static const uint32_t SPI3 = 3;
+    static const uint32_t SPI4 = 4;
+
+    static const uint32_t HEADER_SPI0 = 0;
+    static const uint32_t HEADER_SPI1 = 1;
+
+    static const uint32_t FIFO_DEPTH = 64; // 32 bit words
+    static const uint32_t BYTES_PER_WORD = 4;
+    static const uint32_t MAX_CHIP_SELECT = 4;
+
+    static const uint64_t TIMEOUT_NS = 10000000; // no RDY or flush for this long fails the transfer
+
+    static const uint32_t MODE_0 = 0; // CPOL 0, CPHA 0
+    static const uint32_t MODE_1 = 1; // CPOL 0, CPHA 1
+    static const uint32_t MODE_2 = 2; // CPOL 1, CPHA 0
+    static const uint32_t MODE_3 = 3; // CPOL 1, CPHA 1
+
+    static const uint32_t M_S_BIT_SLAVE = 0;
+    static const uint32_t M_S_BIT_MASTER = 1;
+
+    static const uint32_t CS_SW_HW_BIT_HARDWARE = 0;
+    static const uint32_t CS_SW_HW_BIT_SOFTWARE = 1;
+
+    static const uint32_t CS_SW_VAL_BIT_LOW = 0;
+    static const uint32_t CS_SW_VAL_BIT_HIGH = 1;
+
+    static const uint32_t BIT_LENGTH_8 = 7; // bits per word - 1
+};
+
+// SPI_COMMAND_0
+struct SPI_COMMAND_0
+{
+    static const uint32_t addressOffset = 0x000;
+
+    static const uint32_t PIO_bit = 31;
+    static const uint32_t PIO_bitWidth = 1;
+
+    static const uint32_t M_S_bit = 30;
+    static const uint32_t M_S_bitWidth = 1;
+
+    static const uint32_t MODE_bit = 28;
+    static const uint32_t MODE_bitWidth = 2;
+
+    static const uint32_t CS_SEL_bit = 26;
+    static const uint32_t CS_SEL_bitWidth = 2;
+
+    static const uint32_t CS_POL_INACTIVE_bit = 22;
+    static const uint32_t CS_POL_INACTIVE_bitWidth = 4;
+
+    static const uint32_t CS_SW_HW_bit = 21;
+    static const uint32_t CS_SW_HW_bitWidth = 1;
+
+    static const uint32_t CS_SW_VAL_bit = 20;
+    static const uint32_t CS_SW_VAL_bitWidth = 1;
+
+    static const uint32_t IDLE_SDA_bit = 18;
+    static const uint32_t IDLE_SDA_bitWidth = 2;
+
+    static const uint32_t BIDIROE_bit = 17;
+    static const uint32_t BIDIROE_bitWidth = 1;
+
+    static const uint32_t LSBIT_FE_bit = 16;
+    static const uint32_t LSBIT_FE_bitWidth = 1;
+
+    static const uint32_t LSBYTE_FE_bit = 15;
+    static const uint32_t LSBYTE_FE_bitWidth = 1;
+
+    static const uint32_t BOTH_EN_BIT_bit = 14;
+    static const uint32_t BOTH_EN_BIT_bitWidth = 1;
+
+    static const uint32_t BOTH_EN_BYTE_bit = 13;
+    static const uint32_t BOTH_EN_BYTE_bitWidth = 1;
+
+    static const uint32_t RX_EN_bit = 12;
+    static const uint32_t RX_EN_bitWidth = 1;
+
+    static const uint32_t TX_EN_bit = 11;
+    static const uint32_t TX_EN_bitWidth = 1;
+
+    static const uint32_t PACKED_bit = 5;
+    static const uint32_t PACKED_bitWidth = 1;
+
+    static const uint32_t BIT_LENGTH_bit = 0;
+    static const uint32_t BIT_LENGTH_bitWidth = 5;
+};
+
+// SPI_COMMAND2_0
+struct SPI_COMMAND2_0
+{
+    static const uint32_t addressOffset = 0x004;
+
+    static const uint32_t TX_TAP_DELAY_bit = 6;
+    static const uint32_t TX_TAP_DELAY_bitWidth = 6;
+
+    static const uint32_t RX_TAP_DELAY_bit = 0;
+    static const uint32_t RX_TAP_DELAY_bitWidth = 6;
+};
+
+// SPI_CS_TIMING1_0
+struct SPI_CS_TIMING1_0
+{
+    static const uint32_t addressOffset = 0x008;
+};
+
+// SPI_CS_TIMING2_0
+struct SPI_CS_TIMING2_0
+{
+    static const uint32_t addressOffset = 0x00C;
+};
+
+// SPI_TRANSFER_STATUS_0
+struct SPI_TRANSFER_STATUS_0
+{
+    static const uint32_t addressOffset = 0x010;
+
+    static const uint32_t RDY_bit = 30; // write 1 to clear
+    static const uint32_t RDY_bitWidth = 1;
+
+    static const uint32_t SLV_IDLE_COUNT_bit = 16;
+    static const uint32_t SLV_IDLE_COUNT_bitWidth = 8;
+
+    static const uint32_t BLK_CNT_bit = 0;
+    static const uint32_t BLK_CNT_bitWidth = 16;
+};
+
+// SPI_FIFO_STATUS_0
+struct SPI_FIFO_STATUS_0
+{
+    static const uint32_t addressOffset = 0x014;
+
+    static const uint32_t CS_INACTIVE_bit = 31;
+    static const uint32_t CS_INACTIVE_bitWidth = 1;
+
+    static const uint32_t FRAME_END_bit = 30;
+    static const uint32_t FRAME_END_bitWidth = 1;
+
+    static const uint32_t RX_FIFO_FULL_COUNT_bit = 23;
+    static const uint32_t RX_FIFO_FULL_COUNT_bitWidth = 7;
+
+    static const uint32_t TX_FIFO_EMPTY_COUNT_bit = 16;
+    static const uint32_t TX_FIFO_EMPTY_COUNT_bitWidth = 7;
+
+    static const uint32_t RX_FIFO_FLUSH_bit = 15;
+    static const uint32_t RX_FIFO_FLUSH_bitWidth = 1;
+
+    static const uint32_t TX_FIFO_FLUSH_bit = 14;
+    static const uint32_t TX_FIFO_FLUSH_bitWidth = 1;
+
+    static const uint32_t ERR_bit = 8;
+    static const uint32_t ERR_bitWidth = 1;
+
+    static const uint32_t TX_FIFO_OVF_bit = 7;
+    static const uint32_t TX_FIFO_OVF_bitWidth = 1;
+
+    static const uint32_t TX_FIFO_UNF_bit = 6;
+    static const uint32_t TX_FIFO_UNF_bitWidth = 1;
+
+    static const uint32_t RX_FIFO_OVF_bit = 5;
+    static const uint32_t RX_FIFO_OVF_bitWidth = 1;
+
+    static const uint32_t RX_FIFO_UNF_bit = 4;
+    static const uint32_t RX_FIFO_UNF_bitWidth = 1;
+
+    static const uint32_t TX_FIFO_FULL_bit = 3;
+    static const uint32_t TX_FIFO_FULL_bitWidth = 1;
+
+    static const uint32_t TX_FIFO_EMPTY_bit = 2;
+    static const uint32_t TX_FIFO_EMPTY_bitWidth = 1;
+
+    static const uint32_t RX_FIFO_FULL_bit = 1;
+    static const uint32_t RX_FIFO_FULL_bitWidth = 1;
+
+    static const uint32_t RX_FIFO_EMPTY_bit = 0;
+    static const uint32_t RX_FIFO_EMPTY_bitWidth = 1;
+};
+
+// SPI_TX_DATA_0
+struct SPI_TX_DATA_0
+{
+    static const uint32_t addressOffset = 0x018;
+};
+
+// SPI_RX_DATA_0
+struct SPI_RX_DATA_0
+{
+    static const uint32_t addressOffset = 0x01C;
+};
+
+// SPI_DMA_CTL_0
+struct SPI_DMA_CTL_0
+{
+    static const uint32_t addressOffset = 0x020;
+
+    static const uint32_t DMA_EN_bit = 31;
+    static const uint32_t DMA_EN_bitWidth = 1;
+
+    static const uint32_t CONT_bit = 30;
+    static const uint32_t CONT_bitWidth = 1;
+
+    static const uint32_t IE_RXC_bit = 29;
+    static const uint32_t IE_RXC_bitWidth = 1;
+
+    static const uint32_t IE_TXC_bit = 28;
+    static const uint32_t IE_TXC_bitWidth = 1;
+
+    static const uint32_t RX_TRIG_bit = 19;
+    static const uint32_t RX_TRIG_bitWidth = 2;
+
+    static const uint32_t TX_TRIG_bit = 15;
+    static const uint32_t TX_TRIG_bitWidth = 2;
+};
+
+// SPI_DMA_BLK_SIZE_0, number of words in the next transfer - 1
+struct SPI_DMA_BLK_SIZE_0
+{
+    static const uint32_t addressOffset = 0x024;
+
+    static const uint32_t DMA_BLOCK_SIZE_bit = 0;
+    static const uint32_t DMA_BLOCK_SIZE_bitWidth = 16;
+};
+
+// SPI_TX_FIFO_0, every store pushes one word
+struct SPI_TX_FIFO_0
+{
+    static const uint32_t addressOffset = 0x108;
+};
+
+// SPI_RX_FIFO_0, every load pops one word
+struct SPI_RX_FIFO_0
+{
+    static const uint32_t addressOffset = 0x188;
+};
+
+class SpiController
+{
+    public:
+        // spiController::SPI1 through spiController::SPI4
+        SpiController(uint32_t controller);
+
+        SpiController(const SpiController&) = delete;
+        SpiController& operator=(const SpiController&) = delete;
+
+        /*
+         * Master mode, mode 0 - 3, chip select 0 - 3 and clock in one go.
+         * Returns the SCK rate actually produced, which is the fastest the
+         * divider can reach without going over clockHz.
+         */
+        uint32_t configure(uint32_t clockHz, uint32_t mode, uint32_t chipSelect);
+
+        uint32_t setClockRate(uint32_t clockHz);
+
+        // Starts the module clock and pulses the controller's reset.
+        void enableController();
+        void setMode(uint32_t mode);
+        void setChipSelect(uint32_t chipSelect);
+
+        /*
+         * Full duplex, length bytes out of txData and into rxData. Either
+         * may be NULL for a write only or read only transfer, a read only
+         * transfer leaves MOSI idle. False on a timeout or FIFO error.
+         */
+        bool transfer(const uint8_t* txData, uint8_t* rxData, uint32_t length);
+        bool write(const uint8_t* txData, uint32_t length);
+        bool read(uint8_t* rxData, uint32_t length);
+
+        /*
+         * Header bus spiController::HEADER_SPI0 or HEADER_SPI1: pinmux to
+         * the SPI function with the input buffers on, out of tristate, and
+         * the GPIO controller handing the pins to the SFIO.
+         */
+        static void attachHeaderBus(uint32_t headerBus);
+
+    private:
+        bool transferBurst(const uint8_t* txData, uint8_t* rxData, uint32_t length, uint32_t transferCommand);
+        bool flushFifos();
+        void recover();
+
+        PeripheralController spi;
+        CarController clockAndReset;
+        const uint32_t carDevice;
+        uint32_t command;
+};
+
+#endif //SPI_CONTROLLER_H
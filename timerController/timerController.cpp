@@ -0,0 +1,94 @@
+#include "timerController.h"
+#include <cstdint>
+#include <cassert>
+
+static const uint32_t timerOffsets[timerController::NUMBER_OF_TIMERS] =
+{
+    timerController::TMR0_baseOffset,
+    timerController::TMR1_baseOffset,
+    timerController::TMR2_baseOffset,
+    timerController::TMR3_baseOffset,
+    timerController::TMR4_baseOffset,
+    timerController::TMR5_baseOffset,
+    timerController::TMR6_baseOffset,
+    timerController::TMR7_baseOffset,
+    timerController::TMR8_baseOffset,
+    timerController::TMR9_baseOffset,
+    timerController::TMR10_baseOffset,
+    timerController::TMR11_baseOffset,
+    timerController::TMR12_baseOffset,
+    timerController::TMR13_baseOffset
+};
+
+TimerController::TimerController() : timer(timerController::baseAddress)
+{
+    microsecondCounter = timer.getRegisterAddress(TIMERUS_CNTR_1US_0::addressOffset);
+}
+
+volatile uint32_t* TimerController::getMicrosecondCounterAddress()
+{
+    return microsecondCounter;
+}
+
+void TimerController::setMicrosecondDivider(uint32_t dividend, uint32_t divisor)
+{
+    assert(dividend <= 0xFF);
+    assert(divisor <= 0xFF);
+
+    timer.setRegister(TIMERUS_USEC_CFG_0::addressOffset,
+        (dividend << TIMERUS_USEC_CFG_0::USEC_DIVIDEND_bit) | (divisor << TIMERUS_USEC_CFG_0::USEC_DIVISOR_bit));
+}
+
+uint32_t TimerController::getMicrosecondDividend()
+{
+    return timer.getRegisterField(TIMERUS_USEC_CFG_0::addressOffset, TIMERUS_USEC_CFG_0::USEC_DIVIDEND_bit, TIMERUS_USEC_CFG_0::USEC_DIVIDEND_bitWidth);
+}
+
+uint32_t TimerController::getMicrosecondDivisor()
+{
+    return timer.getRegisterField(TIMERUS_USEC_CFG_0::addressOffset, TIMERUS_USEC_CFG_0::USEC_DIVISOR_bit, TIMERUS_USEC_CFG_0::USEC_DIVISOR_bitWidth);
+}
+
+void TimerController::startTimer(uint32_t timerNumber, uint32_t periodUs, bool periodic)
+{
+    assert((periodUs > 0) && ((periodUs - 1) <= timerController::MAX_TRIGGER_VALUE));
+
+    uint32_t offset = getTimerOffset(timerNumber);
+    uint32_t ptv = (timerController::EN_BIT_ENABLE << TMR_PTV_0::EN_bit) |
+        ((periodic ? timerController::PER_BIT_PERIODIC : timerController::PER_BIT_ONE_SHOT) << TMR_PTV_0::PER_bit) |
+        ((periodUs - 1) << TMR_PTV_0::PTV_bit);
+
+    // Clear a stale expiry first so the first interrupt seen is this period's
+    clearTimerInterrupt(timerNumber);
+    timer.setRegister(offset + TMR_PTV_0::addressOffset, ptv);
+}
+
+void TimerController::stopTimer(uint32_t timerNumber)
+{
+    timer.setRegister(getTimerOffset(timerNumber) + TMR_PTV_0::addressOffset, 0);
+    clearTimerInterrupt(timerNumber);
+}
+
+bool TimerController::isTimerEnabled(uint32_t timerNumber)
+{
+    return timer.getRegisterField(getTimerOffset(timerNumber) + TMR_PTV_0::addressOffset, TMR_PTV_0::EN_bit, TMR_PTV_0::EN_bitWidth) ==
+        timerController::EN_BIT_ENABLE;
+}
+
+uint32_t TimerController::getTimerCount(uint32_t timerNumber)
+{
+    return timer.getRegisterField(getTimerOffset(timerNumber) + TMR_PCR_0::addressOffset, TMR_PCR_0::PCV_bit, TMR_PCR_0::PCV_bitWidth);
+}
+
+void TimerController::clearTimerInterrupt(uint32_t timerNumber)
+{
+    // Write one to clear, PCV is read only so a plain store is safe
+    timer.setRegister(getTimerOffset(timerNumber) + TMR_PCR_0::addressOffset,
+        timerController::INTR_CLR_BIT_CLEAR << TMR_PCR_0::INTR_CLR_bit);
+}
+
+uint32_t TimerController::getTimerOffset(uint32_t timerNumber)
+{
+    assert(timerNumber < timerController::NUMBER_OF_TIMERS);
+    return timerOffsets[timerNumber];
+}
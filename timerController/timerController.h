@@ -0,0 +1,193 @@
+/**
+ * @file timerController.h
+ * @brief timer controller register declaration and class declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano timer controller direct register access drivers
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class TimerController
+ * @brief Jetson timer block, TIMERUS microsecond counter and TMR timers
+ *
+ * @section Description
+ *
+ * The timer block at 0x60005000 holds the free running TIMERUS microsecond
+ * counter and the programmable TMR timers. TIMERUS counts from the
+ * oscillator through the USEC_CFG divider and is the same for every core,
+ * so a memory mapped read of TIMERUS_CNTR_1US is a timebase every thread
+ * and the boot logs agree on, at 1 us resolution.
+ *
+ * Every TMR timer is a pair of registers at its own offset in the block:
+ * _____________________________________________________
+ * Timer | Offset | Timer | Offset | Timer | Offset
+ * TMR1  | 0x000  | TMR6  | 0x068  | TMR0  | 0x088
+ * TMR2  | 0x008  | TMR7  | 0x070  | TMR10 | 0x090
+ * TMR3  | 0x050  | TMR8  | 0x078  | TMR11 | 0x098
+ * TMR4  | 0x058  | TMR9  | 0x080  | TMR12 | 0x0A0
+ * TMR5  | 0x060  |       |        | TMR13 | 0x0A8
+ *
+ * The kernel owns some of these, TMR10 - TMR13 are the per cpu clock event
+ * timers on Tegra210 and the watchdog uses one more. Only program timers
+ * nothing else is using, TMR5 - TMR9 are normally free.
+ *
+ * The timers count down in microseconds from the PTV trigger value, when
+ * they hit zero they raise their interrupt and, if periodic, reload.
+ */
+
+#ifndef TIMER_CONTROLLER_H
+#define TIMER_CONTROLLER_H
+
+#include <cstdint>
+
+#include "../peripheralController/peripheralController.h"
+
+struct timerController
+{
+    static const uint32_t baseAddress = 0x60005000;
+
+    static const uint32_t TMR0_baseOffset = 0x088;
+    static const uint32_t TMR1_baseOffset = 0x000;
+    static const uint32_t TMR2_baseOffset = 0x008;
+    static const uint32_t TMR3_baseOffset = 0x050;
+    static const uint32_t TMR4_baseOffset = 0x058;
+    static const uint32_t TMR5_baseOffset = 0x060;
+    static const uint32_t TMR6_baseOffset = 0x068;
+    static const uint32_t TMR7_baseOffset = 0x070;
+    static const uint32_t TMR8_baseOffset = 0x078;
+    static const uint32_t TMR9_baseOffset = 0x080;
+    static const uint32_t TMR10_baseOffset = 0x090;
+    static const uint32_t TMR11_baseOffset = 0x098;
+    static const uint32_t TMR12_baseOffset = 0x0A0;
+    static const uint32_t TMR13_baseOffset = 0x0A8;
+
+    static const uint32_t NUMBER_OF_TIMERS = 14;
+
+    static const uint32_t EN_BIT_DISABLE = 0;
+    static const uint32_t EN_BIT_ENABLE = 1;
+
+    static const uint32_t PER_BIT_ONE_SHOT = 0;
+    static const uint32_t PER_BIT_PERIODIC = 1;
+
+    static const uint32_t INTR_CLR_BIT_CLEAR = 1;
+
+    // 19.2 MHz oscillator: (4 + 1)/(95 + 1) gives 1 MHz
+    static const uint32_t USEC_DIVIDEND_19_2_MHZ = 4;
+    static const uint32_t USEC_DIVISOR_19_2_MHZ = 95;
+
+    static const uint32_t MAX_TRIGGER_VALUE = 0x1FFFFFFF;
+};
+
+// Timer n trigger value, at timerController::TMRn_baseOffset + addressOffset
+struct TMR_PTV_0
+{
+    static const uint32_t addressOffset = 0x0;
+
+    static const uint32_t EN_bit = 31;
+    static const uint32_t EN_bitWidth = 1;
+
+    static const uint32_t PER_bit = 30;
+    static const uint32_t PER_bitWidth = 1;
+
+    static const uint32_t PTV_bit = 0;
+    static const uint32_t PTV_bitWidth = 29;
+};
+
+// Timer n present count value, at timerController::TMRn_baseOffset + addressOffset
+struct TMR_PCR_0
+{
+    static const uint32_t addressOffset = 0x4;
+
+    static const uint32_t INTR_CLR_bit = 30;
+    static const uint32_t INTR_CLR_bitWidth = 1;
+
+    static const uint32_t PCV_bit = 0;
+    static const uint32_t PCV_bitWidth = 29;
+};
+
+// Free running microsecond counter, read the whole register
+struct TIMERUS_CNTR_1US_0
+{
+    static const uint32_t addressOffset = 0x010;
+
+    static const uint32_t HIGH_VALUE_bit = 16;
+    static const uint32_t HIGH_VALUE_bitWidth = 16;
+
+    static const uint32_t LOW_VALUE_bit = 0;
+    static const uint32_t LOW_VALUE_bitWidth = 16;
+};
+
+// Oscillator to microsecond divider, (USEC_DIVIDEND + 1)/(USEC_DIVISOR + 1)
+struct TIMERUS_USEC_CFG_0
+{
+    static const uint32_t addressOffset = 0x014;
+
+    static const uint32_t USEC_DIVIDEND_bit = 8;
+    static const uint32_t USEC_DIVIDEND_bitWidth = 8;
+
+    static const uint32_t USEC_DIVISOR_bit = 0;
+    static const uint32_t USEC_DIVISOR_bitWidth = 8;
+};
+
+class TimerController
+{
+    public:
+        TimerController();
+
+        TimerController(const TimerController&) = delete;
+        TimerController& operator=(const TimerController&) = delete;
+
+        /*
+         * The microsecond counter wraps every 71.6 minutes, subtract two
+         * readings as uint32_t to get the elapsed time across a wrap.
+         */
+        inline uint32_t getMicroseconds();
+        volatile uint32_t* getMicrosecondCounterAddress();
+
+        void setMicrosecondDivider(uint32_t dividend, uint32_t divisor);
+        uint32_t getMicrosecondDividend();
+        uint32_t getMicrosecondDivisor();
+
+        /*
+         * timerNumber is 0 through 13, see the table above. The timer counts
+         * down from periodUs - 1 and expires periodUs microseconds later.
+         */
+        void startTimer(uint32_t timerNumber, uint32_t periodUs, bool periodic);
+        void stopTimer(uint32_t timerNumber);
+        bool isTimerEnabled(uint32_t timerNumber);
+        uint32_t getTimerCount(uint32_t timerNumber);
+        void clearTimerInterrupt(uint32_t timerNumber);
+
+        static uint32_t getTimerOffset(uint32_t timerNumber);
+
+    private:
+        PeripheralController timer;
+        volatile uint32_t* microsecondCounter;
+};
+
+inline uint32_t TimerController::getMicroseconds()
+{
+    return *microsecondCounter;
+}
+
+#endif //TIMER_CONTROLLER_H
@@ -0,0 +1,94 @@
+#include "timestamp.h"
+#include <cstdint>
+#include <cassert>
+#include <time.h>
+
+static const uint64_t FREQUENCY_CALIBRATION_NS = 10000000;
+static const uint32_t ANCHOR_ATTEMPTS = 16;
+
+std::atomic<uint64_t> Timestamp::counterFrequencyHz(0);
+std::atomic<uint64_t> Timestamp::nsPerTickQ32(0);
+
+static uint64_t monotonicNs()
+{
+    timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return ((uint64_t)time.tv_sec*1000000000ull) + time.tv_nsec;
+}
+
+uint64_t Timestamp::measureCounterFrequency()
+{
+#if defined(__aarch64__)
+    uint64_t frequency;
+    __asm__ __volatile__("mrs %0, cntfrq_el0" : "=r"(frequency));
+    return frequency;
+#elif defined(__x86_64__)
+    // The TSC rate is not architectural, measure it against CLOCK_MONOTONIC
+    uint64_t startNs = monotonicNs();
+    uint64_t startCounter = readCounter();
+    uint64_t endNs = startNs;
+    while((endNs - startNs) < FREQUENCY_CALIBRATION_NS)
+    {
+        endNs = monotonicNs();
+    }
+    uint64_t endCounter = readCounter();
+    return (uint64_t)(((uint128_t)(endCounter - startCounter)*1000000000ull)/(endNs - startNs));
+#else
+    return 1000000000ull;
+#endif
+}
+
+void Timestamp::calibrate()
+{
+    // A function local static is initialised once, threads arriving meanwhile wait for it
+    static const uint64_t frequency = measureCounterFrequency();
+    assert(frequency > 0);
+
+    counterFrequencyHz.store(frequency, std::memory_order_relaxed);
+    nsPerTickQ32.store((1000000000ull << 32)/frequency, std::memory_order_release);
+}
+
+uint64_t Timestamp::getCounterFrequency()
+{
+    if(nsPerTickQ32.load(std::memory_order_acquire) == 0)
+    {
+        calibrate();
+    }
+    return counterFrequencyHz.load(std::memory_order_relaxed);
+}
+
+/*
+ * Brackets a CLOCK_MONOTONIC read with two counter reads and keeps the
+ * attempt with the narrowest bracket, the counter value is its midpoint.
+ */
+TimestampAnchor Timestamp::takeAnchor()
+{
+    TimestampAnchor best;
+    uint64_t bestWindow = UINT64_MAX;
+
+    for(uint32_t i = 0; i < ANCHOR_ATTEMPTS; i++)
+    {
+        uint64_t before = readCounter();
+        uint64_t monotonic = monotonicNs();
+        uint64_t after = readCounter();
+
+        if((after - before) < bestWindow)
+        {
+            bestWindow = after - before;
+            best.counter = before + ((after - before)/2);
+            best.monotonicNs = monotonic;
+        }
+    }
+
+    best.uncertaintyNs = toNs(bestWindow)/2;
+    return best;
+}
+
+uint64_t Timestamp::toMonotonicNs(uint64_t counter, const TimestampAnchor& anchor)
+{
+    if(counter >= anchor.counter)
+    {
+        return anchor.monotonicNs + toNs(counter - anchor.counter);
+    }
+    return anchor.monotonicNs - toNs(anchor.counter - counter);
+}
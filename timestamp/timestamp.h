@@ -0,0 +1,131 @@
+/**
+ * @file timestamp.h
+ * @brief high resolution timestamp class declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano high resolution timestamps
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class Timestamp
+ * @brief System call free timestamps for register events
+ *
+ * @section Description
+ *
+ * Timestamp::now() is the one clock used by every timed path in this
+ * library. It reads a free running counter directly and scales it to
+ * nanoseconds with a multiply and a shift:
+ *
+ * - aarch64: the ARM generic timer, CNTVCT_EL0, at CNTFRQ_EL0 (19.2 MHz on
+ *   the Nano, so one tick is about 52 ns).
+ * - x86_64: the TSC, for running in simulation. Its frequency is measured
+ *   against CLOCK_MONOTONIC by calibrate().
+ * - anything else: CLOCK_MONOTONIC through clock_gettime.
+ *
+ * The conversion is set up on the first call, from whichever thread gets
+ * there first, the others wait for it. Call calibrate() at start up to take
+ * the cost (about 10 ms on x86_64) out of the first timed loop.
+ *
+ * The time base has its own epoch. To line timestamps up with system logs
+ * take an anchor, a (counter, CLOCK_MONOTONIC) pair read back to back, and
+ * convert with toMonotonicNs().
+ */
+
+#ifndef TIMESTAMP_H
+#define TIMESTAMP_H
+
+#include <cstdint>
+#include <atomic>
+#include <time.h>
+
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+struct TimestampAnchor
+{
+    uint64_t counter;
+    uint64_t monotonicNs;
+    uint64_t uncertaintyNs; // half the window the CLOCK_MONOTONIC read fell in
+};
+
+class Timestamp
+{
+    public:
+        static void calibrate();
+
+        // Nanoseconds on the counter's time base.
+        static inline uint64_t now();
+
+        // Raw counter ticks, and their conversion.
+        static inline uint64_t readCounter();
+        static inline uint64_t toNs(uint64_t counter);
+
+        static uint64_t getCounterFrequency();
+
+        static TimestampAnchor takeAnchor();
+        static uint64_t toMonotonicNs(uint64_t counter, const TimestampAnchor& anchor);
+
+    private:
+        __extension__ typedef unsigned __int128 uint128_t;
+
+        static uint64_t measureCounterFrequency();
+
+        // nsPerTickQ32 is stored last with release, a non zero acquire load of it publishes both
+        static std::atomic<uint64_t> counterFrequencyHz;
+        static std::atomic<uint64_t> nsPerTickQ32; // 32 fractional bits, 0 until calibrated
+};
+
+inline uint64_t Timestamp::readCounter()
+{
+#if defined(__aarch64__)
+    uint64_t counter;
+    // isb keeps the read from being hoisted above the code being timed
+    __asm__ __volatile__("isb; mrs %0, cntvct_el0" : "=r"(counter) : : "memory");
+    return counter;
+#elif defined(__x86_64__)
+    return __rdtsc();
+#else
+    timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return ((uint64_t)time.tv_sec*1000000000ull) + time.tv_nsec;
+#endif
+}
+
+inline uint64_t Timestamp::toNs(uint64_t counter)
+{
+    uint64_t scale = nsPerTickQ32.load(std::memory_order_acquire);
+    if(scale == 0)
+    {
+        calibrate();
+        scale = nsPerTickQ32.load(std::memory_order_acquire);
+    }
+    return (uint64_t)(((uint128_t)counter*scale) >> 32);
+}
+
+inline uint64_t Timestamp::now()
+{
+    return toNs(readCounter());
+}
+
+#endif //TIMESTAMP_H
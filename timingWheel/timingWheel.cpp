@@ -0,0 +1,378 @@
+#include "timingWheel.h"
+#include "../gpioController/gpio.h"
+#include "../realTimeExecutor/realTimeExecutor.h"
+#include <cstdint>
+#include <chrono>
+#include <cassert>
+
+// Sleep until this close to the next pending tick, then spin the rest of the way
+static const uint64_t SPIN_WINDOW_NS = 50000;
+
+// Upper bound on a sleep with nothing pending, schedule() wakes the thread early
+static const uint64_t IDLE_SLEEP_NS = 100000000;
+
+static const uint64_t WHEEL_RANGE_TICKS = 1ull << (TimingWheel::SLOT_BITS*TimingWheel::NUMBER_OF_WHEELS);
+
+TimingWheel::TimingWheel(uint32_t tickNs, uint32_t capacity) : gpio(gpioController::gpioController1BaseAddress), tickNs(tickNs)
+{
+    assert(tickNs > 0);
+    assert((capacity > 0) && (capacity < 0x7FFFFFFF));
+
+    actions.resize(capacity);
+    for(uint32_t i = 0; i < capacity; i++)
+    {
+        actions[i].generation = 0;
+        actions[i].slot = NONE;
+        actions[i].next = (i + 1 < capacity) ? (int32_t)(i + 1) : NONE;
+    }
+    freeList = 0;
+
+    for(uint32_t i = 0; i < NUMBER_OF_WHEELS*SLOTS_PER_WHEEL; i++)
+    {
+        slotHeads[i] = NONE;
+        slotTails[i] = NONE;
+    }
+
+    for(uint32_t port = 0; port < gpioPort::NUMBER_OF_PORTS; port++)
+    {
+        portRegisters[port] = gpio.getRegisterAddress(gpioPortOffset(port, GPIO_MSK_OUT_0::addressOffset));
+        batchMasks[port] = 0;
+        batchValues[port] = 0;
+    }
+
+    currentTick = Timestamp::now()/tickNs;
+    plannedWakeTick = 0;
+    earliestScheduledTick = UINT64_MAX;
+    running = false;
+}
+
+TimingWheel::~TimingWheel()
+{
+    stop();
+}
+
+TimingWheel::Handle TimingWheel::schedule(uint64_t deadlineNs, GpioPin pin, uint32_t level)
+{
+    assert(pin.bit < gpioPort::PINS_PER_PORT);
+    return schedulePort(deadlineNs, pin.port, 1 << pin.bit, level ? (1 << pin.bit) : 0);
+}
+
+TimingWheel::Handle TimingWheel::schedulePort(uint64_t deadlineNs, uint32_t port, uint32_t bitMask, uint32_t bitValues)
+{
+    assert(port < gpioPort::NUMBER_OF_PORTS);
+
+    std::lock_guard<std::mutex> lock(wheelMutex);
+    return insert(deadlineNs, port, bitMask, bitValues);
+}
+
+bool TimingWheel::cancel(Handle handle)
+{
+    std::lock_guard<std::mutex> lock(wheelMutex);
+
+    uint64_t index = (handle & 0xFFFFFFFF) - 1;
+    uint32_t generation = handle >> 32;
+    if((handle == INVALID_HANDLE) || (index >= actions.size()))
+    {
+        return false;
+    }
+
+    Action& action = actions[index];
+    if((action.slot == NONE) || (action.generation != generation))
+    {
+        return false;
+    }
+
+    unlink(index);
+    action.generation++;
+    action.next = freeList;
+    freeList = index;
+    pending--;
+
+    return true;
+}
+
+uint32_t TimingWheel::advance(uint64_t nowNs)
+{
+    std::lock_guard<std::mutex> lock(wheelMutex);
+
+    return advanceTo(nowNs/tickNs);
+}
+
+void TimingWheel::start()
+{
+    assert(!running);
+
+    running = true;
+    pollingThread = std::thread(&TimingWheel::run, this);
+    RealTimeExecutor::raiseThreadPriority(pollingThread);
+}
+
+void TimingWheel::stop()
+{
+    if(!running)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(wheelMutex);
+        running = false;
+    }
+    wake.notify_one();
+    pollingThread.join();
+}
+
+uint32_t TimingWheel::getPending()
+{
+    std::lock_guard<std::mutex> lock(wheelMutex);
+    return pending;
+}
+
+uint64_t TimingWheel::getActionsFired()
+{
+    std::lock_guard<std::mutex> lock(wheelMutex);
+    return actionsFired;
+}
+
+uint64_t TimingWheel::getStoresIssued()
+{
+    std::lock_guard<std::mutex> lock(wheelMutex);
+    return storesIssued;
+}
+
+// Called with wheelMutex held
+TimingWheel::Handle TimingWheel::insert(uint64_t deadlineNs, uint32_t port, uint32_t bitMask, uint32_t bitValues)
+{
+    if(freeList == NONE)
+    {
+        return INVALID_HANDLE;
+    }
+
+    int32_t index = freeList;
+    Action& action = actions[index];
+    freeList = action.next;
+
+    action.deadlineTick = deadlineNs/tickNs;
+    action.port = port;
+    action.bitMask = bitMask & 0xFF;
+    action.bitValues = bitValues & 0xFF;
+    link(index);
+    pending++;
+
+    // The polling thread may be asleep or spinning past this deadline
+    if(running && (action.deadlineTick < plannedWakeTick))
+    {
+        earliestScheduledTick.store(action.deadlineTick, std::memory_order_relaxed);
+        wake.notify_one();
+    }
+
+    return ((uint64_t)action.generation << 32) | (uint64_t)(index + 1);
+}
+
+/*
+ * Puts an action in the slot of the lowest wheel whose range covers its
+ * distance from currentTick. Actions in the same slot keep insertion order.
+ */
+void TimingWheel::link(int32_t index)
+{
+    Action& action = actions[index];
+
+    uint64_t tick = (action.deadlineTick < currentTick) ? currentTick : action.deadlineTick;
+    if((tick - currentTick) >= WHEEL_RANGE_TICKS)
+    {
+        // Parked in the last wheel, cascading moves it closer until it fits
+        tick = currentTick + WHEEL_RANGE_TICKS - 1;
+    }
+
+    uint64_t delta = tick - currentTick;
+    uint32_t wheel = 0;
+    while((wheel < (NUMBER_OF_WHEELS - 1)) && (delta >= (1ull << (SLOT_BITS*(wheel + 1)))))
+    {
+        wheel++;
+    }
+
+    int32_t slot = (wheel*SLOTS_PER_WHEEL) + ((tick >> (SLOT_BITS*wheel)) & (SLOTS_PER_WHEEL - 1));
+
+    action.slot = slot;
+    action.next = NONE;
+    action.previous = slotTails[slot];
+    if(slotTails[slot] == NONE)
+    {
+        slotHeads[slot] = index;
+    }
+    else
+    {
+        actions[slotTails[slot]].next = index;
+    }
+    slotTails[slot] = index;
+}
+
+void TimingWheel::unlink(int32_t index)
+{
+    Action& action = actions[index];
+
+    if(action.previous == NONE)
+    {
+        slotHeads[action.slot] = action.next;
+    }
+    else
+    {
+        actions[action.previous].next = action.next;
+    }
+
+    if(action.next == NONE)
+    {
+        slotTails[action.slot] = action.previous;
+    }
+    else
+    {
+        actions[action.next].previous = action.previous;
+    }
+
+    action.slot = NONE;
+}
+
+// Re-files every action in the current slot of a wheel into the wheels below
+void TimingWheel::cascade(uint32_t wheel)
+{
+    int32_t slot = (wheel*SLOTS_PER_WHEEL) + ((currentTick >> (SLOT_BITS*wheel)) & (SLOTS_PER_WHEEL - 1));
+
+    int32_t index = slotHeads[slot];
+    slotHeads[slot] = NONE;
+    slotTails[slot] = NONE;
+
+    while(index != NONE)
+    {
+        int32_t next = actions[index].next;
+        link(index);
+        index = next;
+    }
+}
+
+// Called with wheelMutex held
+uint32_t TimingWheel::advanceTo(uint64_t targetTick)
+{
+    uint32_t stores = 0;
+    while(currentTick <= targetTick)
+    {
+        if(pending == 0)
+        {
+            // Nothing to cascade or fire, jump straight to the target
+            currentTick = targetTick + 1;
+            break;
+        }
+        stores += fireTick();
+    }
+
+    return stores;
+}
+
+/*
+ * Processes currentTick: cascades the upper wheels when the lower ones wrap,
+ * merges the due actions per port and issues one store per port touched.
+ */
+uint32_t TimingWheel::fireTick()
+{
+    for(uint32_t wheel = 1; wheel < NUMBER_OF_WHEELS; wheel++)
+    {
+        if(((currentTick >> (SLOT_BITS*(wheel - 1))) & (SLOTS_PER_WHEEL - 1)) != 0)
+        {
+            break;
+        }
+        cascade(wheel);
+    }
+
+    int32_t slot = currentTick & (SLOTS_PER_WHEEL - 1);
+    int32_t index = slotHeads[slot];
+    slotHeads[slot] = NONE;
+    slotTails[slot] = NONE;
+
+    uint32_t numberOfTouchedPorts = 0;
+    while(index != NONE)
+    {
+        Action& action = actions[index];
+        int32_t next = action.next;
+
+        if(batchMasks[action.port] == 0)
+        {
+            touchedPorts[numberOfTouchedPorts++] = action.port;
+        }
+        batchMasks[action.port] |= action.bitMask;
+        batchValues[action.port] = (batchValues[action.port] & ~action.bitMask) | action.bitValues;
+
+        action.slot = NONE;
+        action.generation++;
+        action.next = freeList;
+        freeList = index;
+        pending--;
+        actionsFired++;
+
+        index = next;
+    }
+
+    for(uint32_t i = 0; i < numberOfTouchedPorts; i++)
+    {
+        uint32_t port = touchedPorts[i];
+        *portRegisters[port] = gpioMaskedValue(batchMasks[port], batchValues[port]);
+        batchMasks[port] = 0;
+        batchValues[port] = 0;
+    }
+
+    storesIssued += numberOfTouchedPorts;
+    currentTick++;
+
+    return numberOfTouchedPorts;
+}
+
+/*
+ * The next tick worth waking up for: the first non empty slot of the first
+ * wheel, or the next cascade if the rest of the first wheel is empty.
+ */
+uint64_t TimingWheel::nextPendingTick()
+{
+    if(pending == 0)
+    {
+        return currentTick + (IDLE_SLEEP_NS/tickNs) + 1;
+    }
+
+    uint64_t cascadeTick = (currentTick | (SLOTS_PER_WHEEL - 1)) + 1;
+    for(uint64_t tick = currentTick; tick < cascadeTick; tick++)
+    {
+        if(slotHeads[tick & (SLOTS_PER_WHEEL - 1)] != NONE)
+        {
+            return tick;
+        }
+    }
+
+    return cascadeTick;
+}
+
+void TimingWheel::run()
+{
+    std::unique_lock<std::mutex> lock(wheelMutex);
+
+    while(running)
+    {
+        advanceTo(Timestamp::now()/tickNs);
+
+        uint64_t nextTick = nextPendingTick();
+        uint64_t deadlineNs = nextTick*tickNs;
+        plannedWakeTick = nextTick;
+        earliestScheduledTick.store(UINT64_MAX, std::memory_order_relaxed);
+
+        if(deadlineNs > (Timestamp::now() + SPIN_WINDOW_NS))
+        {
+            // Woken early by schedule() when an earlier action arrives. The
+            // counter has its own epoch so this waits for a duration.
+            wake.wait_for(lock, std::chrono::nanoseconds(deadlineNs - SPIN_WINDOW_NS - Timestamp::now()));
+            continue;
+        }
+
+        // schedule() cannot notify a spinning thread, it publishes an earlier tick instead
+        lock.unlock();
+        while((Timestamp::now() < deadlineNs) && (earliestScheduledTick.load(std::memory_order_relaxed) >= nextTick))
+        {
+        }
+        lock.lock();
+    }
+}
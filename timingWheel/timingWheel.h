@@ -0,0 +1,160 @@
+/**
+ * @file timingWheel.h
+ * @brief hierarchical timing wheel for GPIO events class declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano hierarchical timing wheel for GPIO events
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class TimingWheel
+ * @brief Deadline driven GPIO actions on a hierarchical timing wheel
+ *
+ * @section Description
+ *
+ * Holds future GPIO port writes in four wheels of 256 slots. The first wheel
+ * has one slot per tick, each following wheel's slot spans the whole wheel
+ * below it, so with the default 1 us tick the wheel reaches about 71
+ * minutes ahead. Deadlines further out are parked in the last wheel and
+ * re-filed by cascading until they fit, so they still fire on time.
+ *
+ * Actions live in a pool allocated up front and are kept in doubly linked
+ * per slot lists, so schedule() and cancel() are O(1) and never allocate.
+ * When a slot expires its actions are merged per port, later actions winning
+ * for the same pin, and every port touched is written with one GPIO_MSK_OUT
+ * store.
+ *
+ * Deadlines are absolute Timestamp::now() nanoseconds. Either call advance()
+ * from your own loop or start() the built in polling thread, which sleeps
+ * until close to the next pending tick and spins the rest of the way. An
+ * earlier deadline scheduled meanwhile wakes the sleep or ends the spin.
+ *
+ * The pins must already be configured as GPIO outputs.
+ */
+
+#ifndef TIMING_WHEEL_H
+#define TIMING_WHEEL_H
+
+#include <cstdint>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+#include "../peripheralController/peripheralController.h"
+#include "../gpioController/gpioPin.h"
+#include "../timestamp/timestamp.h"
+
+class TimingWheel
+{
+    public:
+        typedef uint64_t Handle;
+        static const Handle INVALID_HANDLE = 0;
+
+        static const uint32_t NUMBER_OF_WHEELS = 4;
+        static const uint32_t SLOT_BITS = 8;
+        static const uint32_t SLOTS_PER_WHEEL = 1 << SLOT_BITS;
+
+        TimingWheel(uint32_t tickNs = 1000, uint32_t capacity = 4096);
+        ~TimingWheel();
+
+        TimingWheel(const TimingWheel&) = delete;
+        TimingWheel& operator=(const TimingWheel&) = delete;
+
+        /*
+         * Returns INVALID_HANDLE when every action in the pool is pending.
+         * Deadlines already in the past fire on the next advance.
+         */
+        Handle schedule(uint64_t deadlineNs, GpioPin pin, uint32_t level);
+        Handle schedulePort(uint64_t deadlineNs, uint32_t port, uint32_t bitMask, uint32_t bitValues);
+
+        // False if the action already fired or was cancelled.
+        bool cancel(Handle handle);
+
+        /*
+         * Fires every action due up to nowNs. Returns the number of
+         * GPIO_MSK_OUT stores issued.
+         */
+        uint32_t advance(uint64_t nowNs);
+
+        void start();
+        void stop();
+
+        uint32_t getPending();
+        uint64_t getActionsFired();
+        uint64_t getStoresIssued();
+
+    private:
+        static const int32_t NONE = -1;
+
+        struct Action
+        {
+            uint64_t deadlineTick;
+            uint32_t port;
+            uint32_t bitMask;
+            uint32_t bitValues;
+            uint32_t generation;
+            int32_t slot; // NONE when free
+            int32_t previous;
+            int32_t next;
+        };
+
+        Handle insert(uint64_t deadlineNs, uint32_t port, uint32_t bitMask, uint32_t bitValues);
+        void link(int32_t index);
+        void unlink(int32_t index);
+        void cascade(uint32_t wheel);
+        uint32_t advanceTo(uint64_t targetTick);
+        uint32_t fireTick();
+        uint64_t nextPendingTick();
+        void run();
+
+        PeripheralController gpio;
+        const uint32_t tickNs;
+
+        std::vector<Action> actions;
+        int32_t freeList;
+        uint32_t pending = 0;
+
+        int32_t slotHeads[NUMBER_OF_WHEELS*SLOTS_PER_WHEEL];
+        int32_t slotTails[NUMBER_OF_WHEELS*SLOTS_PER_WHEEL];
+        uint64_t currentTick; // next tick to be processed
+
+        // Per port batch for the tick being fired
+        volatile uint32_t* portRegisters[gpioPort::NUMBER_OF_PORTS];
+        uint32_t batchMasks[gpioPort::NUMBER_OF_PORTS];
+        uint32_t batchValues[gpioPort::NUMBER_OF_PORTS];
+        uint32_t touchedPorts[gpioPort::NUMBER_OF_PORTS];
+
+        uint64_t actionsFired = 0;
+        uint64_t storesIssued = 0;
+
+        std::mutex wheelMutex;
+        std::condition_variable wake;
+        uint64_t plannedWakeTick;
+        std::atomic<uint64_t> earliestScheduledTick; // earlier than plannedWakeTick ends the spin
+        std::thread pollingThread;
+        std::atomic<bool> running;
+};
+
+#endif //TIMING_WHEEL_H
@@ -0,0 +1,263 @@
+#include "uartController.h"
+#include "../gpioController/gpio.h"
+#include "../gpioController/gpioPin.h"
+#include "../pinmuxController/pinmuxController.h"
+#include "../timestamp/timestamp.h"
+#include "../realTimeExecutor/realTimeExecutor.h"
+#include <cstdint>
+#include <cassert>
+#include <sched.h>
+
+static uint32_t getBaseAddress(uint32_t controller)
+{
+    static const uint32_t baseAddresses[] = {uartController::UARTA_baseAddress, uartController::UARTB_baseAddress,
+        uartController::UARTC_baseAddress, uartController::UARTD_baseAddress};
+
+    assert((controller >= uartController::UARTA) && (controller <= uartController::UARTD));
+    return baseAddresses[controller - uartController::UARTA];
+}
+
+static uint32_t getCarDevice(uint32_t controller)
+{
+    static const uint32_t carDevices[] = {carController::UARTA, carController::UARTB, carController::UARTC, carController::UARTD};
+
+    assert((controller >= uartController::UARTA) && (controller <= uartController::UARTD));
+    return carDevices[controller - uartController::UARTA];
+}
+
+UartController::UartController(uint32_t controller) : uart(getBaseAddress(controller)), carDevice(getCarDevice(controller))
+{
+    dataRegister = uart.getRegisterAddress(UART_THR_DLAB_0_0::addressOffset);
+    lineStatusRegister = uart.getRegisterAddress(UART_LSR_0::addressOffset);
+
+    running = false;
+    overruns = 0;
+    parityErrors = 0;
+    framingErrors = 0;
+    breaks = 0;
+    ringDrops = 0;
+}
+
+UartController::~UartController()
+{
+    stopRxThread();
+}
+
+uint32_t UartController::configure(uint32_t baudRate, uint32_t wordLength, uint32_t parity, uint32_t stopBits)
+{
+    assert(baudRate > 0);
+    assert(wordLength <= uartController::WLS_BIT_8);
+    assert(parity <= uartController::PARITY_EVEN);
+    assert(stopBits <= uartController::STOP_BIT_2);
+
+    /*
+     * The CAR divider brings the module clock down to 16 times the baud
+     * rate, below about 780 baud it runs out of bits and the module clock
+     * is kept at a multiple the 16550 divisor divides down.
+     */
+    uint64_t samplesPerSecond = (uint64_t)uartController::SAMPLES_PER_BIT*baudRate;
+    assert(samplesPerSecond <= carController::PLLP_OUT0_HZ);
+    uint64_t slowestModuleClockHz = (2*(uint64_t)carController::PLLP_OUT0_HZ)/(uartController::CAR_DIVISOR_MAX + 2);
+    uint64_t multiplier = (slowestModuleClockHz + samplesPerSecond - 1)/samplesPerSecond;
+    uint32_t moduleClockHz = clockAndReset.setClockRate(carDevice, (uint32_t)(samplesPerSecond*multiplier));
+    uint64_t divisor = (moduleClockHz + (samplesPerSecond/2))/samplesPerSecond;
+    if(divisor == 0)
+    {
+        divisor = 1;
+    }
+    assert(divisor <= 0xFFFF);
+
+    uint32_t lineControl = (wordLength << UART_LCR_0::WD_SIZE_bit) | (stopBits << UART_LCR_0::STOP_bit);
+    if(parity != uartController::PARITY_NONE)
+    {
+        lineControl |= 1 << UART_LCR_0::PAR_bit;
+        if(parity == uartController::PARITY_EVEN)
+        {
+            lineControl |= 1 << UART_LCR_0::EVEN_bit;
+        }
+    }
+
+    // Polled, no interrupts
+    uart.setRegister(UART_IER_DLAB_0_0::addressOffset, 0);
+
+    uart.setRegister(UART_LCR_0::addressOffset, lineControl | (1 << UART_LCR_0::DLAB_bit));
+    uart.setRegister(UART_THR_DLAB_0_0::addressOffset, divisor & 0xFF);
+    uart.setRegister(UART_IER_DLAB_0_0::addressOffset, (divisor >> 8) & 0xFF);
+    uart.setRegister(UART_LCR_0::addressOffset, lineControl);
+
+    flushFifos();
+
+    return moduleClockHz/(uartController::SAMPLES_PER_BIT*divisor);
+}
+
+void UartController::setFlowControl(bool enable)
+{
+    uint32_t flowBits = (1 << UART_MCR_0::RTS_EN_bit) | (1 << UART_MCR_0::CTS_EN_bit);
+    uint32_t modemControl = uart.getRegister(UART_MCR_0::addressOffset) | (1 << UART_MCR_0::RTS_bit);
+
+    uart.setRegister(UART_MCR_0::addressOffset, enable ? (modemControl | flowBits) : (modemControl & ~flowBits));
+}
+
+void UartController::flushFifos()
+{
+    // FCR is write only, every write has to carry the enable
+    uart.setRegister(UART_IIR_FCR_0::addressOffset, (1 << UART_IIR_FCR_0::FCR_EN_FIFO_bit) |
+        (1 << UART_IIR_FCR_0::RX_CLR_bit) | (1 << UART_IIR_FCR_0::TX_CLR_bit));
+}
+
+void UartController::write(const uint8_t* data, uint32_t length)
+{
+    for(uint32_t i = 0; i < length; i++)
+    {
+        uint32_t lineStatus = *lineStatusRegister;
+        countErrors(lineStatus);
+        while(((lineStatus >> UART_LSR_0::TX_FIFO_FULL_bit) & 1) != 0)
+        {
+            lineStatus = *lineStatusRegister;
+            countErrors(lineStatus);
+        }
+        *dataRegister = data[i];
+    }
+}
+
+void UartController::drain()
+{
+    uint32_t lineStatus = *lineStatusRegister;
+    countErrors(lineStatus);
+    while(((lineStatus >> UART_LSR_0::TMTY_bit) & 1) == 0)
+    {
+        lineStatus = *lineStatusRegister;
+        countErrors(lineStatus);
+    }
+}
+
+uint32_t UartController::tryRead(uint8_t* data, uint32_t length)
+{
+    uint32_t count = 0;
+    while(count < length)
+    {
+        uint32_t lineStatus = *lineStatusRegister;
+        countErrors(lineStatus);
+        if(((lineStatus >> UART_LSR_0::RDR_bit) & 1) == 0)
+        {
+            break;
+        }
+        data[count++] = (uint8_t)*dataRegister;
+    }
+    return count;
+}
+
+uint32_t UartController::read(uint8_t* data, uint32_t length, uint64_t timeoutNs)
+{
+    uint64_t deadline = Timestamp::now() + timeoutNs;
+    uint32_t count = tryRead(data, length);
+
+    while((count < length) && (Timestamp::now() < deadline))
+    {
+        count += tryRead(data + count, length - count);
+    }
+    return count;
+}
+
+void UartController::startRxThread(uint32_t ringSize, int cpu)
+{
+    assert(!running);
+
+    ring.reset(new RingBuffer<uint8_t>(ringSize));
+    running = true;
+    rxThread = std::thread(&UartController::rxLoop, this, cpu);
+    RealTimeExecutor::raiseThreadPriority(rxThread);
+}
+
+void UartController::stopRxThread()
+{
+    if(!running)
+    {
+        return;
+    }
+
+    running = false;
+    rxThread.join();
+}
+
+uint32_t UartController::readRing(uint8_t* data, uint32_t length)
+{
+    assert(ring);
+    return ring->read(data, length);
+}
+
+uint32_t UartController::getRingLevel()
+{
+    assert(ring);
+    return ring->size();
+}
+
+UartErrorCounts UartController::getErrorCounts()
+{
+    UartErrorCounts errorCounts;
+    errorCounts.overruns = overruns;
+    errorCounts.parityErrors = parityErrors;
+    errorCounts.framingErrors = framingErrors;
+    errorCounts.breaks = breaks;
+    errorCounts.ringDrops = ringDrops;
+    return errorCounts;
+}
+
+void UartController::rxLoop(int cpu)
+{
+    if(cpu >= 0)
+    {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(cpu, &cpuSet);
+        sched_setaffinity(0, sizeof(cpuSet), &cpuSet);
+    }
+
+    uint8_t burst[uartController::FIFO_DEPTH];
+    while(running)
+    {
+        uint32_t count = tryRead(burst, uartController::FIFO_DEPTH);
+        if(count > 0)
+        {
+            uint32_t written = ring->write(burst, count);
+            if(written < count)
+            {
+                ringDrops += count - written;
+            }
+        }
+    }
+}
+
+// LSR error bits clear on read, so they are counted every time LSR is read
+void UartController::countErrors(uint32_t lineStatus)
+{
+    if(((lineStatus >> UART_LSR_0::OVRF_bit) & 1) != 0)
+    {
+        overruns++;
+    }
+    if(((lineStatus >> UART_LSR_0::PERR_bit) & 1) != 0)
+    {
+        parityErrors++;
+    }
+    if(((lineStatus >> UART_LSR_0::FERR_bit) & 1) != 0)
+    {
+        framingErrors++;
+    }
+    if(((lineStatus >> UART_LSR_0::BRK_bit) & 1) != 0)
+    {
+        breaks++;
+    }
+}
+
+void UartController::attachHeaderPort()
+{
+    PeripheralController myPinMuxController(pinmuxController::baseAddress);
+    PeripheralController myGpioController(gpioController::gpioController1BaseAddress);
+
+    // Header pins #8, #10, #11, #36, Tegra UART2 (UARTB), GPIO Port PG.00 - PG.03
+    attachPad<PINMUX_AUX_UART2_TX_0>(myPinMuxController, pinmuxController::PM_BIT_UARTB, pinmuxController::E_INPUT_BIT_DISABLE);
+    attachPad<PINMUX_AUX_UART2_RX_0>(myPinMuxController, pinmuxController::PM_BIT_UARTB, pinmuxController::E_INPUT_BIT_ENABLE);
+    attachPad<PINMUX_AUX_UART2_RTS_0>(myPinMuxController, pinmuxController::PM_BIT_UARTB, pinmuxController::E_INPUT_BIT_DISABLE);
+    attachPad<PINMUX_AUX_UART2_CTS_0>(myPinMuxController, pinmuxController::PM_BIT_UARTB, pinmuxController::E_INPUT_BIT_ENABLE);
+    myGpioController.setRegister(gpioPortOffset(gpioPort::PG, GPIO_MSK_CNF_0::addressOffset), gpioMaskedValue(0x0F, gpioController::BIT_N_SPIO));
+}
@@ -0,0 +1,315 @@
+/**
+ * @file uartController.h
+ * @brief UART controller register declaration and class declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano UART controller direct register access drivers
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class UartController
+ * @brief Polled UART on the Tegra 16550 compatible UARTs
+ *
+ * @section Description
+ *
+ * The header's UART is Tegra UART2, UARTB at 0x70006040:
+ * _________________________________________________
+ * Header Pin # | Tegra Pin Name | Function | GPIO Port
+ * 8            | UART2_TX       | TXD      | PG.00
+ * 10           | UART2_RX       | RXD      | PG.01
+ * 11           | UART2_RTS      | RTS      | PG.02
+ * 36           | UART2_CTS      | CTS      | PG.03
+ *
+ * All I/O is polled straight out of the 32 byte hardware FIFOs, the
+ * Tegra LSR has TX_FIFO_FULL and RX_FIFO_EMPTY bits so no byte waits on an
+ * interrupt or the tty layer. Either read the FIFO directly from the thread
+ * that needs the data, or start the RX thread, which drains the FIFO into a
+ * lock-free ring the application reads from without a system call.
+ *
+ * The baud rate is the module clock/(16*divisor). configure() sets the CAR
+ * UART divider to bring the module clock from PLLP down to 16 times the baud
+ * rate, the way the kernel's serial driver does, and the 16550 divisor only
+ * takes up what the CAR divider cannot reach. Stop the serial console or
+ * nvgetty on the port first, the tty driver would race this one.
+ */
+
+#ifndef UART_CONTROLLER_H
+#define UART_CONTROLLER_H
+
+#include <cstdint>
+#include <thread>
+#include <atomic>
+#include <memory>
+
+#include "../peripheralController/peripheralController.h"
+#include "../carController/carController.h"
+#include "../ringBuffer/ringBuffer.h"
+
+struct uartController
+{
+    static const uint32_t UARTA_baseAddress = 0x70006000;
+    static const uint32_t UARTB_baseAddress = 0x70006040;
+    static const uint32_t UARTC_baseAddress = 0x70006200;
+    static const uint32_t UARTD_baseAddress = 0x70006300;
+
+    static const uint32_t UARTA = 1;
+    static const uint32_t UARTB = 2;
+    static const uint32_t UARTC = 3;
+    static const uint32_t UARTD = 4;
+
+    static const uint32_t FIFO_DEPTH = 32;
+    static const uint32_t SAMPLES_PER_BIT = 16;
+    static const uint32_t CAR_DIVISOR_MAX = 0xFFFF;
+
+    static const uint32_t WLS_BIT_5 = 0;
+    static const uint32_t WLS_BIT_6 = 1;
+    static const uint32_t WLS_BIT_7 = 2;
+    static const uint32_t WLS_BIT_8 = 3;
+
+    static const uint32_t PARITY_NONE = 0;
+    static const uint32_t PARITY_ODD = 1;
+    static const uint32_t PARITY_EVEN = 2;
+
+    static const uint32_t STOP_BIT_1 = 0;
+    static const uint32_t STOP_BIT_2 = 1; // 1.5 with 5 bit words
+
+    static const uint32_t DEFAULT_RING_SIZE = 4096;
+};
+
+// UART_THR_DLAB_0_0, THR on write and RBR on read while LCR.DLAB is 0, DLL while it is 1
+struct UART_THR_DLAB_0_0
+{
+    static const uint32_t addressOffset = 0x00;
+};
+
+// UART_IER_DLAB_0_0, IER while LCR.DLAB is 0, DLM while it is 1
+struct UART_IER_DLAB_0_0
+{
+    static const uint32_t addressOffset = 0x04;
+};
+
+// UART_IIR_FCR_0, IIR on read, FCR on write
+struct UART_IIR_FCR_0
+{
+    static const uint32_t addressOffset = 0x08;
+
+    static const uint32_t RX_TRIG_bit = 6;
+    static const uint32_t RX_TRIG_bitWidth = 2;
+
+    static const uint32_t TX_TRIG_bit = 4;
+    static const uint32_t TX_TRIG_bitWidth = 2;
+
+    static const uint32_t DMA_bit = 3;
+    static const uint32_t DMA_bitWidth = 1;
+
+    static const uint32_t TX_CLR_bit = 2;
+    static const uint32_t TX_CLR_bitWidth = 1;
+
+    static const uint32_t RX_CLR_bit = 1;
+    static const uint32_t RX_CLR_bitWidth = 1;
+
+    static const uint32_t FCR_EN_FIFO_bit = 0;
+    static const uint32_t FCR_EN_FIFO_bitWidth = 1;
+};
+
+// UART_LCR_0
+struct UART_LCR_0
+{
+    static const uint32_t addressOffset = 0x0C;
+
+    static const uint32_t DLAB_bit = 7;
+    static const uint32_t DLAB_bitWidth = 1;
+
+    static const uint32_t SET_B_bit = 6;
+    static const uint32_t SET_B_bitWidth = 1;
+
+    static const uint32_t SET_P_bit = 5;
+    static const uint32_t SET_P_bitWidth = 1;
+
+    static const uint32_t EVEN_bit = 4;
+    static const uint32_t EVEN_bitWidth = 1;
+
+    static const uint32_t PAR_bit = 3;
+    static const uint32_t PAR_bitWidth = 1;
+
+    static const uint32_t STOP_bit = 2;
+    static const uint32_t STOP_bitWidth = 1;
+
+    static const uint32_t WD_SIZE_bit = 0;
+    static const uint32_t WD_SIZE_bitWidth = 2;
+};
+
+// UART_MCR_0
+struct UART_MCR_0
+{
+    static const uint32_t addressOffset = 0x10;
+
+    static const uint32_t RTS_EN_bit = 6;
+    static const uint32_t RTS_EN_bitWidth = 1;
+
+    static const uint32_t CTS_EN_bit = 5;
+    static const uint32_t CTS_EN_bitWidth = 1;
+
+    static const uint32_t LOOPBK_bit = 4;
+    static const uint32_t LOOPBK_bitWidth = 1;
+
+    static const uint32_t RTS_bit = 1;
+    static const uint32_t RTS_bitWidth = 1;
+
+    static const uint32_t DTR_bit = 0;
+    static const uint32_t DTR_bitWidth = 1;
+};
+
+// UART_LSR_0, reading clears the error bits
+struct UART_LSR_0
+{
+    static const uint32_t addressOffset = 0x14;
+
+    static const uint32_t RX_FIFO_EMPTY_bit = 9;
+    static const uint32_t RX_FIFO_EMPTY_bitWidth = 1;
+
+    static const uint32_t TX_FIFO_FULL_bit = 8;
+    static const uint32_t TX_FIFO_FULL_bitWidth = 1;
+
+    static const uint32_t FIFOE_bit = 7;
+    static const uint32_t FIFOE_bitWidth = 1;
+
+    static const uint32_t TMTY_bit = 6;
+    static const uint32_t TMTY_bitWidth = 1;
+
+    static const uint32_t THRE_bit = 5;
+    static const uint32_t THRE_bitWidth = 1;
+
+    static const uint32_t BRK_bit = 4;
+    static const uint32_t BRK_bitWidth = 1;
+
+    static const uint32_t FERR_bit = 3;
+    static const uint32_t FERR_bitWidth = 1;
+
+    static const uint32_t PERR_bit = 2;
+    static const uint32_t PERR_bitWidth = 1;
+
+    static const uint32_t OVRF_bit = 1;
+    static const uint32_t OVRF_bitWidth = 1;
+
+    static const uint32_t RDR_bit = 0;
+    static const uint32_t RDR_bitWidth = 1;
+};
+
+// UART_MSR_0
+struct UART_MSR_0
+{
+    static const uint32_t addressOffset = 0x18;
+
+    static const uint32_t CTS_bit = 4;
+    static const uint32_t CTS_bitWidth = 1;
+};
+
+// UART_SPR_0
+struct UART_SPR_0
+{
+    static const uint32_t addressOffset = 0x1C;
+};
+
+struct UartErrorCounts
+{
+    uint64_t overruns;      // hardware FIFO overflowed, bytes lost before they were read
+    uint64_t parityErrors;
+    uint64_t framingErrors;
+    uint64_t breaks;
+    uint64_t ringDrops;     // RX thread found the ring full
+};
+
+class UartController
+{
+    public:
+        // uartController::UARTA through uartController::UARTD
+        UartController(uint32_t controller);
+        ~UartController();
+
+        UartController(const UartController&) = delete;
+        UartController& operator=(const UartController&) = delete;
+
+        /*
+         * Baud rate and framing, polled with the FIFOs on. Programs the CAR
+         * module clock as well, returns the baud rate actually produced.
+         */
+        uint32_t configure(uint32_t baudRate, uint32_t wordLength = uartController::WLS_BIT_8,
+            uint32_t parity = uartController::PARITY_NONE, uint32_t stopBits = uartController::STOP_BIT_1);
+        void setFlowControl(bool enable);
+        void flushFifos();
+
+        // Queues every byte, waiting only while the TX FIFO is full.
+        void write(const uint8_t* data, uint32_t length);
+        // Waits until the last bit has left the shift register.
+        void drain();
+
+        /*
+         * Direct FIFO reads, do not mix with the RX thread. tryRead takes
+         * what is waiting without blocking; read waits for length bytes or
+         * until timeoutNs passes. Both return the number of bytes read.
+         */
+        uint32_t tryRead(uint8_t* data, uint32_t length);
+        uint32_t read(uint8_t* data, uint32_t length, uint64_t timeoutNs);
+
+        /*
+         * The RX thread spins on the FIFO and moves bytes into a lock-free
+         * ring, readRing() takes them out from any one consumer thread.
+         */
+        void startRxThread(uint32_t ringSize = uartController::DEFAULT_RING_SIZE, int cpu = -1);
+        void stopRxThread();
+        uint32_t readRing(uint8_t* data, uint32_t length);
+        uint32_t getRingLevel();
+
+        UartErrorCounts getErrorCounts();
+
+        /*
+         * Header pins 8, 10, 11 and 36: pinmux to UARTB, input buffers on
+         * for RX and CTS, out of tristate, and the GPIO controller handing
+         * PG.00 - PG.03 to the SFIO.
+         */
+        static void attachHeaderPort();
+
+    private:
+        void rxLoop(int cpu);
+        void countErrors(uint32_t lineStatus);
+
+        PeripheralController uart;
+        CarController clockAndReset;
+        const uint32_t carDevice;
+
+        volatile uint32_t* dataRegister;
+        volatile uint32_t* lineStatusRegister;
+
+        std::unique_ptr<RingBuffer<uint8_t>> ring;
+        std::thread rxThread;
+        std::atomic<bool> running;
+
+        std::atomic<uint64_t> overruns;
+        std::atomic<uint64_t> parityErrors;
+        std::atomic<uint64_t> framingErrors;
+        std::atomic<uint64_t> breaks;
+        std::atomic<uint64_t> ringDrops;
+};
+
+#endif //UART_CONTROLLER_H
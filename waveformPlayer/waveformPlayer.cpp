@@ -0,0 +1,144 @@
+#include "waveformPlayer.h"
+#include "../gpioController/gpio.h"
+#include "../timestamp/timestamp.h"
+#include <cstdint>
+#include <algorithm>
+#include <limits>
+#include <cassert>
+#include <sched.h>
+
+// Gives the first store of a play() some slack after the start time is taken
+static const uint64_t START_DELAY_NS = 100000;
+static const uint32_t CALIBRATION_STORES = 1000;
+
+WaveformPlayer::WaveformPlayer() : gpio(gpioController::gpioController1BaseAddress)
+{
+}
+
+void WaveformPlayer::load(const std::vector<WaveformStep>& steps, uint32_t lengthNs)
+{
+    std::vector<WaveformStep> sortedSteps(steps);
+    std::stable_sort(sortedSteps.begin(), sortedSteps.end(), [](const WaveformStep& a, const WaveformStep& b)
+    {
+        return a.timeNs < b.timeNs;
+    });
+
+    assert(sortedSteps.empty() || (sortedSteps.back().timeNs < lengthNs));
+
+    entries.clear();
+    timing.clear();
+    for(uint32_t i = 0; i < sortedSteps.size(); i++)
+    {
+        assert(sortedSteps[i].port < gpioPort::NUMBER_OF_PORTS);
+
+        Entry entry;
+        entry.registerAddress = gpio.getRegisterAddress(gpioPortOffset(sortedSteps[i].port, GPIO_MSK_OUT_0::addressOffset));
+        entry.value = gpioMaskedValue(sortedSteps[i].bitMask, sortedSteps[i].bitValues);
+        entry.deadlineNs = sortedSteps[i].timeNs;
+        entries.push_back(entry);
+
+        WaveformStepTiming stepTiming;
+        stepTiming.requestedNs = sortedSteps[i].timeNs;
+        timing.push_back(stepTiming);
+    }
+
+    (*this).lengthNs = lengthNs;
+    errorSumNs.assign(entries.size(), 0);
+    loopsPlayed = 0;
+    for(uint32_t i = 0; i < timing.size(); i++)
+    {
+        timing[i].lastAchievedNs = 0;
+        timing[i].minErrorNs = std::numeric_limits<int64_t>::max();
+        timing[i].maxErrorNs = std::numeric_limits<int64_t>::min();
+        timing[i].meanErrorNs = 0;
+    }
+}
+
+uint32_t WaveformPlayer::calibrate()
+{
+    // An empty mask writes nothing, so this is safe on any port
+    volatile uint32_t* registerAddress = gpio.getRegisterAddress(GPIO_MSK_OUT_0::addressOffset);
+
+    uint64_t start = Timestamp::now();
+    for(uint32_t i = 0; i < CALIBRATION_STORES; i++)
+    {
+        *registerAddress = gpioMaskedValue(0, 0);
+    }
+    storeLeadNs = (Timestamp::now() - start)/CALIBRATION_STORES;
+
+    return storeLeadNs;
+}
+
+uint32_t WaveformPlayer::getStoreLeadNs()
+{
+    return storeLeadNs;
+}
+
+void WaveformPlayer::setCpu(int cpu)
+{
+    (*this).cpu = cpu;
+}
+
+bool WaveformPlayer::play(uint32_t numberOfLoops)
+{
+    if(cpu >= 0)
+    {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(cpu, &cpuSet);
+        if(sched_setaffinity(0, sizeof(cpuSet), &cpuSet) != 0)
+        {
+            return false;
+        }
+    }
+
+    const Entry* entryArray = entries.data();
+    WaveformStepTiming* timingArray = timing.data();
+    int64_t* errorSumArray = errorSumNs.data();
+    uint32_t numberOfEntries = entries.size();
+
+    uint64_t loopStart = Timestamp::now() + START_DELAY_NS;
+    for(uint32_t loop = 0; loop < numberOfLoops; loop++)
+    {
+        for(uint32_t i = 0; i < numberOfEntries; i++)
+        {
+            uint64_t issueTime = loopStart + entryArray[i].deadlineNs - storeLeadNs;
+            while(Timestamp::now() < issueTime)
+            {
+            }
+            *entryArray[i].registerAddress = entryArray[i].value;
+
+            // Accounted for in the slack before the next entry, never between loops
+            int64_t achievedNs = (int64_t)(Timestamp::now() - loopStart);
+            int64_t errorNs = achievedNs - (int64_t)entryArray[i].deadlineNs;
+            timingArray[i].lastAchievedNs = achievedNs;
+            timingArray[i].minErrorNs = std::min(timingArray[i].minErrorNs, errorNs);
+            timingArray[i].maxErrorNs = std::max(timingArray[i].maxErrorNs, errorNs);
+            errorSumArray[i] += errorNs;
+        }
+
+        loopStart += lengthNs;
+    }
+
+    loopsPlayed += numberOfLoops;
+    return true;
+}
+
+std::vector<WaveformStepTiming> WaveformPlayer::getTiming()
+{
+    std::vector<WaveformStepTiming> report(timing);
+    for(uint32_t i = 0; i < report.size(); i++)
+    {
+        if(loopsPlayed == 0)
+        {
+            report[i].minErrorNs = 0;
+            report[i].maxErrorNs = 0;
+        }
+        else
+        {
+            report[i].meanErrorNs = errorSumNs[i]/(int64_t)loopsPlayed;
+        }
+    }
+
+    return report;
+}
@@ -0,0 +1,127 @@
+/**
+ * @file waveformPlayer.h
+ * @brief precomputed GPIO waveform playback class declaration
+ * @author Matthew Hardenburgh
+ * @version 0.1
+ * @date 10/18/26
+ * @copyright Matthew Hardenburgh 2026
+ *
+ * @section license LICENSE
+ *
+ * Jetson Nano precomputed GPIO waveform playback
+ * Copyright (C) 2026  Matthew Hardenburgh
+ * mdhardenburgh@protonmail.com
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see https://www.gnu.org/licenses/.
+ */
+
+/**
+ * @class WaveformPlayer
+ * @brief Plays back digital waveforms on GPIO ports from a busy-wait loop
+ *
+ * @section Description
+ *
+ * A waveform is a list of steps, each one a set of port bits to write at a
+ * time relative to the start of the waveform. load() compiles the steps into
+ * a flat array of (register address, GPIO_MSK_OUT value, deadline) entries so
+ * the playback loop does nothing but spin to a deadline and store.
+ *
+ * The loop runs on the calling thread. For deterministic timing call play()
+ * from a thread pinned to an isolated core (see setCpu) with real-time
+ * priority. calibrate() measures the cost of a register store so each store
+ * is issued that much ahead of its deadline.
+ *
+ * The pins must already be configured as GPIO outputs.
+ */
+
+#ifndef WAVEFORM_PLAYER_H
+#define WAVEFORM_PLAYER_H
+
+#include <cstdint>
+#include <vector>
+
+#include "../peripheralController/peripheralController.h"
+#include "../gpioController/gpioPin.h"
+
+struct WaveformStep
+{
+    uint32_t timeNs; // from the start of the waveform
+    uint32_t port;   // gpioPort::PA through gpioPort::PEE
+    uint32_t bitMask;
+    uint32_t bitValues;
+};
+
+struct WaveformStepTiming
+{
+    uint32_t requestedNs;
+    int64_t lastAchievedNs; // from the start of the waveform, last loop played
+    int64_t minErrorNs;
+    int64_t maxErrorNs;
+    int64_t meanErrorNs;
+};
+
+class WaveformPlayer
+{
+    public:
+        WaveformPlayer();
+
+        WaveformPlayer(const WaveformPlayer&) = delete;
+        WaveformPlayer& operator=(const WaveformPlayer&) = delete;
+
+        /*
+         * Steps do not need to be sorted, steps with the same time keep
+         * their order. lengthNs is the time from the start of one loop to
+         * the start of the next and must be after the last step.
+         */
+        void load(const std::vector<WaveformStep>& steps, uint32_t lengthNs);
+
+        /*
+         * Measures the average cost of a GPIO_MSK_OUT store and issues
+         * every store that much early. Returns the measured cost in ns.
+         */
+        uint32_t calibrate();
+        uint32_t getStoreLeadNs();
+
+        // Pin play() to this cpu, -1 leaves the affinity alone.
+        void setCpu(int cpu);
+
+        /*
+         * Plays the waveform numberOfLoops times back to back on the
+         * calling thread. Returns false if the thread could not be moved to
+         * the requested cpu, in which case nothing is played.
+         */
+        bool play(uint32_t numberOfLoops);
+
+        std::vector<WaveformStepTiming> getTiming();
+
+    private:
+        struct Entry
+        {
+            volatile uint32_t* registerAddress;
+            uint32_t value;
+            uint64_t deadlineNs; // from the start of the waveform
+        };
+
+        PeripheralController gpio;
+
+        std::vector<Entry> entries;
+        std::vector<WaveformStepTiming> timing;
+        std::vector<int64_t> errorSumNs;
+        uint64_t loopsPlayed = 0;
+        uint32_t lengthNs = 0;
+        uint32_t storeLeadNs = 0;
+        int cpu = -1;
+};
+
+#endif //WAVEFORM_PLAYER_H